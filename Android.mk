@@ -104,11 +104,16 @@ LOCAL_SRC_FILES := \
         profiling/server/src/timelineDecoder/TimelineDirectoryCaptureCommandHandler.cpp \
         src/armnn/BackendHelper.cpp \
         src/armnn/BackendRegistry.cpp \
+        src/armnn/ConstantTensorStore.cpp \
         src/armnn/Descriptors.cpp \
+        src/armnn/DynamicBatcher.cpp \
         src/armnn/Exceptions.cpp \
         src/armnn/Graph.cpp \
+        src/armnn/GraphSerializer.cpp \
+        src/armnn/InferenceThreadPool.cpp \
         src/armnn/InternalTypes.cpp \
         src/armnn/JsonPrinter.cpp \
+        src/armnn/LatencyHistogram.cpp \
         src/armnn/Layer.cpp \
         src/armnn/LayerSupport.cpp \
         src/armnn/LoadedNetwork.cpp \
@@ -128,12 +133,15 @@ LOCAL_SRC_FILES := \
         src/armnn/TypesUtils.cpp \
         src/armnn/Utils.cpp \
         src/armnn/WallClockTimer.cpp \
+        src/armnn/WorkingMemHandle.cpp \
+        src/armnn/WorkingMemoryResidencyManager.cpp \
         src/armnnUtils/CsvReader.cpp \
         src/armnnUtils/DataLayoutIndexed.cpp \
         src/armnnUtils/DotSerializer.cpp \
         src/armnnUtils/FloatingPointConverter.cpp \
         src/armnnUtils/HeapProfiling.cpp \
         src/armnnUtils/LeakChecking.cpp \
+        src/armnnUtils/MappedFile.cpp \
         src/armnnUtils/ParserHelper.cpp \
         src/armnnUtils/Permute.cpp \
         src/armnnUtils/TensorUtils.cpp \
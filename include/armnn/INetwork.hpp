@@ -13,7 +13,9 @@
 #include <armnn/TensorFwd.hpp>
 #include <armnn/Types.hpp>
 
+#include <iosfwd>
 #include <memory>
+#include <string>
 #include <vector>
 
 namespace armnn
@@ -658,6 +660,10 @@ struct OptimizerOptions
 
     // Enable Import
     bool m_ImportEnabled;
+
+    // Directory where optimized networks are cached, keyed by the network, the backends and these options.
+    // Optimize() loads a network optimized before from there instead of optimizing it again. Disabled when empty.
+    std::string m_CachedNetworkDirectory;
 };
 
 /// Create an optimized version of the network
@@ -674,4 +680,17 @@ IOptimizedNetworkPtr Optimize(const INetwork& network,
                               const IDeviceSpec& deviceSpec,
                               const OptimizerOptions& options = OptimizerOptions(),
                               Optional<std::vector<std::string>&> messages = EmptyOptional());
+
+/// Writes an optimized network, including the backends its layers are assigned to, to a binary stream which
+/// LoadOptimizedNetwork() can read back on the same platform and version of Arm NN.
+/// @param network The optimized network to write. Networks containing pre-compiled layers can't be written.
+/// @param stream The stream to write to, which should be opened in binary mode.
+/// Throws an exception derived from armnn::Exception if the network can't be written.
+void SaveOptimizedNetwork(const IOptimizedNetwork& network, std::ostream& stream);
+
+/// Reads an optimized network written by SaveOptimizedNetwork(), which can be loaded into the runtime as is.
+/// @param stream The stream to read from, which should be opened in binary mode.
+/// @return An IOptimizedNetworkPtr interface to the optimized network, throws an exception derived from
+/// armnn::Exception if the stream doesn't hold a network written by this version of Arm NN.
+IOptimizedNetworkPtr LoadOptimizedNetwork(std::istream& stream);
 } //namespace armnn
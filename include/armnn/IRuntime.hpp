@@ -7,32 +7,161 @@
 #include "BackendOptions.hpp"
 #include "INetwork.hpp"
 #include "IProfiler.hpp"
+#include "IWorkingMemHandle.hpp"
+#include "MemorySources.hpp"
 #include "Tensor.hpp"
 #include "Types.hpp"
 #include "TypesUtils.hpp"
 #include "profiling/ILocalPacketHandler.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <future>
 #include <memory>
 
 namespace armnn
 {
 
-using NetworkId = int;
-
 class IGpuAccTunedParameters;
 
+/// Callback invoked on a runtime worker thread once an inference submitted with
+/// IRuntime::EnqueueWorkloadAsync() has completed.
+using AsyncExecutionCallback = std::function<void(Status status)>;
+
+/// Counters describing how the working memory of loaded networks is kept between calls to
+/// IRuntime::EnqueueWorkload(), see IRuntime::CreationOptions::m_WorkingMemoryBudget.
+struct WorkingMemoryResidencyStats
+{
+    /// Number of inferences whose network still held its working memory.
+    uint64_t m_Hits = 0;
+    /// Number of inferences whose network had to acquire its working memory first.
+    uint64_t m_Misses = 0;
+    /// Number of times a network released its working memory to keep the total within the budget.
+    uint64_t m_Evictions = 0;
+    /// Bytes of working memory currently held by the resident networks, as reported by the memory managers of
+    /// their backends, see NetworkMemoryUsage::m_WorkingBytes.
+    size_t m_ResidentBytes = 0;
+};
+
+/// Latency and throughput of the inferences a network has completed since it was loaded, successfully or not,
+/// see IRuntime::GetInferenceStatistics(). Percentiles are accurate to within 1/32 of their value.
+struct InferenceStatistics
+{
+    uint64_t m_NumInferences = 0;
+    uint64_t m_NumFailedInferences = 0;
+    /// Inferences abandoned because of their CancellationOptions, which aren't counted as failed.
+    uint64_t m_NumCancelledInferences = 0;
+    /// Inferences completed per second since the network was loaded.
+    double m_Throughput = 0.0;
+
+    std::chrono::nanoseconds m_MeanLatency = std::chrono::nanoseconds(0);
+    std::chrono::nanoseconds m_P50Latency = std::chrono::nanoseconds(0);
+    std::chrono::nanoseconds m_P95Latency = std::chrono::nanoseconds(0);
+    std::chrono::nanoseconds m_P99Latency = std::chrono::nanoseconds(0);
+    std::chrono::nanoseconds m_MaxLatency = std::chrono::nanoseconds(0);
+};
+
+/// Memory held by a loaded network, in bytes, see IRuntime::GetMemoryUsage().
+struct NetworkMemoryUsage
+{
+    /// Constant tensors of the network, e.g. weights and biases, as loaded. Tensors shared with other networks,
+    /// see IRuntime::CreationOptions::m_ShareConstantTensors, are counted by each of them.
+    size_t m_ConstantBytes = 0;
+    /// Intermediate tensors currently allocated, both those used by EnqueueWorkload() and those of the working
+    /// memory handles of the network. The former are only counted for backends whose memory managers report them,
+    /// such as CpuRef.
+    size_t m_WorkingBytes = 0;
+    /// The most m_WorkingBytes has been since the network was loaded.
+    size_t m_PeakWorkingBytes = 0;
+    /// Caller buffers the tensors of the network use in place instead of copying them, see
+    /// INetworkProperties::m_ImportEnabled and m_ExportEnabled: those of the latest EnqueueWorkload() call plus those
+    /// bound with IRuntime::BindIOTensors().
+    size_t m_ImportedBytes = 0;
+};
+
+/// Lets inferences be abandoned from any thread, see CancellationOptions. A token can be shared by several inferences,
+/// e.g. all those serving the same request.
+class CancellationToken
+{
+public:
+    void Cancel() { m_Cancelled.store(true, std::memory_order_relaxed); }
+    bool IsCancelled() const { return m_Cancelled.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<bool> m_Cancelled{false};
+};
+
+/// When IRuntime::EnqueueWorkload() abandons an inference, so that work whose result is no longer wanted gives its
+/// cores back to other inferences. They are checked before each workload, so a running workload always completes.
+struct CancellationOptions
+{
+    /// Whether an inference using these options must be abandoned.
+    bool IsCancelled() const
+    {
+        return (m_CancellationToken && m_CancellationToken->IsCancelled()) ||
+               (m_Deadline != std::chrono::steady_clock::time_point::max() &&
+                std::chrono::steady_clock::now() >= m_Deadline);
+    }
+
+    /// The inference is abandoned once this time has passed. By default there is no deadline.
+    std::chrono::steady_clock::time_point m_Deadline = std::chrono::steady_clock::time_point::max();
+
+    /// If set, the inference is abandoned once the token is cancelled.
+    std::shared_ptr<const CancellationToken> m_CancellationToken;
+};
+
+/// How IRuntime::EnableDynamicBatching() groups single-sample inferences into batches.
+struct DynamicBatchingOptions
+{
+    /// Number of samples at which a batch is evaluated straight away. 0 means the batch size of the batched network.
+    unsigned int m_MaxBatchSize = 0;
+
+    /// How long the first sample of a batch waits for more samples before the batch is evaluated anyway.
+    std::chrono::microseconds m_Timeout = std::chrono::microseconds(1000);
+};
+
 class IRuntime;
 using IRuntimePtr = std::unique_ptr<IRuntime, void(*)(IRuntime* runtime)>;
 
 struct INetworkProperties
 {
-    INetworkProperties(bool importEnabled = false, bool exportEnabled = false)
+    INetworkProperties(bool importEnabled = false,
+                       bool exportEnabled = false,
+                       unsigned int numWorkloadThreads = 0,
+                       unsigned int numPipelineStages = 0,
+                       MemorySource inputSource = MemorySource::Malloc,
+                       MemorySource outputSource = MemorySource::Malloc)
         : m_ImportEnabled(importEnabled),
-          m_ExportEnabled(exportEnabled) {}
+          m_ExportEnabled(exportEnabled),
+          m_NumWorkloadThreads(numWorkloadThreads),
+          m_NumPipelineStages(numPipelineStages),
+          m_InputSource(inputSource),
+          m_OutputSource(outputSource) {}
 
     const bool m_ImportEnabled;
     const bool m_ExportEnabled;
 
+    /// Number of threads the network uses to run workloads which don't depend on each other at the same time.
+    /// With 0 or 1 the workloads run one after the other, in topological order, on the thread running the inference.
+    /// Profiling events of the individual workloads are only recorded when they run on the inference's thread.
+    const unsigned int m_NumWorkloadThreads;
+
+    /// Number of stages the workloads of the network are split into when it is run with EnqueueWorkloadAsync().
+    /// Each stage runs on its own thread and each inference in flight has its own intermediate tensors, so
+    /// consecutive inferences overlap: the first layers evaluate the next input while the last layers still
+    /// evaluate the previous one. Inferences complete in submission order. With 0 or 1 the network isn't pipelined.
+    const unsigned int m_NumPipelineStages;
+
+    /// Kind of memory imported for the inputs when m_ImportEnabled, and exported to for the outputs when
+    /// m_ExportEnabled. With MemorySource::DmaBuf the memory of each bound tensor holds the int file descriptor of
+    /// the buffer with its data, such as a dma-buf or a memfd, rather than the data itself. Such tensors can only be
+    /// imported or exported, so inferences which would copy them instead, such as IRuntime::Execute() or outputs
+    /// connected to several layers, throw MemoryImportException or MemoryExportException, and the network can't be
+    /// dynamically batched.
+    const MemorySource m_InputSource;
+    const MemorySource m_OutputSource;
+
     virtual ~INetworkProperties() {}
 };
 
@@ -45,6 +174,10 @@ public:
             : m_GpuAccTunedParameters(nullptr)
             , m_EnableGpuProfiling(false)
             , m_DynamicBackendsPath("")
+            , m_AsyncWorkerThreads(1)
+            , m_AsyncQueueDepth(64)
+            , m_WorkingMemoryBudget(0)
+            , m_ShareConstantTensors(true)
         {}
 
         /// If set, uses the GpuAcc tuned parameters from the given object when executing GPU workloads.
@@ -58,6 +191,25 @@ public:
         /// Only a single path is allowed for the override
         std::string m_DynamicBackendsPath;
 
+        /// Number of worker threads the runtime uses to run inferences submitted with EnqueueWorkloadAsync().
+        /// The threads are started by the first asynchronous submission.
+        unsigned int m_AsyncWorkerThreads;
+
+        /// Maximum number of asynchronous inferences waiting for a worker thread; 0 means unbounded.
+        /// EnqueueWorkloadAsync() blocks while the queue is full.
+        unsigned int m_AsyncQueueDepth;
+
+        /// Number of bytes of working memory the networks run with EnqueueWorkload() may keep allocated between
+        /// inferences. When running a network would exceed it, the least recently used networks release their
+        /// working memory. The default of 0 means no limit: every network keeps its working memory until unloaded.
+        /// Only the memory of backends whose memory managers report it, such as CpuRef, counts towards the budget.
+        size_t m_WorkingMemoryBudget;
+
+        /// Makes the loaded networks share a single read-only copy of their identical constant tensors (e.g. the
+        /// weights of a model loaded once per worker) instead of each keeping its own. The tensors are compared by
+        /// content when a network is loaded. Supported by the CpuRef backend.
+        bool m_ShareConstantTensors;
+
         struct ExternalProfilingOptions
         {
             ExternalProfilingOptions()
@@ -144,11 +296,101 @@ public:
     virtual TensorInfo GetInputTensorInfo(NetworkId networkId, LayerBindingId layerId) const = 0;
     virtual TensorInfo GetOutputTensorInfo(NetworkId networkId, LayerBindingId layerId) const = 0;
 
-    /// Evaluates a network using input in inputTensors and outputs filled into outputTensors
+    /// Evaluates a network using input in inputTensors and outputs filled into outputTensors.
+    /// outputTensors may hold only some of the outputs of the network, in which case only the workloads these
+    /// outputs depend on are run. The workloads needed by each set of outputs are worked out once and cached.
+    /// Output subsets aren't supported by networks with dynamic batching enabled.
     virtual Status EnqueueWorkload(NetworkId networkId,
                                    const InputTensors& inputTensors,
                                    const OutputTensors& outputTensors) = 0;
 
+    /// Evaluates a network like the overload above, but returns Status::Cancelled without completing the inference
+    /// once the deadline of cancellationOptions has passed or its token is cancelled. The content of the outputs is
+    /// then undefined. A network with dynamic batching enabled only checks before the sample joins a batch.
+    virtual Status EnqueueWorkload(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   const CancellationOptions& cancellationOptions) = 0;
+
+    /// Binds input and output tensors to a network once, so the network can be evaluated on them repeatedly
+    /// without creating any workloads or tensor handles per inference.
+    /// @param [in] networkId The id of the network to bind the tensors to.
+    /// @return An id to pass to EnqueueWorkload(NetworkId, IOBindingId). The memory of inputTensors and
+    ///         outputTensors must stay valid until the binding is released with UnbindIOTensors() or
+    ///         the network is unloaded. As with EnqueueWorkload(), outputTensors may hold only some of the outputs.
+    virtual IOBindingId BindIOTensors(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors) = 0;
+
+    /// Evaluates a network using the input and output tensors bound with BindIOTensors().
+    virtual Status EnqueueWorkload(NetworkId networkId, IOBindingId ioBindingId) = 0;
+
+    /// Releases input and output tensors bound with BindIOTensors().
+    virtual Status UnbindIOTensors(NetworkId networkId, IOBindingId ioBindingId) = 0;
+
+    /// Queues an evaluation of a network on the runtime's worker threads and returns immediately.
+    /// The memory of inputTensors and outputTensors must stay valid until the returned future is ready.
+    /// Errors that EnqueueWorkload() reports by throwing are rethrown by std::future::get().
+    /// Networks loaded with INetworkProperties::m_NumPipelineStages greater than 1 are run on their own pipeline
+    /// instead, and this blocks while as many inferences as there are stages are in flight.
+    virtual std::future<Status> EnqueueWorkloadAsync(NetworkId networkId,
+                                                     const InputTensors& inputTensors,
+                                                     const OutputTensors& outputTensors) = 0;
+
+    /// Queues an evaluation of a network on the runtime's worker threads and returns immediately.
+    /// The memory of inputTensors and outputTensors must stay valid until the callback has been invoked.
+    /// @param [in] callback Invoked on a worker thread with the result of the inference.
+    virtual void EnqueueWorkloadAsync(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors,
+                                      AsyncExecutionCallback callback) = 0;
+
+    /// Creates an independent execution context for a loaded network. Each handle owns its own intermediate
+    /// tensor memory, so EnqueueWorkload-style inferences using different handles of the same network may run
+    /// concurrently from different threads while sharing the network's constant data.
+    /// @param [in] networkId The id of the network to create the execution context for.
+    /// @return A handle to pass to Execute(). It must not outlive the network.
+    virtual std::unique_ptr<IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId) = 0;
+
+    /// Evaluates the network the given working memory handle was created for, using input in inputTensors and
+    /// filling outputTensors. Calls with the same handle are serialised; calls with different handles are not.
+    /// Must not be mixed concurrently with EnqueueWorkload() on the same network.
+    virtual Status Execute(IWorkingMemHandle& workingMemHandle,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors) = 0;
+
+    /// Returns the counters of the working memory kept by networks between calls to EnqueueWorkload().
+    virtual WorkingMemoryResidencyStats GetWorkingMemoryResidencyStats() const = 0;
+
+    /// Returns the latency and throughput statistics of a network, which are always collected. An inference's latency
+    /// spans the EnqueueWorkload() or Execute() call running it, or for a pipelined network the time from
+    /// EnqueueWorkloadAsync() until its completion callback is invoked.
+    /// When external profiling is enabled, the percentiles are also published, in microseconds, as the
+    /// "Inference latency" counters of the ArmNN_Runtime category. These are shared by all networks and are
+    /// refreshed at most every 100ms by whichever network completes an inference.
+    virtual InferenceStatistics GetInferenceStatistics(NetworkId networkId) const = 0;
+
+    /// Returns the memory held by a network, which is always tracked.
+    /// When external profiling is enabled, the constant, working and peak working memory of all the loaded networks
+    /// are also published, in kilobytes, as the "Constant memory", "Working memory" and "Peak working memory"
+    /// counters of the ArmNN_Runtime category. A network refreshes its contribution when loaded and then along with
+    /// the latency counters, see GetInferenceStatistics().
+    virtual NetworkMemoryUsage GetMemoryUsage(NetworkId networkId) const = 0;
+
+    /// Makes concurrent EnqueueWorkload() and EnqueueWorkloadAsync() calls on a network taking a single sample
+    /// evaluate their samples together, as batches run on a copy of the network taking a larger batch. Each call
+    /// still returns once its own outputs are filled in, with the same results as if it had run on its own.
+    /// @param [in] networkId The network taking a batch of 1 the calls are made on.
+    /// @param [in] batchedNetworkId A loaded network only differing from networkId by the size of dimension 0 of
+    ///             its inputs and outputs. It must evaluate each sample of a batch independently of the others.
+    /// @return Failure if the networks are not compatible.
+    virtual Status EnableDynamicBatching(NetworkId networkId,
+                                         NetworkId batchedNetworkId,
+                                         const DynamicBatchingOptions& options = DynamicBatchingOptions()) = 0;
+
+    /// Makes calls on a network run on their own again. Batching also stops when either network is unloaded.
+    virtual Status DisableDynamicBatching(NetworkId networkId) = 0;
+
     /// Unloads a network from the IRuntime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -168,6 +410,21 @@ public:
     /// @param func callback function to pass to the debug layer.
     virtual void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func) = 0;
 
+    /// Replaces the weights, and the biases if given, of a layer of a loaded network in place, without optimizing
+    /// or loading the network again. The new tensors must match the shape, data type and quantization of the tensors
+    /// they replace as optimized. The update waits for the inferences in progress and each inference then uses either
+    /// the old or the new tensors, except a pipelined inference in flight whose remaining stages use the new ones.
+    /// Supported by the Convolution2d, DepthwiseConvolution2d, FullyConnected and TransposeConvolution2d layers
+    /// running on CpuRef. A network copy used for dynamic batching must be updated on its own.
+    /// @param networkId The id of the network to update.
+    /// @param layerName The name the layer was given when added to the network.
+    /// @return Status::Failure if the network has no layer with that name or its weights can't be updated.
+    ///         Throws InvalidArgumentException, without changing anything, if the new tensors don't match.
+    virtual Status UpdateLayerWeights(NetworkId networkId,
+                                      const std::string& layerName,
+                                      const ConstTensor& weights,
+                                      const Optional<ConstTensor>& biases) = 0;
+
 protected:
     ~IRuntime() {}
 };
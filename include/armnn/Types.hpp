@@ -26,7 +26,9 @@ constexpr unsigned int LOWEST_CAPTURE_PERIOD = 10000u;
 enum class Status
 {
     Success = 0,
-    Failure = 1
+    Failure = 1,
+    /// An inference was abandoned before completing, see CancellationOptions.
+    Cancelled = 2
 };
 
 enum class DataType
@@ -193,6 +195,12 @@ public:
 /// Type of identifiers for bindable layers (inputs, outputs).
 using LayerBindingId = int;
 
+/// Type of identifiers for networks loaded into an IRuntime.
+using NetworkId = int;
+
+/// Type of identifiers for sets of input and output tensors bound to a network with IRuntime::BindIOTensors().
+using IOBindingId = int;
+
 class PermutationVector
 {
 public:
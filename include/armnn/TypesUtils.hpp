@@ -20,6 +20,7 @@ constexpr char const* GetStatusAsCString(Status status)
     {
         case armnn::Status::Success: return "Status::Success";
         case armnn::Status::Failure: return "Status::Failure";
+        case armnn::Status::Cancelled: return "Status::Cancelled";
         default:                     return "Unknown";
     }
 }
@@ -145,6 +145,11 @@ public:
     /// IWorkloadFactory::CreateTensor()/IWorkloadFactory::CreateSubtensor() methods must be implemented.
     virtual void RegisterTensorHandleFactories(class TensorHandleFactoryRegistry& /*registry*/) {}
 
+    /// (Optional) Called when a runtime loads a network, before the backend creates the memory managers and workload
+    /// factories of the network, with the context the runtime created with CreateBackendContext(), so that they can
+    /// use the resources the context holds for that runtime. Not called if the runtime has no context for the backend.
+    virtual void SetBackendContext(IBackendContext& /*context*/) {}
+
     /// Returns the version of the Backend API
     static constexpr BackendVersion GetApiVersion() { return BackendVersion(1, 0); }
 };
@@ -4,6 +4,7 @@
 //
 #pragma once
 
+#include <cstddef>
 #include <memory>
 
 namespace armnn
@@ -18,6 +19,9 @@ public:
     virtual void Acquire() = 0;
     virtual void Release() = 0;
 
+    /// Returns the number of bytes of memory currently acquired, or 0 if the memory manager doesn't keep track of it.
+    virtual size_t GetAcquiredBytes() const { return 0; }
+
     virtual ~IMemoryManager() {}
 };
 
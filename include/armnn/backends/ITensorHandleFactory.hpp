@@ -20,6 +20,9 @@ namespace armnn
 enum class CapabilityClass
 {
     PaddingRequired = 1,
+    /// The layer can compute its output over the output of the connected layer, one of its inputs, once that
+    /// input is no longer needed by anything else, which is then given to it as a sub-tensor covering the whole input.
+    InPlaceComputation = 2,
 
     // add new enum values here
 
@@ -51,6 +54,16 @@ public:
                                                                  TensorShape const& subTensorShape,
                                                                  unsigned int const* subTensorOrigin) const = 0;
 
+    /// Creates a tensor handle using all the memory of the parent, viewed with the given TensorInfo of the same
+    /// size, for layers such as Reshape whose output holds the same bytes as their input. Such layers don't run a
+    /// workload then. Returns null if not supported.
+    virtual std::unique_ptr<ITensorHandle> CreateAliasTensorHandle(ITensorHandle& parent,
+                                                                   const TensorInfo& tensorInfo) const
+    {
+        IgnoreUnused(parent, tensorInfo);
+        return nullptr;
+    }
+
     virtual std::unique_ptr<ITensorHandle> CreateTensorHandle(const TensorInfo& tensorInfo) const = 0;
 
     virtual std::unique_ptr<ITensorHandle> CreateTensorHandle(const TensorInfo& tensorInfo,
@@ -4,11 +4,20 @@
 //
 #pragma once
 
+#include <armnn/backends/CpuTensorHandleFwd.hpp>
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/Optional.hpp>
+#include <armnn/Tensor.hpp>
 #include <armnn/Types.hpp>
 
+#include <functional>
+
 namespace armnn
 {
 
+struct WorkingMemDescriptor;
+
 /// Workload interface to enqueue a layer computation.
 class IWorkload {
 public:
@@ -18,9 +27,31 @@ public:
 
     virtual void Execute() const = 0;
 
+    /// Executes the workload against the tensor handles in the given descriptor rather than the ones it was
+    /// created with. Several descriptors may be executed concurrently on the same workload.
+    /// Workloads which don't override it can't be executed with IRuntime::Execute().
+    virtual void ExecuteAsync(WorkingMemDescriptor& /*workingMemDescriptor*/)
+    {
+        throw Exception("ExecuteAsync not supported");
+    }
+
     virtual profiling::ProfilingGuid GetGuid() const = 0;
 
     virtual void RegisterDebugCallback(const DebugCallbackFunction & /*func*/) {}
+
+    /// Overwrites the weights, and the biases if given, the workload was created with, for a layer whose weights
+    /// are replaced while loaded. Never called while the workload executes.
+    /// @return false if the workload doesn't support it.
+    virtual bool UpdateWeights(const ConstTensor& /*weights*/, const Optional<ConstTensor>& /*biases*/)
+    {
+        return false;
+    }
+
+    /// Calls shareTensor with each constant tensor the workload holds in CPU memory, e.g. its weights, which may
+    /// replace the memory of the tensor with identical memory held by other workloads. Called before the workload
+    /// first executes, and when it is created to count the memory of these tensors, which for workloads that don't
+    /// report any is counted as the constant tensors of their layer.
+    virtual void ShareConstantTensors(const std::function<void(ScopedCpuTensorHandle&)>& /*shareTensor*/) {}
 };
 
 } //namespace armnn
@@ -0,0 +1,104 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "ConstantTensorStore.hpp"
+
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <cstring>
+
+namespace armnn
+{
+
+void ConstantTensorStore::Share(ScopedCpuTensorHandle& handle)
+{
+    const std::shared_ptr<void>& memory = handle.GetSharedMemory();
+    if (!memory)
+    {
+        return;
+    }
+    const size_t numBytes = handle.GetTensorInfo().GetNumBytes();
+    const uint64_t hash = Hash(memory.get(), numBytes);
+
+    std::lock_guard<std::mutex> lock(m_Mutex);
+
+    auto range = m_Tensors.equal_range(hash);
+    for (auto it = range.first; it != range.second;)
+    {
+        std::shared_ptr<void> storedMemory = it->second.m_Memory.lock();
+        if (!storedMemory)
+        {
+            it = m_Tensors.erase(it);
+            continue;
+        }
+        if (storedMemory == memory)
+        {
+            return;
+        }
+        if (it->second.m_NumBytes == numBytes && std::memcmp(storedMemory.get(), memory.get(), numBytes) == 0)
+        {
+            handle.ShareMemory(std::move(storedMemory));
+            return;
+        }
+        ++it;
+    }
+
+    handle.ShareMemory(memory);
+    m_Tensors.emplace(hash, Tensor{ numBytes, memory });
+}
+
+void ConstantTensorStore::RemoveUnusedTensors()
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    for (auto it = m_Tensors.begin(); it != m_Tensors.end();)
+    {
+        it = it->second.m_Memory.expired() ? m_Tensors.erase(it) : std::next(it);
+    }
+}
+
+size_t ConstantTensorStore::GetNumTensors() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    size_t numTensors = 0;
+    for (auto&& tensor : m_Tensors)
+    {
+        numTensors += tensor.second.m_Memory.expired() ? 0 : 1;
+    }
+    return numTensors;
+}
+
+size_t ConstantTensorStore::GetNumBytes() const
+{
+    std::lock_guard<std::mutex> lock(m_Mutex);
+    size_t numBytes = 0;
+    for (auto&& tensor : m_Tensors)
+    {
+        numBytes += tensor.second.m_Memory.expired() ? 0 : tensor.second.m_NumBytes;
+    }
+    return numBytes;
+}
+
+uint64_t ConstantTensorStore::Hash(const void* data, size_t numBytes)
+{
+    constexpr uint64_t fnvOffsetBasis = 14695981039346656037ull;
+    constexpr uint64_t fnvPrime       = 1099511628211ull;
+
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    uint64_t hash = fnvOffsetBasis ^ numBytes;
+    size_t offset = 0;
+    for (; offset + sizeof(uint64_t) <= numBytes; offset += sizeof(uint64_t))
+    {
+        uint64_t word;
+        std::memcpy(&word, bytes + offset, sizeof(word));
+        hash = (hash ^ word) * fnvPrime;
+    }
+    for (; offset < numBytes; ++offset)
+    {
+        hash = (hash ^ bytes[offset]) * fnvPrime;
+    }
+    return hash;
+}
+
+} // namespace armnn
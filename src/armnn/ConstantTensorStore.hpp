@@ -0,0 +1,51 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/backends/CpuTensorHandleFwd.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+namespace armnn
+{
+
+/// Content-addressed store of the constant tensors of the networks loaded into a runtime, so that networks loaded
+/// several times (e.g. once per worker) keep a single read-only copy of each of their identical weights. The store
+/// doesn't own the memory: a tensor is kept while at least one handle uses it.
+class ConstantTensorStore
+{
+public:
+    /// Makes the handle use the memory of a tensor with the same contents given before and still in use, or
+    /// records its memory for the identical tensors given next. Either way, the memory of the handle is then
+    /// read-only. Handles without memory are left alone.
+    void Share(ScopedCpuTensorHandle& handle);
+
+    /// Forgets the tensors no handle uses anymore, e.g. after a network is unloaded.
+    void RemoveUnusedTensors();
+
+    /// Number of distinct tensors in use and bytes they hold.
+    size_t GetNumTensors() const;
+    size_t GetNumBytes() const;
+
+private:
+    struct Tensor
+    {
+        size_t m_NumBytes;
+        std::weak_ptr<void> m_Memory;
+    };
+
+    /// 64-bit FNV-1a hash of the contents, taken 8 bytes at a time. Matches are confirmed by comparing the contents.
+    static uint64_t Hash(const void* data, size_t numBytes);
+
+    mutable std::mutex m_Mutex;
+    std::unordered_multimap<uint64_t, Tensor> m_Tensors;
+};
+
+} // namespace armnn
@@ -0,0 +1,259 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "DynamicBatcher.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/format.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+
+namespace armnn
+{
+
+namespace
+{
+
+template <typename TensorType>
+const TensorType* FindTensor(const std::vector<std::pair<LayerBindingId, TensorType>>& tensors,
+                             LayerBindingId bindingId)
+{
+    auto it = std::find_if(tensors.begin(), tensors.end(),
+                           [bindingId](const std::pair<LayerBindingId, TensorType>& tensor)
+                           {
+                               return tensor.first == bindingId;
+                           });
+    return it != tensors.end() ? &it->second : nullptr;
+}
+
+const TensorInfo* FindInfo(const DynamicBatcher::BindingInfos& infos, LayerBindingId bindingId)
+{
+    auto it = std::find_if(infos.begin(), infos.end(),
+                           [bindingId](const std::pair<LayerBindingId, TensorInfo>& info)
+                           {
+                               return info.first == bindingId;
+                           });
+    return it != infos.end() ? &it->second : nullptr;
+}
+
+/// Checks that two sets of bindings only differ by their batch size and returns the batch size of the second one.
+unsigned int GetBatchSize(const DynamicBatcher::BindingInfos& infos,
+                          const DynamicBatcher::BindingInfos& batchedInfos,
+                          const char* bindingKind)
+{
+    if (infos.size() != batchedInfos.size() || batchedInfos.empty())
+    {
+        throw InvalidArgumentException(boost::str(
+            boost::format("DynamicBatcher: the networks don't have the same number of %1%s") % bindingKind));
+    }
+
+    unsigned int batchSize = 0;
+    for (auto&& batchedInfo : batchedInfos)
+    {
+        const TensorInfo* info = FindInfo(infos, batchedInfo.first);
+        const TensorShape& batchedShape = batchedInfo.second.GetShape();
+
+        bool compatible = info != nullptr &&
+                          batchedShape.GetNumDimensions() > 0 &&
+                          info->GetNumDimensions() == batchedShape.GetNumDimensions() &&
+                          info->GetShape()[0] == 1 &&
+                          info->GetDataType() == batchedInfo.second.GetDataType() &&
+                          info->GetQuantizationScales() == batchedInfo.second.GetQuantizationScales() &&
+                          info->GetQuantizationOffset() == batchedInfo.second.GetQuantizationOffset();
+        for (unsigned int i = 1; compatible && i < batchedShape.GetNumDimensions(); ++i)
+        {
+            compatible = info->GetShape()[i] == batchedShape[i];
+        }
+        if (compatible && batchSize != 0)
+        {
+            compatible = batchedShape[0] == batchSize;
+        }
+        if (!compatible)
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("DynamicBatcher: %1% %2% of the networks only differing by batch size, "
+                              "with a batch size of 1 for the single sample network, is expected")
+                % bindingKind % batchedInfo.first));
+        }
+        batchSize = batchedShape[0];
+    }
+    return batchSize;
+}
+
+} // anonymous namespace
+
+DynamicBatcher::DynamicBatcher(const BindingInfos& inputInfos,
+                               const BindingInfos& outputInfos,
+                               const BindingInfos& batchedInputInfos,
+                               const BindingInfos& batchedOutputInfos,
+                               unsigned int maxBatchSize,
+                               std::chrono::microseconds timeout,
+                               ExecuteFunction executeBatch)
+    : m_BatchedInputInfos(batchedInputInfos)
+    , m_BatchedOutputInfos(batchedOutputInfos)
+    , m_Timeout(timeout)
+    , m_ExecuteBatch(std::move(executeBatch))
+{
+    m_BatchSize = GetBatchSize(inputInfos, batchedInputInfos, "input");
+    if (GetBatchSize(outputInfos, batchedOutputInfos, "output") != m_BatchSize)
+    {
+        throw InvalidArgumentException("DynamicBatcher: the inputs and outputs of the batched network "
+                                       "don't have the same batch size");
+    }
+
+    m_MaxBatchSize = maxBatchSize == 0 ? m_BatchSize : std::min(maxBatchSize, m_BatchSize);
+}
+
+void DynamicBatcher::Validate(const InputTensors& inputTensors, const OutputTensors& outputTensors) const
+{
+    if (inputTensors.size() != m_BatchedInputInfos.size())
+    {
+        throw InvalidArgumentException("Number of inputs provided does not match network.");
+    }
+    if (outputTensors.size() != m_BatchedOutputInfos.size())
+    {
+        throw InvalidArgumentException("Number of outputs provided does not match network.");
+    }
+
+    for (auto&& batchedInputInfo : m_BatchedInputInfos)
+    {
+        const ConstTensor* inputTensor = FindTensor(inputTensors, batchedInputInfo.first);
+        if (inputTensor == nullptr ||
+            inputTensor->GetNumBytes() != batchedInputInfo.second.GetNumBytes() / m_BatchSize)
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("DynamicBatcher: missing or wrongly sized tensor for input %1%")
+                % batchedInputInfo.first));
+        }
+    }
+    for (auto&& batchedOutputInfo : m_BatchedOutputInfos)
+    {
+        const Tensor* outputTensor = FindTensor(outputTensors, batchedOutputInfo.first);
+        if (outputTensor == nullptr ||
+            outputTensor->GetNumBytes() != batchedOutputInfo.second.GetNumBytes() / m_BatchSize)
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("DynamicBatcher: missing or wrongly sized tensor for output %1%")
+                % batchedOutputInfo.first));
+        }
+    }
+}
+
+Status DynamicBatcher::Execute(const InputTensors& inputTensors, const OutputTensors& outputTensors)
+{
+    // An invalid sample is rejected on its own rather than failing the batch it would have joined.
+    Validate(inputTensors, outputTensors);
+
+    const auto deadline = std::chrono::steady_clock::now() + m_Timeout;
+
+    std::unique_lock<std::mutex> lock(m_Mutex);
+
+    const bool isFirstSample = !m_OpenBatch;
+    if (isFirstSample)
+    {
+        m_OpenBatch = std::make_shared<Batch>();
+    }
+    std::shared_ptr<Batch> batch = m_OpenBatch;
+    batch->m_Samples.push_back({ &inputTensors, &outputTensors });
+
+    if (batch->m_Samples.size() >= m_MaxBatchSize)
+    {
+        m_OpenBatch.reset();
+        m_BatchClosed.notify_all();
+    }
+
+    if (isFirstSample)
+    {
+        m_BatchClosed.wait_until(lock, deadline, [this, &batch]() { return m_OpenBatch != batch; });
+        if (m_OpenBatch == batch)
+        {
+            m_OpenBatch.reset();
+        }
+
+        // No sample can join the batch anymore, so it can be read without holding the lock.
+        lock.unlock();
+
+        Status status = Status::Failure;
+        std::exception_ptr error;
+        try
+        {
+            status = ExecuteBatch(*batch);
+        }
+        catch (...)
+        {
+            error = std::current_exception();
+        }
+
+        lock.lock();
+        batch->m_Status = status;
+        batch->m_Error = error;
+        batch->m_Completed = true;
+        m_BatchCompleted.notify_all();
+    }
+    else
+    {
+        m_BatchCompleted.wait(lock, [&batch]() { return batch->m_Completed; });
+    }
+
+    if (batch->m_Error)
+    {
+        std::rethrow_exception(batch->m_Error);
+    }
+    return batch->m_Status;
+}
+
+Status DynamicBatcher::ExecuteBatch(const Batch& batch)
+{
+    // The samples missing from an incomplete batch are left as zeros: as samples are evaluated independently,
+    // their content doesn't affect the results of the others.
+    std::vector<std::vector<uint8_t>> inputData(m_BatchedInputInfos.size());
+    InputTensors batchedInputTensors;
+    for (unsigned int i = 0; i < m_BatchedInputInfos.size(); ++i)
+    {
+        const LayerBindingId bindingId = m_BatchedInputInfos[i].first;
+        const TensorInfo& batchedInfo  = m_BatchedInputInfos[i].second;
+        const unsigned int sampleBytes = batchedInfo.GetNumBytes() / m_BatchSize;
+
+        inputData[i].resize(batchedInfo.GetNumBytes(), 0);
+        for (unsigned int sample = 0; sample < batch.m_Samples.size(); ++sample)
+        {
+            const ConstTensor* inputTensor = FindTensor(*batch.m_Samples[sample].m_InputTensors, bindingId);
+            std::memcpy(inputData[i].data() + sample * sampleBytes, inputTensor->GetMemoryArea(), sampleBytes);
+        }
+        batchedInputTensors.emplace_back(bindingId, ConstTensor(batchedInfo, inputData[i].data()));
+    }
+
+    std::vector<std::vector<uint8_t>> outputData(m_BatchedOutputInfos.size());
+    OutputTensors batchedOutputTensors;
+    for (unsigned int i = 0; i < m_BatchedOutputInfos.size(); ++i)
+    {
+        outputData[i].resize(m_BatchedOutputInfos[i].second.GetNumBytes());
+        batchedOutputTensors.emplace_back(m_BatchedOutputInfos[i].first,
+                                          Tensor(m_BatchedOutputInfos[i].second, outputData[i].data()));
+    }
+
+    const Status status = m_ExecuteBatch(batchedInputTensors, batchedOutputTensors);
+    if (status != Status::Success)
+    {
+        return status;
+    }
+
+    for (unsigned int i = 0; i < m_BatchedOutputInfos.size(); ++i)
+    {
+        const LayerBindingId bindingId = m_BatchedOutputInfos[i].first;
+        const unsigned int sampleBytes = m_BatchedOutputInfos[i].second.GetNumBytes() / m_BatchSize;
+        for (unsigned int sample = 0; sample < batch.m_Samples.size(); ++sample)
+        {
+            const Tensor* outputTensor = FindTensor(*batch.m_Samples[sample].m_OutputTensors, bindingId);
+            std::memcpy(outputTensor->GetMemoryArea(), outputData[i].data() + sample * sampleBytes, sampleBytes);
+        }
+    }
+    return status;
+}
+
+} // namespace armnn
@@ -0,0 +1,93 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/IRuntime.hpp>
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace armnn
+{
+
+/// Gathers concurrent single-sample inferences of a network into batches, which are evaluated at once by a copy of
+/// the network taking a larger batch. Each sample of a batch is a slice of the batched tensors along dimension 0 and
+/// the unused samples of incomplete batches are zero, so the batched network must evaluate samples independently.
+class DynamicBatcher
+{
+public:
+    using BindingInfos = std::vector<std::pair<LayerBindingId, TensorInfo>>;
+
+    /// Evaluates the batched network on tensors holding a full batch. Several batches may be evaluated at once.
+    using ExecuteFunction = std::function<Status(const InputTensors& inputTensors, const OutputTensors& outputTensors)>;
+
+    /// Throws InvalidArgumentException if the bindings of the networks don't only differ by their batch size,
+    /// which must be 1 for the single-sample network.
+    /// @param maxBatchSize Number of samples at which a batch is evaluated without waiting for the timeout.
+    ///                     0 or more than the batch size of the batched network means the batch size of the network.
+    /// @param timeout How long the first sample of a batch waits for the others before the batch is evaluated anyway.
+    DynamicBatcher(const BindingInfos& inputInfos,
+                   const BindingInfos& outputInfos,
+                   const BindingInfos& batchedInputInfos,
+                   const BindingInfos& batchedOutputInfos,
+                   unsigned int maxBatchSize,
+                   std::chrono::microseconds timeout,
+                   ExecuteFunction executeBatch);
+
+    /// Evaluates a single sample as part of a batch. The calling thread blocks until the batch has been evaluated:
+    /// the thread of the first sample of the batch evaluates it, the threads of the other samples wait for it.
+    /// Returns the status of the batched inference and rethrows the exception it threw, if any.
+    Status Execute(const InputTensors& inputTensors, const OutputTensors& outputTensors);
+
+    unsigned int GetMaxBatchSize() const { return m_MaxBatchSize; }
+
+private:
+    struct Sample
+    {
+        const InputTensors* m_InputTensors;
+        const OutputTensors* m_OutputTensors;
+    };
+
+    struct Batch
+    {
+        std::vector<Sample> m_Samples;
+        bool m_Completed = false;
+        Status m_Status = Status::Failure;
+        std::exception_ptr m_Error;
+    };
+
+    void Validate(const InputTensors& inputTensors, const OutputTensors& outputTensors) const;
+
+    /// Copies the samples into batched tensors, evaluates them and copies the results back to each sample.
+    Status ExecuteBatch(const Batch& batch);
+
+    const BindingInfos m_BatchedInputInfos;
+    const BindingInfos m_BatchedOutputInfos;
+
+    /// Batch size of the batched network, which is the number of samples the batched tensors hold.
+    unsigned int m_BatchSize;
+    unsigned int m_MaxBatchSize;
+
+    const std::chrono::microseconds m_Timeout;
+    const ExecuteFunction m_ExecuteBatch;
+
+    std::mutex m_Mutex;
+
+    /// Batch samples are added to, null until the next sample arrives once it is full or timed out.
+    std::shared_ptr<Batch> m_OpenBatch;
+    std::condition_variable m_BatchClosed;
+    std::condition_variable m_BatchCompleted;
+};
+
+} // namespace armnn
@@ -138,13 +138,14 @@ Status Graph::SerializeToDot(std::ostream& stream)
     return Status::Success;
 }
 
-Status Graph::AllocateDynamicBuffers()
+Status Graph::AllocateDynamicBuffers(bool reuseMemory)
 {
     // Layers must be sorted in topological order
     ARMNN_ASSERT(m_LayersInOrder);
 
     std::unordered_set<const ITensorHandle*> preallocatedTensors;
     std::unordered_map<const ITensorHandle*, unsigned int> handleReferenceCounts;
+    std::vector<ITensorHandle*> deferredAllocations;
 
     // Finds the first TensorHandle ancestor of a SubTensorHandle. If the ITensorHandle provided
     // is a TensorHandle, the function just returns it
@@ -164,6 +165,20 @@ Status Graph::AllocateDynamicBuffers()
         return tensorHandle && preallocatedTensors.find(tensorHandle) != preallocatedTensors.end();
     };
 
+    // Ending the lifetime of a tensor handle lets the tensors managed after it reuse its memory, so when memory
+    // must not be shared the lifetimes are only ended once every tensor handle has been managed
+    auto EndLifetime = [&](ITensorHandle* const tensorHandle)
+    {
+        if (reuseMemory)
+        {
+            tensorHandle->Allocate();
+        }
+        else
+        {
+            deferredAllocations.push_back(tensorHandle);
+        }
+    };
+
     // Constant tensor handles need to last from the beginning of execution till the end,
     // therefore we pre-allocate them upfront
     for (auto&& layer : m_Layers)
@@ -202,7 +217,7 @@ Status Graph::AllocateDynamicBuffers()
                     if (handleReferenceCounts[tensorHandle] == 0u)
                     {
                           // if nobody consumes this tensor we call Allocate()
-                          tensorHandle->Allocate();
+                          EndLifetime(tensorHandle);
                     }
                 }
                 else
@@ -226,13 +241,18 @@ Status Graph::AllocateDynamicBuffers()
                 if (handleReferenceCounts[tensorHandle] == 0u)
                 {
                     // Stop managing lifetime of tensor handle
-                    tensorHandle->Allocate();
+                    EndLifetime(tensorHandle);
                     handleReferenceCounts.erase(tensorHandle);
                 }
             }
         }
     }
 
+    for (ITensorHandle* deferredHandle : deferredAllocations)
+    {
+        deferredHandle->Allocate();
+    }
+
     return Status::Success;
 }
 
@@ -192,7 +192,9 @@ public:
     size_t GetNumLayers() const { return m_Layers.size(); }
 
     /// Allocates memory for all tensors under output tensor handers of each layer.
-    Status AllocateDynamicBuffers();
+    /// @param reuseMemory If true, tensors whose lifetimes don't overlap in topological order may share memory.
+    ///                    Pass false when layers may run in any order that respects the dependencies of the graph.
+    Status AllocateDynamicBuffers(bool reuseMemory = true);
 
     /// Modifies the graph in-place, removing edges connecting layers using different compute devices,
     /// and relinking them via an intermediary copy layers.
@@ -0,0 +1,893 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "GraphSerializer.hpp"
+
+#include "Graph.hpp"
+#include "LayersFwd.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/Version.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+#include <backendsCommon/CpuTensorHandle.hpp>
+
+#include <boost/format.hpp>
+#include <boost/numeric/conversion/cast.hpp>
+
+#include <array>
+#include <algorithm>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+namespace
+{
+
+constexpr char g_Magic[] = { 'A', 'R', 'M', 'N', 'N', 'G', 'R', 'F' };
+
+class StreamWriter
+{
+public:
+    static constexpr bool IsReading = false;
+
+    explicit StreamWriter(std::ostream& stream) : m_Stream(stream) {}
+
+    void Bytes(const void* data, size_t size)
+    {
+        m_Stream.write(static_cast<const char*>(data), boost::numeric_cast<std::streamsize>(size));
+    }
+
+    void CheckLength(uint64_t) const {}
+
+private:
+    std::ostream& m_Stream;
+};
+
+class StreamReader
+{
+public:
+    static constexpr bool IsReading = true;
+
+    explicit StreamReader(std::istream& stream)
+        : m_Stream(stream)
+        , m_Remaining(std::numeric_limits<uint64_t>::max())
+    {
+        // The lengths read from the stream are checked against what is left of it, when that is known, so that a
+        // corrupt length is reported as such rather than allocating whatever it says.
+        const std::istream::pos_type start = m_Stream.tellg();
+        if (start != std::istream::pos_type(-1) && m_Stream.seekg(0, std::ios::end))
+        {
+            const std::istream::pos_type end = m_Stream.tellg();
+            if (end != std::istream::pos_type(-1) && end >= start)
+            {
+                m_Remaining = static_cast<uint64_t>(end - start);
+            }
+        }
+        m_Stream.clear();
+        m_Stream.seekg(start);
+    }
+
+    void Bytes(void* data, size_t size)
+    {
+        CheckLength(size);
+        if (!m_Stream.read(static_cast<char*>(data), boost::numeric_cast<std::streamsize>(size)))
+        {
+            throw ParseException("GraphSerializer: unexpected end of stream");
+        }
+        m_Remaining -= size;
+    }
+
+    /// Throws if fewer than the given number of bytes are left in the stream. Every element of a string or vector
+    /// takes at least one byte, so their lengths are checked with it before anything is allocated for them.
+    void CheckLength(uint64_t size) const
+    {
+        if (size > m_Remaining)
+        {
+            throw ParseException("GraphSerializer: length exceeds the end of the stream");
+        }
+    }
+
+private:
+    std::istream& m_Stream;
+    uint64_t m_Remaining;
+};
+
+class Hasher
+{
+public:
+    static constexpr bool IsReading = false;
+
+    void Bytes(const void* data, size_t size)
+    {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+        for (size_t i = 0; i < size; ++i)
+        {
+            m_Hash = (m_Hash ^ bytes[i]) * 1099511628211ull;
+        }
+    }
+
+    void CheckLength(uint64_t) const {}
+
+    uint64_t GetHash() const { return m_Hash; }
+
+private:
+    uint64_t m_Hash = 14695981039346656037ull;
+};
+
+// The SerializeValue() overloads either write or read a value, depending on the archive, so that both directions
+// share the same description of the format. Values being written are taken by non-const reference for that reason.
+
+template <typename Archive, typename T>
+typename std::enable_if<std::is_arithmetic<T>::value || std::is_enum<T>::value>::type
+SerializeValue(Archive& archive, T& value)
+{
+    archive.Bytes(&value, sizeof(value));
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, std::string& value)
+{
+    uint64_t size = value.size();
+    SerializeValue(archive, size);
+    archive.CheckLength(size);
+    value.resize(boost::numeric_cast<size_t>(size));
+    archive.Bytes(&value[0], value.size());
+}
+
+template <typename Archive, typename T1, typename T2>
+void SerializeValue(Archive& archive, std::pair<T1, T2>& value)
+{
+    SerializeValue(archive, value.first);
+    SerializeValue(archive, value.second);
+}
+
+template <typename Archive, typename T>
+void SerializeValue(Archive& archive, std::vector<T>& values)
+{
+    uint64_t size = values.size();
+    SerializeValue(archive, size);
+    archive.CheckLength(size);
+    values.resize(boost::numeric_cast<size_t>(size));
+    for (auto& value : values)
+    {
+        SerializeValue(archive, value);
+    }
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, TensorShape& shape)
+{
+    Dimensionality dimensionality = shape.GetDimensionality();
+    SerializeValue(archive, dimensionality);
+    if (dimensionality != Dimensionality::Specified)
+    {
+        if (Archive::IsReading)
+        {
+            shape = TensorShape(dimensionality);
+        }
+        return;
+    }
+
+    unsigned int numDimensions = Archive::IsReading ? 0 : shape.GetNumDimensions();
+    SerializeValue(archive, numDimensions);
+    if (numDimensions > MaxNumOfTensorDimensions)
+    {
+        throw ParseException("GraphSerializer: invalid number of dimensions");
+    }
+
+    std::array<unsigned int, MaxNumOfTensorDimensions> sizes = {};
+    std::array<bool, MaxNumOfTensorDimensions> specificities = {};
+    for (unsigned int i = 0; i < numDimensions; ++i)
+    {
+        if (!Archive::IsReading)
+        {
+            specificities[i] = shape.GetDimensionSpecificity(i);
+            sizes[i] = specificities[i] ? shape[i] : 0;
+        }
+        SerializeValue(archive, specificities[i]);
+        SerializeValue(archive, sizes[i]);
+    }
+
+    if (Archive::IsReading)
+    {
+        shape = numDimensions == 0 ? TensorShape() : TensorShape(numDimensions, sizes.data(), specificities.data());
+    }
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, TensorInfo& info)
+{
+    TensorShape shape = info.GetShape();
+    DataType dataType = info.GetDataType();
+    std::vector<float> scales = info.GetQuantizationScales();
+    int32_t offset = info.GetQuantizationOffset();
+    bool hasQuantizationDim = info.GetQuantizationDim().has_value();
+    unsigned int quantizationDim = hasQuantizationDim ? info.GetQuantizationDim().value() : 0;
+
+    SerializeValue(archive, shape);
+    SerializeValue(archive, dataType);
+    SerializeValue(archive, scales);
+    SerializeValue(archive, offset);
+    SerializeValue(archive, hasQuantizationDim);
+    SerializeValue(archive, quantizationDim);
+
+    if (Archive::IsReading)
+    {
+        // Per-axis quantized tensors don't have an offset.
+        info = TensorInfo(shape, dataType);
+        info.SetQuantizationScales(scales);
+        if (hasQuantizationDim)
+        {
+            info.SetQuantizationDim(MakeOptional<unsigned int>(quantizationDim));
+        }
+        else
+        {
+            info.SetQuantizationOffset(offset);
+        }
+    }
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, PermutationVector& permutation)
+{
+    std::vector<unsigned int> dimMappings(permutation.begin(), permutation.begin() + permutation.GetSize());
+    SerializeValue(archive, dimMappings);
+    if (Archive::IsReading)
+    {
+        if (dimMappings.size() > MaxNumOfTensorDimensions)
+        {
+            throw ParseException("GraphSerializer: invalid permutation");
+        }
+        permutation = PermutationVector(dimMappings.data(), boost::numeric_cast<unsigned int>(dimMappings.size()));
+    }
+}
+
+template <typename Archive>
+void SerializeFields(Archive&)
+{}
+
+template <typename Archive, typename T, typename... Ts>
+void SerializeFields(Archive& archive, T& field, Ts&... fields)
+{
+    SerializeValue(archive, field);
+    SerializeFields(archive, fields...);
+}
+
+// The size of a struct whose members have the given types, in that order.
+template <typename... Ts>
+constexpr size_t StructSize()
+{
+    const size_t sizes[] = { sizeof(Ts)... };
+    const size_t alignments[] = { alignof(Ts)... };
+    size_t size = 0;
+    size_t alignment = 1;
+    for (size_t i = 0; i < sizeof...(Ts); ++i)
+    {
+        size = (size + alignments[i] - 1) / alignments[i] * alignments[i] + sizes[i];
+        alignment = std::max(alignment, alignments[i]);
+    }
+    return (size + alignment - 1) / alignment * alignment;
+}
+
+// Serializes the given members of a descriptor, which must be all of its members in declaration order, so that
+// adding a member to a descriptor without serializing it fails to compile rather than silently losing it.
+template <typename Archive, typename Descriptor, typename... Ts>
+void SerializeDescriptorFields(Archive& archive, const Descriptor&, Ts&... fields)
+{
+    static_assert(sizeof(Descriptor) == StructSize<Ts...>(),
+                  "The descriptor has members which SerializeValue() doesn't serialize");
+    SerializeFields(archive, fields...);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, ActivationDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Function, desc.m_A, desc.m_B);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, ArgMinMaxDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Function, desc.m_Axis);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, BatchNormalizationDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Eps, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, BatchToSpaceNdDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_BlockShape, desc.m_Crops, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, ComparisonDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Operation);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, Convolution2dDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_PadLeft, desc.m_PadRight, desc.m_PadTop, desc.m_PadBottom,
+                              desc.m_StrideX, desc.m_StrideY, desc.m_DilationX, desc.m_DilationY,
+                              desc.m_BiasEnabled, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, DepthwiseConvolution2dDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_PadLeft, desc.m_PadRight, desc.m_PadTop, desc.m_PadBottom,
+                              desc.m_StrideX, desc.m_StrideY, desc.m_DilationX, desc.m_DilationY,
+                              desc.m_BiasEnabled, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, DetectionPostProcessDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_MaxDetections, desc.m_MaxClassesPerDetection,
+                              desc.m_DetectionsPerClass, desc.m_NmsScoreThreshold, desc.m_NmsIouThreshold,
+                              desc.m_NumClasses, desc.m_UseRegularNms, desc.m_ScaleX, desc.m_ScaleY, desc.m_ScaleW,
+                              desc.m_ScaleH);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, ElementwiseUnaryDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Operation);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, FakeQuantizationDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Min, desc.m_Max);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, FillDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Value);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, FullyConnectedDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_BiasEnabled, desc.m_TransposeWeightMatrix);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, GatherDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Axis);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, InstanceNormalizationDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Gamma, desc.m_Beta, desc.m_Eps, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, L2NormalizationDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Eps, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, LstmDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_ActivationFunc, desc.m_ClippingThresCell, desc.m_ClippingThresProj,
+                              desc.m_CifgEnabled, desc.m_PeepholeEnabled, desc.m_ProjectionEnabled,
+                              desc.m_LayerNormEnabled);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, MeanDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Axis, desc.m_KeepDims);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, NormalizationDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_NormChannelType, desc.m_NormMethodType, desc.m_NormSize,
+                              desc.m_Alpha, desc.m_Beta, desc.m_K, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, OriginsDescriptor& desc)
+{
+    uint32_t numViews = desc.GetNumViews();
+    uint32_t numDimensions = desc.GetNumDimensions();
+    unsigned int concatAxis = desc.GetConcatAxis();
+    SerializeFields(archive, numViews, numDimensions, concatAxis);
+
+    if (Archive::IsReading)
+    {
+        desc = OriginsDescriptor(numViews, numDimensions);
+        desc.SetConcatAxis(concatAxis);
+    }
+    for (uint32_t view = 0; view < numViews; ++view)
+    {
+        for (uint32_t dim = 0; dim < numDimensions; ++dim)
+        {
+            uint32_t origin = Archive::IsReading ? 0 : desc.GetViewOrigin(view)[dim];
+            SerializeValue(archive, origin);
+            if (Archive::IsReading)
+            {
+                desc.SetViewOriginCoord(view, dim, origin);
+            }
+        }
+    }
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, PadDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_PadList, desc.m_PadValue);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, PermuteDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_DimMappings);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, Pooling2dDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_PoolType, desc.m_PadLeft, desc.m_PadRight, desc.m_PadTop,
+                              desc.m_PadBottom, desc.m_PoolWidth, desc.m_PoolHeight, desc.m_StrideX, desc.m_StrideY,
+                              desc.m_OutputShapeRounding, desc.m_PaddingMethod, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, PreCompiledDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_NumInputSlots, desc.m_NumOutputSlots);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, QLstmDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_CellClip, desc.m_ProjectionClip, desc.m_CifgEnabled,
+                              desc.m_PeepholeEnabled, desc.m_ProjectionEnabled, desc.m_LayerNormEnabled,
+                              desc.m_InputIntermediateScale, desc.m_ForgetIntermediateScale,
+                              desc.m_CellIntermediateScale, desc.m_OutputIntermediateScale,
+                              desc.m_HiddenStateZeroPoint, desc.m_HiddenStateScale);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, ReshapeDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_TargetShape);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, ResizeDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_TargetWidth, desc.m_TargetHeight, desc.m_Method, desc.m_DataLayout,
+                              desc.m_AlignCorners, desc.m_HalfPixelCenters);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, SliceDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Begin, desc.m_Size);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, SoftmaxDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Beta, desc.m_Axis);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, SpaceToBatchNdDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_BlockShape, desc.m_PadList, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, SpaceToDepthDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_BlockSize, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, StackDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Axis, desc.m_NumInputs, desc.m_InputShape);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, StandInDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_NumInputs, desc.m_NumOutputs);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, StridedSliceDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_Begin, desc.m_End, desc.m_Stride, desc.m_BeginMask, desc.m_EndMask,
+                              desc.m_ShrinkAxisMask, desc.m_EllipsisMask, desc.m_NewAxisMask, desc.m_DataLayout);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, TransposeConvolution2dDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_PadLeft, desc.m_PadRight, desc.m_PadTop, desc.m_PadBottom,
+                              desc.m_StrideX, desc.m_StrideY, desc.m_BiasEnabled, desc.m_DataLayout,
+                              desc.m_OutputShapeEnabled, desc.m_OutputShape);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, TransposeDescriptor& desc)
+{
+    SerializeDescriptorFields(archive, desc, desc.m_DimMappings);
+}
+
+template <typename Archive>
+void SerializeValue(Archive& archive, ViewsDescriptor& desc)
+{
+    uint32_t numViews = desc.GetNumViews();
+    uint32_t numDimensions = desc.GetNumDimensions();
+    SerializeFields(archive, numViews, numDimensions);
+
+    if (Archive::IsReading)
+    {
+        desc = ViewsDescriptor(numViews, numDimensions);
+    }
+    for (uint32_t view = 0; view < numViews; ++view)
+    {
+        for (uint32_t dim = 0; dim < numDimensions; ++dim)
+        {
+            uint32_t origin = Archive::IsReading ? 0 : desc.GetViewOrigin(view)[dim];
+            uint32_t size = Archive::IsReading ? 0 : desc.GetViewSizes(view)[dim];
+            SerializeFields(archive, origin, size);
+            if (Archive::IsReading)
+            {
+                desc.SetViewOriginCoord(view, dim, origin);
+                desc.SetViewSize(view, dim, size);
+            }
+        }
+    }
+}
+
+// What a layer holds besides its connections, constants and backend assignment depends on its base class:
+// the binding id of input and output layers, the descriptor of layers with parameters, nothing for the others.
+struct BindingIdTag {};
+struct DescriptorTag {};
+struct NoParametersTag {};
+
+template <typename T>
+struct VoidType
+{
+    using Type = void;
+};
+
+template <typename LayerT, typename = void>
+struct HasDescriptorType : std::false_type {};
+
+template <typename LayerT>
+struct HasDescriptorType<LayerT, typename VoidType<typename LayerT::DescriptorType>::Type> : std::true_type {};
+
+template <typename LayerT>
+using ParametersTag = typename std::conditional<
+    std::is_base_of<BindableLayer, LayerT>::value,
+    BindingIdTag,
+    typename std::conditional<HasDescriptorType<LayerT>::value, DescriptorTag, NoParametersTag>::type>::type;
+
+template <typename Archive, typename LayerT>
+void SerializeParameters(Archive& archive, const LayerT& layer, BindingIdTag)
+{
+    LayerBindingId bindingId = layer.GetBindingId();
+    SerializeValue(archive, bindingId);
+}
+
+template <typename Archive, typename LayerT>
+void SerializeParameters(Archive& archive, const LayerT& layer, DescriptorTag)
+{
+    typename LayerT::DescriptorType descriptor = layer.GetParameters();
+    SerializeValue(archive, descriptor);
+}
+
+template <typename Archive, typename LayerT>
+void SerializeParameters(Archive&, const LayerT&, NoParametersTag)
+{}
+
+template <typename LayerT>
+Layer* AddLayer(StreamReader& reader, Graph& graph, const std::string& name, BindingIdTag)
+{
+    LayerBindingId bindingId;
+    SerializeValue(reader, bindingId);
+    return graph.AddLayer<LayerT>(bindingId, name.c_str());
+}
+
+template <typename LayerT>
+Layer* AddLayer(StreamReader& reader, Graph& graph, const std::string& name, DescriptorTag)
+{
+    typename LayerT::DescriptorType descriptor;
+    SerializeValue(reader, descriptor);
+    return graph.AddLayer<LayerT>(descriptor, name.c_str());
+}
+
+template <typename LayerT>
+Layer* AddLayer(StreamReader&, Graph& graph, const std::string& name, NoParametersTag)
+{
+    return graph.AddLayer<LayerT>(name.c_str());
+}
+
+template <typename Archive>
+void SerializeParameters(Archive& archive, const Layer& layer)
+{
+    if (layer.GetType() == LayerType::PreCompiled)
+    {
+        // The pre-compiled object is specific to the backend and can't be written out.
+        throw InvalidArgumentException(boost::str(
+            boost::format("GraphSerializer: can't serialize pre-compiled layer %1%") % layer.GetNameStr()));
+    }
+
+    switch (layer.GetType())
+    {
+#define X(name) \
+        case LayerType::name: \
+            SerializeParameters(archive, *PolymorphicDowncast<const name##Layer*>(&layer), \
+                                ParametersTag<name##Layer>()); \
+            break;
+        LIST_OF_LAYER_TYPE
+#undef X
+        default:
+            throw InvalidArgumentException("GraphSerializer: unknown layer type");
+    }
+}
+
+Layer* AddLayer(StreamReader& reader, Graph& graph, LayerType type, const std::string& layerName)
+{
+    if (type == LayerType::PreCompiled)
+    {
+        throw ParseException("GraphSerializer: unexpected pre-compiled layer");
+    }
+
+    switch (type)
+    {
+#define X(name) \
+        case LayerType::name: \
+            return AddLayer<name##Layer>(reader, graph, layerName, ParametersTag<name##Layer>());
+        LIST_OF_LAYER_TYPE
+#undef X
+        default:
+            throw ParseException("GraphSerializer: unknown layer type");
+    }
+}
+
+template <typename Archive>
+void SerializeHeader(Archive& archive)
+{
+    std::array<char, sizeof(g_Magic)> magic;
+    std::memcpy(magic.data(), g_Magic, sizeof(g_Magic));
+    uint32_t formatVersion = GraphSerializer::s_FormatVersion;
+    std::string armnnVersion = ARMNN_VERSION;
+
+    archive.Bytes(magic.data(), magic.size());
+    SerializeFields(archive, formatVersion, armnnVersion);
+
+    if (Archive::IsReading &&
+        (std::memcmp(magic.data(), g_Magic, sizeof(g_Magic)) != 0 ||
+         formatVersion != GraphSerializer::s_FormatVersion ||
+         armnnVersion != ARMNN_VERSION))
+    {
+        throw ParseException(boost::str(
+            boost::format("GraphSerializer: the stream doesn't hold a graph in version %1% of the format "
+                          "written by Arm NN %2%") % GraphSerializer::s_FormatVersion % ARMNN_VERSION));
+    }
+}
+
+} // anonymous namespace
+
+constexpr uint32_t GraphSerializer::s_FormatVersion;
+
+template <typename Archive>
+void GraphSerializer::SerializeGraph(Archive& archive, const Graph& graph)
+{
+    SerializeHeader(archive);
+
+    uint32_t numLayers = boost::numeric_cast<uint32_t>(graph.GetNumLayers());
+    SerializeValue(archive, numLayers);
+
+    // Layers are written in topological order, followed by the connections between them once they all exist.
+    std::unordered_map<const Layer*, uint32_t> layerIndices;
+    for (auto&& layer : graph.TopologicalSort())
+    {
+        layerIndices.emplace(layer, boost::numeric_cast<uint32_t>(layerIndices.size()));
+
+        LayerType type = layer->GetType();
+        std::string name = layer->GetNameStr();
+        SerializeFields(archive, type, name);
+        SerializeParameters(archive, *layer);
+
+        std::string backendId = layer->GetBackendId().Get();
+        bool hasBackendHint = layer->GetBackendHint().has_value();
+        std::string backendHint = hasBackendHint ? layer->GetBackendHint().value().Get() : std::string();
+        ShapeInferenceMethod shapeInferenceMethod = layer->GetShapeInferenceMethod();
+        SerializeFields(archive, backendId, hasBackendHint, backendHint, shapeInferenceMethod);
+
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            const OutputSlot& outputSlot = layer->GetOutputSlot(i);
+            bool isTensorInfoSet = outputSlot.IsTensorInfoSet();
+            SerializeValue(archive, isTensorInfoSet);
+            if (isTensorInfoSet)
+            {
+                TensorInfo tensorInfo = outputSlot.GetTensorInfo();
+                SerializeValue(archive, tensorInfo);
+            }
+            ITensorHandleFactory::FactoryId factoryId = outputSlot.GetTensorHandleFactoryId();
+            SerializeValue(archive, factoryId);
+        }
+
+        Layer::ConstantTensors constants = const_cast<Layer*>(layer)->GetConstantTensorsByRef();
+        uint32_t numConstants = boost::numeric_cast<uint32_t>(constants.size());
+        SerializeValue(archive, numConstants);
+        for (auto&& constant : constants)
+        {
+            bool isPresent = constant.get() != nullptr;
+            SerializeValue(archive, isPresent);
+            if (isPresent)
+            {
+                TensorInfo tensorInfo = constant.get()->GetTensorInfo();
+                SerializeValue(archive, tensorInfo);
+                archive.Bytes(constant.get()->Map(true), tensorInfo.GetNumBytes());
+                constant.get()->Unmap();
+            }
+        }
+    }
+
+    for (auto&& layer : graph.TopologicalSort())
+    {
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            const OutputSlot& outputSlot = layer->GetOutputSlot(i);
+            uint32_t numConnections = outputSlot.GetNumConnections();
+            SerializeValue(archive, numConnections);
+            for (unsigned int connection = 0; connection < numConnections; ++connection)
+            {
+                const InputSlot* inputSlot = outputSlot.GetConnection(connection);
+                uint32_t consumerIndex = layerIndices.at(&inputSlot->GetOwningLayer());
+                uint32_t inputSlotIndex = inputSlot->GetSlotIndex();
+                EdgeStrategy edgeStrategy = outputSlot.GetEdgeStrategies()[connection];
+                SerializeFields(archive, consumerIndex, inputSlotIndex, edgeStrategy);
+            }
+        }
+    }
+}
+
+void GraphSerializer::Serialize(const Graph& graph, std::ostream& stream)
+{
+    StreamWriter writer(stream);
+    SerializeGraph(writer, graph);
+    if (!stream)
+    {
+        throw RuntimeException("GraphSerializer: failed to write to the stream");
+    }
+}
+
+std::unique_ptr<Graph> GraphSerializer::Deserialize(std::istream& stream)
+{
+    StreamReader reader(stream);
+    SerializeHeader(reader);
+
+    uint32_t numLayers;
+    SerializeValue(reader, numLayers);
+
+    auto graph = std::make_unique<Graph>();
+    std::vector<Layer*> layers;
+    for (uint32_t layerIndex = 0; layerIndex < numLayers; ++layerIndex)
+    {
+        LayerType type;
+        std::string name;
+        SerializeFields(reader, type, name);
+        Layer* layer = AddLayer(reader, *graph, type, name);
+        layers.push_back(layer);
+
+        std::string backendId;
+        bool hasBackendHint;
+        std::string backendHint;
+        ShapeInferenceMethod shapeInferenceMethod;
+        SerializeFields(reader, backendId, hasBackendHint, backendHint, shapeInferenceMethod);
+        layer->SetBackendId(backendId);
+        if (hasBackendHint)
+        {
+            layer->BackendSelectionHint(Optional<BackendId>(backendHint));
+        }
+        layer->SetShapeInferenceMethod(shapeInferenceMethod);
+
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            OutputSlot& outputSlot = layer->GetOutputSlot(i);
+            bool isTensorInfoSet;
+            SerializeValue(reader, isTensorInfoSet);
+            if (isTensorInfoSet)
+            {
+                TensorInfo tensorInfo;
+                SerializeValue(reader, tensorInfo);
+                outputSlot.SetTensorInfo(tensorInfo);
+            }
+            ITensorHandleFactory::FactoryId factoryId;
+            SerializeValue(reader, factoryId);
+            outputSlot.SetTensorHandleFactory(factoryId);
+        }
+
+        Layer::ConstantTensors constants = layer->GetConstantTensorsByRef();
+        uint32_t numConstants;
+        SerializeValue(reader, numConstants);
+        if (numConstants != constants.size())
+        {
+            throw ParseException(boost::str(
+                boost::format("GraphSerializer: unexpected number of constants for layer %1%") % name));
+        }
+        for (auto&& constant : constants)
+        {
+            bool isPresent;
+            SerializeValue(reader, isPresent);
+            if (isPresent)
+            {
+                TensorInfo tensorInfo;
+                SerializeValue(reader, tensorInfo);
+                reader.CheckLength(tensorInfo.GetNumBytes());
+                std::vector<uint8_t> data(tensorInfo.GetNumBytes());
+                reader.Bytes(data.data(), data.size());
+                constant.get() = std::make_unique<ScopedCpuTensorHandle>(ConstTensor(tensorInfo, data.data()));
+            }
+        }
+    }
+
+    for (Layer* layer : layers)
+    {
+        for (unsigned int i = 0; i < layer->GetNumOutputSlots(); ++i)
+        {
+            OutputSlot& outputSlot = layer->GetOutputSlot(i);
+            uint32_t numConnections;
+            SerializeValue(reader, numConnections);
+            for (unsigned int connection = 0; connection < numConnections; ++connection)
+            {
+                uint32_t consumerIndex;
+                uint32_t inputSlotIndex;
+                EdgeStrategy edgeStrategy;
+                SerializeFields(reader, consumerIndex, inputSlotIndex, edgeStrategy);
+                if (consumerIndex >= layers.size() ||
+                    inputSlotIndex >= layers[consumerIndex]->GetNumInputSlots() ||
+                    layers[consumerIndex]->GetInputSlot(inputSlotIndex).GetConnection() != nullptr)
+                {
+                    throw ParseException(boost::str(
+                        boost::format("GraphSerializer: invalid connection from layer %1%") % layer->GetNameStr()));
+                }
+                outputSlot.Connect(layers[consumerIndex]->GetInputSlot(inputSlotIndex));
+                outputSlot.SetEdgeStrategy(connection, edgeStrategy);
+            }
+        }
+    }
+
+    return graph;
+}
+
+uint64_t GraphSerializer::Hash(const Graph& graph, const std::string& context)
+{
+    Hasher hasher;
+    SerializeGraph(hasher, graph);
+    std::string contextValue = context;
+    SerializeValue(hasher, contextValue);
+    return hasher.GetHash();
+}
+
+} // namespace armnn
@@ -0,0 +1,45 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstdint>
+#include <istream>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace armnn
+{
+
+class Graph;
+
+/// Writes graphs to a binary format and reads them back, including everything the optimizer decides: the backend
+/// each layer is assigned to, the tensor handle factories and edge strategies chosen between them, and constants as
+/// converted by the optimizations. A graph read back can be loaded into the runtime without being optimized again.
+/// The format uses the native byte order, so it is only meant to be read back on the platform which wrote it.
+class GraphSerializer
+{
+public:
+    /// Version of the format, to be incremented whenever it changes so that files written before are rejected.
+    static constexpr uint32_t s_FormatVersion = 1;
+
+    /// Throws InvalidArgumentException if the graph contains a layer which can't be serialized (e.g. PreCompiled).
+    static void Serialize(const Graph& graph, std::ostream& stream);
+
+    /// Throws ParseException if the stream doesn't hold a graph written by the same format and Arm NN versions.
+    static std::unique_ptr<Graph> Deserialize(std::istream& stream);
+
+    /// Returns a 64-bit FNV-1a hash of what Serialize() would write for the graph, without writing it anywhere,
+    /// followed by the given context (e.g. the options the graph is about to be optimized with).
+    static uint64_t Hash(const Graph& graph, const std::string& context);
+
+private:
+    /// Writes the graph to an archive, which either writes it to a stream or hashes it.
+    template <typename Archive>
+    static void SerializeGraph(Archive& archive, const Graph& graph);
+};
+
+} // namespace armnn
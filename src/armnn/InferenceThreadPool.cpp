@@ -0,0 +1,89 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "InferenceThreadPool.hpp"
+
+#include <armnn/Logging.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+InferenceThreadPool::InferenceThreadPool(unsigned int numThreads, unsigned int queueDepth)
+    : m_QueueDepth(queueDepth)
+    , m_Terminate(false)
+{
+    numThreads = std::max(numThreads, 1u);
+    m_Threads.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        m_Threads.emplace_back(&InferenceThreadPool::ProcessTasks, this);
+    }
+}
+
+InferenceThreadPool::~InferenceThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_Terminate = true;
+    }
+    m_TaskAvailable.notify_all();
+    m_SpaceAvailable.notify_all();
+
+    for (auto& thread : m_Threads)
+    {
+        thread.join();
+    }
+}
+
+void InferenceThreadPool::Schedule(Task task)
+{
+    {
+        std::unique_lock<std::mutex> lock(m_Mutex);
+        m_SpaceAvailable.wait(lock, [this]
+        {
+            return m_Terminate || m_QueueDepth == 0 || m_Tasks.size() < m_QueueDepth;
+        });
+        m_Tasks.push_back(std::move(task));
+    }
+    m_TaskAvailable.notify_one();
+}
+
+void InferenceThreadPool::ProcessTasks()
+{
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_TaskAvailable.wait(lock, [this] { return m_Terminate || !m_Tasks.empty(); });
+
+            // Tasks queued before termination are still run so that nobody waits forever on their results.
+            if (m_Tasks.empty())
+            {
+                return;
+            }
+            task = std::move(m_Tasks.front());
+            m_Tasks.pop_front();
+        }
+        m_SpaceAvailable.notify_one();
+
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            ARMNN_LOG(error) << "InferenceThreadPool: unhandled exception in task: " << e.what();
+        }
+        catch (...)
+        {
+            ARMNN_LOG(error) << "InferenceThreadPool: unhandled unknown exception in task";
+        }
+    }
+}
+
+} // namespace armnn
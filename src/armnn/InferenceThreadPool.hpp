@@ -0,0 +1,53 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+/// Fixed size pool of worker threads fed from a bounded FIFO queue of tasks.
+class InferenceThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    /// @param numThreads Number of worker threads. At least one thread is always created.
+    /// @param queueDepth Maximum number of tasks waiting for a worker. Zero means unbounded.
+    InferenceThreadPool(unsigned int numThreads, unsigned int queueDepth);
+
+    /// Runs the tasks which are still queued, then joins the workers.
+    ~InferenceThreadPool();
+
+    InferenceThreadPool(const InferenceThreadPool&) = delete;
+    InferenceThreadPool& operator=(const InferenceThreadPool&) = delete;
+
+    /// Queues a task. Blocks the caller while the queue is full.
+    void Schedule(Task task);
+
+    unsigned int GetNumThreads() const { return static_cast<unsigned int>(m_Threads.size()); }
+
+private:
+    void ProcessTasks();
+
+    const unsigned int m_QueueDepth;
+
+    std::vector<std::thread> m_Threads;
+    std::deque<Task> m_Tasks;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_TaskAvailable;
+    std::condition_variable m_SpaceAvailable;
+    bool m_Terminate;
+};
+
+} // namespace armnn
@@ -0,0 +1,102 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "LatencyHistogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace armnn
+{
+
+constexpr uint64_t LatencyHistogram::s_NumSubBuckets;
+constexpr unsigned int LatencyHistogram::s_NumBuckets;
+
+LatencyHistogram::LatencyHistogram()
+    : m_Count(0)
+    , m_Sum(0)
+    , m_Max(0)
+{
+    for (auto&& bucket : m_Buckets)
+    {
+        bucket.store(0, std::memory_order_relaxed);
+    }
+}
+
+unsigned int LatencyHistogram::GetBucketIndex(uint64_t value)
+{
+    // Above s_NumSubBuckets, the value is shifted right until it lies in [s_NumSubBuckets / 2, s_NumSubBuckets),
+    // which selects one of the sub-buckets of the power of two given by the shift.
+    unsigned int shift = 0;
+    while ((value >> shift) >= s_NumSubBuckets)
+    {
+        ++shift;
+    }
+    return static_cast<unsigned int>(shift * (s_NumSubBuckets / 2) + (value >> shift));
+}
+
+uint64_t LatencyHistogram::GetBucketUpperBound(unsigned int bucketIndex)
+{
+    if (bucketIndex < s_NumSubBuckets)
+    {
+        return bucketIndex;
+    }
+    const uint64_t shift = bucketIndex / (s_NumSubBuckets / 2) - 1;
+    const uint64_t subBucket = bucketIndex - shift * (s_NumSubBuckets / 2);
+    return ((subBucket + 1) << shift) - 1;
+}
+
+void LatencyHistogram::Record(std::chrono::nanoseconds latency)
+{
+    const uint64_t value = static_cast<uint64_t>(std::max<std::chrono::nanoseconds::rep>(latency.count(), 0));
+
+    m_Buckets[GetBucketIndex(value)].fetch_add(1, std::memory_order_relaxed);
+    m_Count.fetch_add(1, std::memory_order_relaxed);
+    m_Sum.fetch_add(value, std::memory_order_relaxed);
+
+    uint64_t max = m_Max.load(std::memory_order_relaxed);
+    while (value > max && !m_Max.compare_exchange_weak(max, value, std::memory_order_relaxed))
+    {}
+}
+
+std::chrono::nanoseconds LatencyHistogram::GetMean() const
+{
+    const uint64_t count = GetCount();
+    return std::chrono::nanoseconds(count > 0 ? m_Sum.load(std::memory_order_relaxed) / count : 0);
+}
+
+std::vector<std::chrono::nanoseconds> LatencyHistogram::GetPercentiles(const std::vector<double>& percentiles) const
+{
+    // Works on a copy of the buckets, so that concurrent recordings can't make the percentiles inconsistent.
+    std::vector<uint64_t> cumulativeCounts(s_NumBuckets);
+    uint64_t total = 0;
+    for (unsigned int i = 0; i < s_NumBuckets; ++i)
+    {
+        total += m_Buckets[i].load(std::memory_order_relaxed);
+        cumulativeCounts[i] = total;
+    }
+    const uint64_t max = m_Max.load(std::memory_order_relaxed);
+
+    std::vector<std::chrono::nanoseconds> results;
+    for (double percentile : percentiles)
+    {
+        if (total == 0)
+        {
+            results.emplace_back(0);
+            continue;
+        }
+
+        const double clamped = std::min(std::max(percentile, 0.0), 100.0);
+        const uint64_t rank = std::max<uint64_t>(
+            static_cast<uint64_t>(std::ceil(clamped / 100.0 * static_cast<double>(total))), 1);
+        const auto bucket = std::lower_bound(cumulativeCounts.begin(), cumulativeCounts.end() - 1, rank);
+        const uint64_t upperBound = GetBucketUpperBound(
+            static_cast<unsigned int>(std::distance(cumulativeCounts.begin(), bucket)));
+        results.emplace_back(static_cast<std::chrono::nanoseconds::rep>(std::min(upperBound, max)));
+    }
+    return results;
+}
+
+} // namespace armnn
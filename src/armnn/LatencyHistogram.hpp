@@ -0,0 +1,52 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+namespace armnn
+{
+
+/// Histogram of durations which can be recorded from any number of threads without locking. In the manner of
+/// HDR histograms, buckets are one nanosecond wide up to s_NumSubBuckets nanoseconds and then double in width
+/// at every power of two, so that any duration, and hence any percentile, is known to within 1/32 of its value
+/// using a fixed amount of memory.
+class LatencyHistogram
+{
+public:
+    LatencyHistogram();
+
+    void Record(std::chrono::nanoseconds latency);
+
+    uint64_t GetCount() const { return m_Count.load(std::memory_order_relaxed); }
+    std::chrono::nanoseconds GetMean() const;
+    std::chrono::nanoseconds GetMax() const { return std::chrono::nanoseconds(m_Max.load(std::memory_order_relaxed)); }
+
+    /// Returns the given percentiles, each in [0, 100], of the durations recorded so far, computed from a single
+    /// pass over the buckets. A percentile is reported as the upper bound of the bucket holding it, capped by the
+    /// longest duration recorded. All of them are zero if nothing has been recorded.
+    std::vector<std::chrono::nanoseconds> GetPercentiles(const std::vector<double>& percentiles) const;
+
+private:
+    /// Durations below s_NumSubBuckets nanoseconds get a bucket each, then each of the 58 remaining powers of two
+    /// a 64-bit duration can reach is split into s_NumSubBuckets / 2 buckets.
+    static constexpr uint64_t s_NumSubBuckets = 64;
+    static constexpr unsigned int s_NumBuckets = s_NumSubBuckets + 58 * s_NumSubBuckets / 2;
+
+    static unsigned int GetBucketIndex(uint64_t value);
+    static uint64_t GetBucketUpperBound(unsigned int bucketIndex);
+
+    std::array<std::atomic<uint64_t>, s_NumBuckets> m_Buckets;
+    std::atomic<uint64_t> m_Count;
+    std::atomic<uint64_t> m_Sum;
+    std::atomic<uint64_t> m_Max;
+};
+
+} // namespace armnn
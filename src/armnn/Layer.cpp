@@ -12,6 +12,7 @@
 #include <boost/cast.hpp>
 #include <boost/format.hpp>
 
+#include <algorithm>
 #include <numeric>
 
 namespace armnn
@@ -262,9 +263,96 @@ void Layer::CreateTensorHandles(const TensorHandleFactoryRegistry& registry,
         {
             ITensorHandleFactory* handleFactory = registry.GetFactory(factoryId);
             ARMNN_ASSERT(handleFactory);
-            handler.CreateTensorHandles(*handleFactory, IsMemoryManaged);
+
+            // Tensors which aren't memory managed are imported or exported, so must keep their own memory.
+            std::unique_ptr<ITensorHandle> sharedHandle;
+            if (IsMemoryManaged && GetNumOutputSlots() == 1)
+            {
+                sharedHandle = IsOutputViewOfInput() ? CreateAliasTensorHandle(*handleFactory)
+                                                     : CreateInPlaceTensorHandle(*handleFactory);
+            }
+
+            if (sharedHandle)
+            {
+                handler.SetData(std::move(sharedHandle));
+            }
+            else
+            {
+                handler.CreateTensorHandles(*handleFactory, IsMemoryManaged);
+            }
+        }
+    }
+}
+
+std::unique_ptr<ITensorHandle> Layer::CreateInPlaceTensorHandle(ITensorHandleFactory& factory) const
+{
+    const OutputSlot& outputSlot = GetOutputSlot(0);
+    const TensorInfo& outputInfo = outputSlot.GetTensorInfo();
+
+    for (auto&& inputSlot : GetInputSlots())
+    {
+        const OutputSlot* source = inputSlot.GetConnectedOutputSlot();
+        const Layer& sourceLayer = source->GetOwningLayer();
+        ITensorHandle* sourceHandle = source->GetOutputHandler().GetData();
+
+        // The data of network inputs and constants must be kept for the next inferences, and the input mustn't
+        // be read by anything after this layer. The outputs of a Splitter, and of layers whose output is a view of
+        // their input, may share the memory of a network input or of a tensor read by other layers.
+        if (sourceHandle == nullptr ||
+            sourceLayer.GetType() == LayerType::Input ||
+            sourceLayer.GetType() == LayerType::Constant ||
+            sourceLayer.GetType() == LayerType::Splitter ||
+            sourceLayer.IsOutputViewOfInput() ||
+            source->GetNumConnections() != 1 ||
+            source->GetTensorHandleFactoryId() != outputSlot.GetTensorHandleFactoryId() ||
+            source->GetTensorInfo() != outputInfo)
+        {
+            continue;
         }
+
+        std::vector<Capability> capabilities =
+            factory.GetCapabilities(this, &sourceLayer, CapabilityClass::InPlaceComputation);
+        if (std::any_of(capabilities.begin(), capabilities.end(),
+                        [](const Capability& capability) { return capability.m_Value; }))
+        {
+            std::vector<unsigned int> origin(outputInfo.GetNumDimensions(), 0);
+            std::unique_ptr<ITensorHandle> handle =
+                factory.CreateSubTensorHandle(*sourceHandle, outputInfo.GetShape(), origin.data());
+            if (handle)
+            {
+                return handle;
+            }
+        }
+    }
+    return nullptr;
+}
+
+std::unique_ptr<ITensorHandle> Layer::CreateAliasTensorHandle(ITensorHandleFactory& factory) const
+{
+    const OutputSlot& outputSlot = GetOutputSlot(0);
+    const OutputSlot* source = GetInputSlot(0).GetConnectedOutputSlot();
+    ITensorHandle* sourceHandle = source->GetOutputHandler().GetData();
+    if (sourceHandle == nullptr ||
+        source->GetTensorHandleFactoryId() != outputSlot.GetTensorHandleFactoryId() ||
+        !source->GetTensorInfo().IsTypeSpaceMatch(outputSlot.GetTensorInfo()) ||
+        source->GetTensorInfo().GetNumBytes() != outputSlot.GetTensorInfo().GetNumBytes())
+    {
+        return nullptr;
+    }
+    return factory.CreateAliasTensorHandle(*sourceHandle, outputSlot.GetTensorInfo());
+}
+
+bool Layer::IsAliasingInput() const
+{
+    // The output handle may have been replaced after being made an alias, e.g. by a sub-tensor of a Concat output.
+    if (!IsOutputViewOfInput())
+    {
+        return false;
     }
+    const ITensorHandle* outputHandle = GetOutputHandler(0).GetData();
+    return outputHandle != nullptr &&
+           outputHandle->GetParent() != nullptr &&
+           outputHandle->GetParent() == GetInputSlot(0).GetConnectedOutputSlot()->GetOutputHandler().GetData();
 }
 
 void Layer::ReleaseConstantData()
@@ -273,6 +273,14 @@ public:
                                      const IWorkloadFactory& factory,
                                      const bool IsMemoryManaged = true);
 
+    /// Whether the single output of the layer holds the same bytes as its single input, only with a different
+    /// TensorInfo, so that CreateTensorHandles() can make it an alias of the input.
+    virtual bool IsOutputViewOfInput() const { return false; }
+
+    /// Whether the output tensor handle is an alias of the input one, in which case the layer has nothing to
+    /// compute and gets no workload.
+    bool IsAliasingInput() const;
+
     /// Creates a dynamically-allocated copy of this layer.
     /// @param graph - The Graph into which this Layer is being cloned.
     virtual Layer* Clone(Graph& graph) const = 0;
@@ -337,6 +345,8 @@ public:
 protected:
     // Graph needs access to the virtual destructor.
     friend class Graph;
+    // GraphSerializer needs access to the constant tensors.
+    friend class GraphSerializer;
     virtual ~Layer() = default;
 
     template <typename QueueDescriptor>
@@ -382,6 +392,15 @@ private:
     void CollectWorkloadInputs(WorkloadDataCollector& dataCollector) const;
     void CollectWorkloadOutputs(WorkloadDataCollector& dataCollector) const;
 
+    /// Returns a sub-tensor covering the whole of one of the inputs of the layer, for its single output to be
+    /// computed over it, if the factory reports the InPlaceComputation capability for the layer and the input is
+    /// identical to the output and needed by nothing else. Returns null otherwise.
+    std::unique_ptr<ITensorHandle> CreateInPlaceTensorHandle(ITensorHandleFactory& factory) const;
+
+    /// Returns an alias of the input tensor handle with the TensorInfo of the output, for layers whose output is a
+    /// view of their input, or null if the factory doesn't support it.
+    std::unique_ptr<ITensorHandle> CreateAliasTensorHandle(ITensorHandleFactory& factory) const;
+
 protected:
     std::vector<OutputHandler> m_OutputHandlers;
     ShapeInferenceMethod m_ShapeInferenceMethod;
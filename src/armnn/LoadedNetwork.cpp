@@ -15,6 +15,7 @@
 #include <armnn/BackendRegistry.hpp>
 #include <armnn/Logging.hpp>
 #include <armnn/utility/Assert.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
 
 #include <backendsCommon/CpuTensorHandle.hpp>
 #include <armnn/backends/IMemoryManager.hpp>
@@ -25,6 +26,18 @@
 
 #include <boost/format.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <limits>
+#include <numeric>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_set>
+
 namespace armnn
 {
 
@@ -42,6 +55,51 @@ std::string ToErrorMessage(const char * prefix, const ExceptionType & error)
     return ss.str();
 }
 
+/// Rough cost of the workload of a layer: the number of tensor elements it reads and writes.
+uint64_t EstimateWorkloadCost(const Layer& layer)
+{
+    uint64_t numElements = 1;
+    for (auto&& inputSlot : layer.GetInputSlots())
+    {
+        numElements += inputSlot.GetConnection()->GetTensorInfo().GetNumElements();
+    }
+    for (auto&& outputSlot : layer.GetOutputSlots())
+    {
+        numElements += outputSlot.GetTensorInfo().GetNumElements();
+    }
+    return numElements;
+}
+
+/// Thrown between two workloads to abandon an inference, see CancellationOptions.
+struct InferenceCancelled {};
+
+/// How often the inference latency counters of the profiling service are refreshed at most.
+constexpr std::chrono::nanoseconds g_LatencyCounterPeriod = std::chrono::milliseconds(100);
+
+/// Latency counters are in microseconds, saturated to the range of a counter value.
+uint32_t ToCounterValue(std::chrono::nanoseconds latency)
+{
+    const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    return static_cast<uint32_t>(std::min<int64_t>(microseconds, std::numeric_limits<uint32_t>::max()));
+}
+
+/// Memory counters are in kilobytes, rounded up and saturated to the range of a counter value.
+uint32_t ToKilobytesCounterValue(size_t numBytes)
+{
+    const uint64_t kilobytes = (static_cast<uint64_t>(numBytes) + 1023) / 1024;
+    return static_cast<uint32_t>(std::min<uint64_t>(kilobytes, std::numeric_limits<uint32_t>::max()));
+}
+
+/// Serialises the updates of the memory counters, which add up the contributions of all the networks.
+std::mutex g_MemoryCountersMutex;
+
+/// Whether the memory of the tensors bound with the given source holds a file descriptor rather than their data,
+/// in which case they can only be imported or exported, never copied.
+bool HoldsFileDescriptor(MemorySource source)
+{
+    return source == MemorySource::DmaBuf || source == MemorySource::DmaBufProtected;
+}
+
 void AddLayerStructure(std::unique_ptr<TimelineUtilityMethods>& timelineUtils,
                        const Layer& layer,
                        ProfilingGuid networkGuid)
@@ -81,9 +139,90 @@ void AddWorkloadStructure(std::unique_ptr<TimelineUtilityMethods>& timelineUtils
 
 } // anonymous
 
+/// An inference in flight on the pipeline, handed over from stage to stage.
+struct LoadedNetwork::PipelineFrame
+{
+    InputTensors m_InputTensors;
+    OutputTensors m_OutputTensors;
+    PipelineCallback m_OnCompleted;
+    std::chrono::steady_clock::time_point m_StartTime;
+
+    /// Intermediate tensors of the inference, returned to the pipeline once it has completed.
+    std::unique_ptr<IWorkingMemHandle> m_WorkingMemHandle;
+
+    Status m_Status = Status::Success;
+    std::exception_ptr m_Error;
+};
+
+struct LoadedNetwork::Pipeline
+{
+    struct Stage
+    {
+        /// Range of m_WorkloadQueue the stage runs.
+        unsigned int m_FirstWorkload = 0;
+        unsigned int m_EndWorkload = 0;
+
+        std::deque<std::unique_ptr<PipelineFrame>> m_Frames;
+        std::condition_variable m_FrameAvailable;
+        /// Set once no more frames can reach the stage, the thread exits when it has processed all of them.
+        bool m_Closed = false;
+        std::thread m_Thread;
+    };
+
+    std::vector<std::unique_ptr<Stage>> m_Stages;
+
+    /// Protects the frame queues of the stages and the buffers.
+    std::mutex m_Mutex;
+
+    /// Working memory handles not used by any inference. At most one per stage is ever created, which is
+    /// enough for every stage to work on a different inference, as it's double buffering with two stages.
+    std::vector<std::unique_ptr<IWorkingMemHandle>> m_IdleBuffers;
+    unsigned int m_NumBuffers = 0;
+    std::condition_variable m_BufferAvailable;
+
+    /// Inferences between their first and last stage, which all run with the same weights, and calls of
+    /// UpdateLayerWeights() waiting for them to complete, during which no inference starts its first stage.
+    unsigned int m_NumFramesUsingWeights = 0;
+    unsigned int m_NumPendingWeightUpdates = 0;
+    std::condition_variable m_WeightsUsageChanged;
+};
+
+/// Waits for the inferences of a pipeline to complete and keeps new ones from starting while it exists.
+/// Does nothing if the pipeline is null.
+class LoadedNetwork::PipelineWeightsUpdate
+{
+public:
+    explicit PipelineWeightsUpdate(Pipeline* pipeline)
+        : m_Pipeline(pipeline)
+    {
+        if (m_Pipeline)
+        {
+            std::unique_lock<std::mutex> lock(m_Pipeline->m_Mutex);
+            ++m_Pipeline->m_NumPendingWeightUpdates;
+            m_Pipeline->m_WeightsUsageChanged.wait(lock, [this]() { return m_Pipeline->m_NumFramesUsingWeights == 0; });
+        }
+    }
+
+    ~PipelineWeightsUpdate()
+    {
+        if (m_Pipeline)
+        {
+            {
+                std::lock_guard<std::mutex> lockGuard(m_Pipeline->m_Mutex);
+                --m_Pipeline->m_NumPendingWeightUpdates;
+            }
+            m_Pipeline->m_WeightsUsageChanged.notify_all();
+        }
+    }
+
+private:
+    Pipeline* m_Pipeline;
+};
+
 std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                                                                 std::string& errorMessage,
                                                                 const INetworkProperties& networkProperties,
+                                                                const BackendContexts& backendContexts,
                                                                 profiling::ProfilingService&  profilingService)
 {
     std::unique_ptr<LoadedNetwork> loadedNetwork;
@@ -98,7 +237,7 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 
     try
     {
-        loadedNetwork.reset(new LoadedNetwork(std::move(net), networkProperties, profilingService));
+        loadedNetwork.reset(new LoadedNetwork(std::move(net), networkProperties, backendContexts, profilingService));
     }
     catch (const armnn::RuntimeException& error)
     {
@@ -118,10 +257,13 @@ std::unique_ptr<LoadedNetwork> LoadedNetwork::MakeLoadedNetwork(std::unique_ptr<
 
 LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                              const INetworkProperties& networkProperties,
+                             const BackendContexts& backendContexts,
                              profiling::ProfilingService&  profilingService) :
                              m_OptimizedNetwork(std::move(net)),
                              m_IsImportEnabled(networkProperties.m_ImportEnabled),
                              m_IsExportEnabled(networkProperties.m_ExportEnabled),
+                             m_InputSource(networkProperties.m_InputSource),
+                             m_OutputSource(networkProperties.m_OutputSource),
                              m_TensorHandleFactoryRegistry(),
                              m_ProfilingService(profilingService)
 {
@@ -144,6 +286,12 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
 
             IBackendInternal* backend = it.first->second.get();
 
+            auto contextIt = backendContexts.find(backendId);
+            if (contextIt != backendContexts.end())
+            {
+                backend->SetBackendContext(*contextIt->second);
+            }
+
             if (backend->SupportsTensorAllocatorAPI())
             {
                 auto workloadFactory = backend->CreateWorkloadFactory(m_TensorHandleFactoryRegistry);
@@ -207,6 +355,9 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
         timelineUtils->MarkEntityWithLabel(networkGuid, ss.str(), LabelsAndEventClasses::PROCESS_ID_GUID);
     }
 
+    // Estimated cost of each workload of m_WorkloadQueue, used to balance the pipeline stages.
+    std::vector<uint64_t> workloadCosts;
+
     //Then create workloads.
     for (auto&& layer : order)
     {
@@ -228,6 +379,12 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
             }
         default:
             {
+                if (layer->IsAliasingInput())
+                {
+                    // The output already holds the result, see Layer::CreateTensorHandles().
+                    break;
+                }
+
                 auto workload = layer->CreateWorkload(workloadFactory);
 
                 if (!workload)
@@ -246,7 +403,25 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                     AddWorkloadStructure(timelineUtils, workload, *layer);
                 }
 
+                m_LayerWorkloadIndices[layer] = static_cast<unsigned int>(m_WorkloadQueue.size());
                 m_WorkloadQueue.push_back(move(workload));
+                workloadCosts.push_back(EstimateWorkloadCost(*layer));
+                // The workload holds the constant data from now on, so it is counted before the layer releases it.
+                // Workloads reporting their constant tensors hold them in whatever form they use, e.g. packed,
+                // so they are counted as such, and the others as the constant tensors of their layer.
+                bool reportsConstants = false;
+                m_WorkloadQueue.back()->ShareConstantTensors([&](ScopedCpuTensorHandle& handle)
+                {
+                    reportsConstants = true;
+                    m_ConstantBytes += handle.GetTensorInfo().GetNumBytes();
+                });
+                if (!reportsConstants)
+                {
+                    layer->OperateOnConstantTensors([this](std::unique_ptr<ScopedCpuTensorHandle>& handle)
+                    {
+                        m_ConstantBytes += handle->GetTensorInfo().GetNumBytes();
+                    });
+                }
                 // release the constant data in the layer..
                 layer->ReleaseConstantData();
                 break;
@@ -260,14 +435,86 @@ LoadedNetwork::LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
         timelineUtils->Commit();
     }
 
-    // Set up memory.
-    m_OptimizedNetwork->GetGraph().AllocateDynamicBuffers();
+    if (networkProperties.m_NumWorkloadThreads > 1)
+    {
+        // Build the dependency graph of the workloads. Inputs don't have a workload, so nothing waits for them.
+        m_WorkloadDependents.resize(m_WorkloadQueue.size());
+        m_WorkloadDependencyCounts.resize(m_WorkloadQueue.size(), 0);
+        for (auto&& consumer : m_LayerWorkloadIndices)
+        {
+            for (auto&& inputSlot : consumer.first->GetInputSlots())
+            {
+                // Layers aliasing their input have no workload either, so their consumers wait for the producer
+                // of that input instead.
+                const Layer* producer = &inputSlot.GetConnectedOutputSlot()->GetOwningLayer();
+                while (producer->IsAliasingInput())
+                {
+                    producer = &producer->GetInputSlot(0).GetConnectedOutputSlot()->GetOwningLayer();
+                }
+                auto producerIt = m_LayerWorkloadIndices.find(producer);
+                if (producerIt == m_LayerWorkloadIndices.end())
+                {
+                    continue;
+                }
+
+                std::vector<unsigned int>& dependents = m_WorkloadDependents[producerIt->second];
+                if (std::find(dependents.begin(), dependents.end(), consumer.second) == dependents.end())
+                {
+                    dependents.push_back(consumer.second);
+                    ++m_WorkloadDependencyCounts[consumer.second];
+                }
+            }
+        }
+
+        m_WorkloadThreadPool = std::make_unique<WorkStealingThreadPool>(networkProperties.m_NumWorkloadThreads);
+    }
+
+    // Set up memory. Workloads running out of topological order must not share memory between their tensors.
+    m_OptimizedNetwork->GetGraph().AllocateDynamicBuffers(!m_WorkloadThreadPool);
 
     // Now that the intermediate tensor memory has been set-up, do any post allocation configuration for each workload.
     for (auto& workload : m_WorkloadQueue)
     {
         workload->PostAllocationConfigure();
     }
+
+    if (networkProperties.m_NumPipelineStages > 1 && m_WorkloadQueue.size() > 1)
+    {
+        m_Pipeline = std::make_unique<Pipeline>();
+
+        // Split the workloads, in topological order, into contiguous stages of about the same cost.
+        const unsigned int numStages = std::min(networkProperties.m_NumPipelineStages,
+                                                static_cast<unsigned int>(m_WorkloadQueue.size()));
+        const uint64_t totalCost = std::accumulate(workloadCosts.begin(), workloadCosts.end(), uint64_t(0));
+        uint64_t cost = 0;
+        unsigned int workloadIndex = 0;
+        for (unsigned int stageIndex = 0; stageIndex < numStages; ++stageIndex)
+        {
+            auto stage = std::make_unique<Pipeline::Stage>();
+            stage->m_FirstWorkload = workloadIndex;
+
+            // Every stage gets at least one workload and leaves at least one to each of the following stages.
+            const unsigned int lastWorkload = static_cast<unsigned int>(m_WorkloadQueue.size()) -
+                                              (numStages - stageIndex - 1);
+            const uint64_t stageEndCost = totalCost * (stageIndex + 1) / numStages;
+            do
+            {
+                cost += workloadCosts[workloadIndex++];
+            }
+            while (workloadIndex < lastWorkload && cost + workloadCosts[workloadIndex] / 2 <= stageEndCost);
+
+            stage->m_EndWorkload = workloadIndex;
+            m_Pipeline->m_Stages.push_back(std::move(stage));
+        }
+
+        for (unsigned int stageIndex = 0; stageIndex < numStages; ++stageIndex)
+        {
+            m_Pipeline->m_Stages[stageIndex]->m_Thread =
+                std::thread(&LoadedNetwork::RunPipelineStage, this, stageIndex);
+        }
+    }
+
+    PublishMemoryCounters(m_ConstantBytes, m_WorkingMemoryCounter->GetBytes());
 }
 
 void LoadedNetwork::SendNetworkStructure()
@@ -341,6 +588,31 @@ TensorInfo LoadedNetwork::GetOutputTensorInfo(LayerBindingId layerId) const
     throw InvalidArgumentException(boost::str(boost::format("No output layer is associated with id %1%") % layerId));
 }
 
+std::vector<LayerBindingId> LoadedNetwork::GetInputBindingIds() const
+{
+    std::vector<LayerBindingId> bindingIds;
+    for (auto&& inputLayer : m_OptimizedNetwork->GetGraph().GetInputLayers())
+    {
+        bindingIds.push_back(inputLayer->GetBindingId());
+    }
+    return bindingIds;
+}
+
+std::vector<LayerBindingId> LoadedNetwork::GetOutputBindingIds() const
+{
+    std::vector<LayerBindingId> bindingIds;
+    for (auto&& outputLayer : m_OptimizedNetwork->GetGraph().GetOutputLayers())
+    {
+        bindingIds.push_back(outputLayer->GetBindingId());
+    }
+    return bindingIds;
+}
+
+bool LoadedNetwork::BindsFileDescriptors() const
+{
+    return HoldsFileDescriptor(m_InputSource) || HoldsFileDescriptor(m_OutputSource);
+}
+
 const IWorkloadFactory& LoadedNetwork::GetWorkloadFactory(const Layer& layer) const
 {
     const IWorkloadFactory* workloadFactory = nullptr;
@@ -461,9 +733,48 @@ private:
 
 }
 
+/// Owns everything BindIOTensors() creates for a set of bound input and output tensors.
+struct LoadedNetwork::IOBinding
+{
+    IOBinding(const InputTensors& inputTensors, const OutputTensors& outputTensors)
+        : m_WorkloadData(inputTensors, outputTensors)
+    {}
+
+    WorkloadData m_WorkloadData;
+    WorkloadQueue m_InputQueue;
+    WorkloadQueue m_OutputQueue;
+    ImportedMemory m_ImportedMemory;
+    const WorkloadSubset* m_WorkloadSubset = nullptr;
+};
+
+LoadedNetwork::~LoadedNetwork()
+{
+    if (m_Pipeline)
+    {
+        // Closing the stages in order lets the inferences in flight complete.
+        for (auto&& stage : m_Pipeline->m_Stages)
+        {
+            {
+                std::lock_guard<std::mutex> lockGuard(m_Pipeline->m_Mutex);
+                stage->m_Closed = true;
+            }
+            stage->m_FrameAvailable.notify_one();
+            stage->m_Thread.join();
+        }
+        m_Pipeline.reset();
+    }
+
+    FreeWorkingMemory();
+
+    // Takes the memory of the network out of the runtime totals.
+    PublishMemoryCounters(0, 0);
+}
+
 Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
-                                      const OutputTensors& outputTensors)
+                                      const OutputTensors& outputTensors,
+                                      const CancellationOptions& cancellationOptions)
 {
+    const auto startTime = std::chrono::steady_clock::now();
     const Graph& graph = m_OptimizedNetwork->GetGraph();
 
     // Walk graph to determine the order of execution.
@@ -481,30 +792,214 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         throw InvalidArgumentException("Number of inputs provided does not match network.");
     }
 
+    const WorkloadSubset* workloadSubset = GetWorkloadSubset(outputTensors);
+
+    // The input and output workloads are specific to this call, which may run concurrently with others.
+    WorkloadQueue inputQueue;
+    WorkloadQueue outputQueue;
+    ImportedMemory importedMemory;
+
     // For each input to the network, call EnqueueInput with the data passed by the user.
     {
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareInputs");
-        m_InputQueue.clear();
-        m_InputQueue.reserve(graph.GetNumInputs());
+        inputQueue.reserve(graph.GetNumInputs());
         for (const BindableLayer* inputLayer : graph.GetInputLayers())
         {
             const TensorPin& pin = workloadData.GetInputTensorPin(inputLayer->GetBindingId());
-            EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+            EnqueueInput(*inputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(), inputQueue, importedMemory);
         }
     }
 
     // For each output to the network, call EnqueueOutput with the data passed by the user.
     {
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareOutputs");
-        m_OutputQueue.clear();
-        m_OutputQueue.reserve(graph.GetNumOutputs());
+        outputQueue.reserve(graph.GetNumOutputs());
         for (const BindableLayer* outputLayer : graph.GetOutputLayers())
         {
+            if (workloadSubset && !workloadSubset->HasOutput(outputLayer->GetBindingId()))
+            {
+                continue;
+            }
             const TensorPin& pin = workloadData.GetOutputTensorPin(outputLayer->GetBindingId());
-            EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo());
+            EnqueueOutput(*outputLayer, pin.GetTensorHandle(), pin.GetTensorInfo(), outputQueue, importedMemory);
+        }
+    }
+
+    m_LastImportedBytes.store(importedMemory.m_NumBytes, std::memory_order_relaxed);
+
+    return ExecuteInference(inputQueue, outputQueue, workloadSubset, &cancellationOptions, &importedMemory,
+                            startTime);
+}
+
+IOBindingId LoadedNetwork::BindIOTensors(const InputTensors& inputTensors, const OutputTensors& outputTensors)
+{
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    if (graph.GetNumInputs() != inputTensors.size())
+    {
+        throw InvalidArgumentException("Number of inputs provided does not match network.");
+    }
+
+    auto ioBinding = std::make_unique<IOBinding>(inputTensors, outputTensors);
+    ioBinding->m_WorkloadSubset = GetWorkloadSubset(outputTensors);
+
+    ioBinding->m_InputQueue.reserve(graph.GetNumInputs());
+    for (const BindableLayer* inputLayer : graph.GetInputLayers())
+    {
+        const TensorPin& pin = ioBinding->m_WorkloadData.GetInputTensorPin(inputLayer->GetBindingId());
+        EnqueueInput(*inputLayer,
+                     pin.GetTensorHandle(),
+                     pin.GetTensorInfo(),
+                     ioBinding->m_InputQueue,
+                     ioBinding->m_ImportedMemory);
+    }
+
+    ioBinding->m_OutputQueue.reserve(graph.GetNumOutputs());
+    for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+    {
+        if (ioBinding->m_WorkloadSubset && !ioBinding->m_WorkloadSubset->HasOutput(outputLayer->GetBindingId()))
+        {
+            continue;
+        }
+        const TensorPin& pin = ioBinding->m_WorkloadData.GetOutputTensorPin(outputLayer->GetBindingId());
+        EnqueueOutput(*outputLayer,
+                      pin.GetTensorHandle(),
+                      pin.GetTensorInfo(),
+                      ioBinding->m_OutputQueue,
+                      ioBinding->m_ImportedMemory);
+    }
+
+    std::lock_guard<std::mutex> lockGuard(m_IOBindingsMutex);
+    IOBindingId ioBindingId = m_IOBindingIdCounter++;
+    m_IOBindings.emplace(ioBindingId, std::move(ioBinding));
+    return ioBindingId;
+}
+
+Status LoadedNetwork::EnqueueWorkload(IOBindingId ioBindingId)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    IOBinding* ioBinding = nullptr;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_IOBindingsMutex);
+        auto it = m_IOBindings.find(ioBindingId);
+        if (it == m_IOBindings.end())
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("EnqueueWorkload: no tensors are bound with id %1%") % ioBindingId));
+        }
+        ioBinding = it->second.get();
+    }
+
+    return ExecuteInference(ioBinding->m_InputQueue,
+                            ioBinding->m_OutputQueue,
+                            ioBinding->m_WorkloadSubset,
+                            nullptr,
+                            &ioBinding->m_ImportedMemory,
+                            startTime);
+}
+
+Status LoadedNetwork::UnbindIOTensors(IOBindingId ioBindingId)
+{
+    std::lock_guard<std::mutex> lockGuard(m_IOBindingsMutex);
+    if (m_IOBindings.erase(ioBindingId) == 0)
+    {
+        ARMNN_LOG(warning) << "LoadedNetwork::UnbindIOTensors(): " << ioBindingId << " not found!";
+        return Status::Failure;
+    }
+    return Status::Success;
+}
+
+bool LoadedNetwork::WorkloadSubset::HasOutput(LayerBindingId outputId) const
+{
+    return std::binary_search(m_OutputIds.begin(), m_OutputIds.end(), outputId);
+}
+
+const LoadedNetwork::WorkloadSubset* LoadedNetwork::GetWorkloadSubset(const OutputTensors& outputTensors)
+{
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    std::vector<LayerBindingId> outputIds;
+    outputIds.reserve(outputTensors.size());
+    for (auto&& outputTensor : outputTensors)
+    {
+        outputIds.push_back(outputTensor.first);
+    }
+    std::sort(outputIds.begin(), outputIds.end());
+    if (outputIds.empty() || std::adjacent_find(outputIds.begin(), outputIds.end()) != outputIds.end())
+    {
+        throw InvalidArgumentException("At least one output, each with a distinct binding id, must be provided.");
+    }
+    if (outputIds.size() == graph.GetNumOutputs())
+    {
+        return nullptr;
+    }
+
+    std::lock_guard<std::mutex> lockGuard(m_WorkloadSubsetsMutex);
+    auto it = m_WorkloadSubsets.find(outputIds);
+    if (it != m_WorkloadSubsets.end())
+    {
+        return it->second.get();
+    }
+
+    auto workloadSubset = std::make_unique<WorkloadSubset>();
+    workloadSubset->m_OutputIds = outputIds;
+
+    // Walks the graph backwards from the requested outputs to find every layer they depend on.
+    std::vector<const Layer*> pendingLayers;
+    for (const BindableLayer* outputLayer : graph.GetOutputLayers())
+    {
+        if (workloadSubset->HasOutput(outputLayer->GetBindingId()))
+        {
+            pendingLayers.push_back(outputLayer);
+        }
+    }
+    if (pendingLayers.size() != outputIds.size())
+    {
+        throw InvalidArgumentException("Output tensors provided do not match the outputs of the network.");
+    }
+
+    std::unordered_set<const Layer*> neededLayers(pendingLayers.begin(), pendingLayers.end());
+    while (!pendingLayers.empty())
+    {
+        const Layer* layer = pendingLayers.back();
+        pendingLayers.pop_back();
+        for (auto&& inputSlot : layer->GetInputSlots())
+        {
+            const Layer* producer = &inputSlot.GetConnectedOutputSlot()->GetOwningLayer();
+            if (neededLayers.insert(producer).second)
+            {
+                pendingLayers.push_back(producer);
+            }
+        }
+    }
+
+    workloadSubset->m_IsIncluded.resize(m_WorkloadQueue.size(), false);
+    for (const Layer* layer : neededLayers)
+    {
+        auto workloadIt = m_LayerWorkloadIndices.find(layer);
+        if (workloadIt != m_LayerWorkloadIndices.end())
+        {
+            workloadSubset->m_IsIncluded[workloadIt->second] = true;
+        }
+    }
+    for (unsigned int workloadIndex = 0; workloadIndex < m_WorkloadQueue.size(); ++workloadIndex)
+    {
+        if (workloadSubset->m_IsIncluded[workloadIndex])
+        {
+            workloadSubset->m_Workloads.push_back(workloadIndex);
         }
     }
 
+    return m_WorkloadSubsets.emplace(std::move(outputIds), std::move(workloadSubset)).first->second.get();
+}
+
+Status LoadedNetwork::ExecuteInference(WorkloadQueue& inputQueue,
+                                       WorkloadQueue& outputQueue,
+                                       const WorkloadSubset* workloadSubset,
+                                       const CancellationOptions* cancellationOptions,
+                                       const ImportedMemory* boundMemory,
+                                       std::chrono::steady_clock::time_point startTime)
+{
     std::unique_ptr<TimelineUtilityMethods> timelineUtils =
                         TimelineUtilityMethods::GetTimelineUtils(m_ProfilingService);
     ProfilingGuid inferenceGuid = m_ProfilingService.GetNextGuid();
@@ -520,7 +1015,7 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         timelineUtils->RecordEvent(inferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_SOL_EVENT_CLASS);
     }
 
-    bool executionSucceeded = true;
+    Status status = Status::Success;
 
     {
         if (m_ProfilingService.IsProfilingEnabled())
@@ -529,7 +1024,8 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         }
         ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
         ARMNN_SCOPED_HEAP_PROFILING("Executing");
-        executionSucceeded = Execute(timelineUtils, inferenceGuid);
+        status = Execute(timelineUtils, inferenceGuid, inputQueue, outputQueue, workloadSubset, cancellationOptions,
+                         boundMemory);
     }
 
     if (timelineUtils)
@@ -538,10 +1034,16 @@ Status LoadedNetwork::EnqueueWorkload(const InputTensors& inputTensors,
         timelineUtils->RecordEvent(inferenceGuid, LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
         timelineUtils->Commit();
     }
-    return executionSucceeded ? Status::Success : Status::Failure;
+
+    RecordInference(startTime, status);
+    return status;
 }
 
-void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+void LoadedNetwork::EnqueueInput(const BindableLayer& layer,
+                                 ITensorHandle* tensorHandle,
+                                 const TensorInfo& tensorInfo,
+                                 WorkloadQueue& inputQueue,
+                                 ImportedMemory& importedMemory)
 {
     if (layer.GetType() != LayerType::Input)
     {
@@ -571,17 +1073,15 @@ void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tens
     MemorySourceFlags importFlags = outputTensorHandle->GetImportFlags();
     if (m_IsImportEnabled)  // Try import the input tensor
     {
-        if(CheckFlag(importFlags, MemorySource::Malloc) )
+        if(CheckFlag(importFlags, m_InputSource) )
         {
             // This assumes a CPU Tensor handle
+            // The memory is only recorded here. It is imported when the inference runs, see Execute().
             void* mem = tensorHandle->Map(false);
-            if (outputTensorHandle->Import(mem, MemorySource::Malloc))
-            {
-                tensorHandle->Unmap();
-                return; // No need for a workload since the import has been done.
-            }
             tensorHandle->Unmap();
-            throw MemoryImportException("EnqueueInput: Memory Import failed");
+            importedMemory.m_Handles.push_back({ outputTensorHandle, mem, m_InputSource, false });
+            importedMemory.m_NumBytes += tensorInfo.GetNumBytes();
+            return; // No need for a workload since the memory will be imported.
         }
         else
         {
@@ -590,6 +1090,11 @@ void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tens
     }
     else
     {
+        if (HoldsFileDescriptor(m_InputSource))
+        {
+            throw MemoryImportException("EnqueueInput: the input holds a file descriptor, which can only be imported");
+        }
+
         // Create a mem copy workload for input since we did not import
         std::unique_ptr<IWorkload> inputWorkload = std::make_unique<CopyMemGenericWorkload>(inputQueueDescriptor, info);
 
@@ -604,11 +1109,15 @@ void LoadedNetwork::EnqueueInput(const BindableLayer& layer, ITensorHandle* tens
             timelineUtils->Commit();
         }
 
-        m_InputQueue.push_back(move(inputWorkload));
+        inputQueue.push_back(move(inputWorkload));
     }
 }
 
-void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo)
+void LoadedNetwork::EnqueueOutput(const BindableLayer& layer,
+                                  ITensorHandle* tensorHandle,
+                                  const TensorInfo& tensorInfo,
+                                  WorkloadQueue& outputQueue,
+                                  ImportedMemory& importedMemory)
 {
     if (layer.GetType() != LayerType::Output)
     {
@@ -640,33 +1149,28 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
     // a) The imported pointer is aligned sufficiently
     // b) The tensor has zero padding
     // c) There is only one connection to the OutputSlot and it is to an OutputLayer.
-    // d) The output pointer is allocated via malloc. (Other types will be supported in a later release)
+    // d) The output memory is of the kind the backend can import, m_OutputSource.
     // e) m_IsExportEnabled must be set to true
     if (m_IsExportEnabled && (layer.GetInputSlots()[0].GetConnectedOutputSlot()->GetNumConnections() == 1))
     {
         if(layer.GetInputSlots()[0].GetConnectedOutputSlot()->GetOwningLayer().GetType() != LayerType::Input)
         {
             MemorySourceFlags importFlags = inputTensorHandle->GetImportFlags();
-            if (CheckFlag(importFlags, MemorySource::Malloc))
+            if (CheckFlag(importFlags, m_OutputSource))
             {
+                // The memory is only recorded here. It is imported when the inference runs, see Execute().
                 void *mem = tensorHandle->Map(false);
-                bool importOk = inputTensorHandle->Import(mem, MemorySource::Malloc);
                 tensorHandle->Unmap();
-
-                if (importOk)
-                {
-                    // Insert synchronization workload
-                    MemSyncQueueDescriptor syncDesc;
-                    syncDesc.m_Inputs.push_back(inputTensorHandle);
-                    info.m_InputTensorInfos.push_back(inputTensorInfo);
-                    auto syncWorkload = std::make_unique<SyncMemGenericWorkload>(syncDesc, info);
-                    ARMNN_ASSERT_MSG(syncWorkload, "No sync workload created");
-                    m_OutputQueue.push_back(move(syncWorkload));
-                }
-                else
-                {
-                    throw MemoryExportException("EnqueueOutput: Memory Export failed");
-                }
+                importedMemory.m_Handles.push_back({ inputTensorHandle, mem, m_OutputSource, true });
+                importedMemory.m_NumBytes += tensorInfo.GetNumBytes();
+
+                // Insert synchronization workload
+                MemSyncQueueDescriptor syncDesc;
+                syncDesc.m_Inputs.push_back(inputTensorHandle);
+                info.m_InputTensorInfos.push_back(inputTensorInfo);
+                auto syncWorkload = std::make_unique<SyncMemGenericWorkload>(syncDesc, info);
+                ARMNN_ASSERT_MSG(syncWorkload, "No sync workload created");
+                outputQueue.push_back(move(syncWorkload));
             }
             else
             {
@@ -681,6 +1185,11 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
     else
     {
         // If we got here then we didn't export the memory, so add an output workload which performs a memcopy.
+        if (HoldsFileDescriptor(m_OutputSource))
+        {
+            throw MemoryExportException("EnqueueOutput: the output holds a file descriptor, which can only be "
+                                        "exported, but export is disabled or the output has several connections");
+        }
         outputQueueDescriptor.m_Inputs.push_back(inputTensorHandle);
         info.m_InputTensorInfos.push_back(inputTensorInfo);
 
@@ -697,7 +1206,7 @@ void LoadedNetwork::EnqueueOutput(const BindableLayer& layer, ITensorHandle* ten
             timelineUtils->Commit();
         }
 
-        m_OutputQueue.push_back(move(outputWorkload));
+        outputQueue.push_back(move(outputWorkload));
     }
 }
 
@@ -722,6 +1231,24 @@ void LoadedNetwork::AllocateWorkingMemory(std::lock_guard<std::mutex>& lock)
     }
     m_TensorHandleFactoryRegistry.AquireMemory();
     m_IsWorkingMemAllocated = true;
+
+    m_AcquiredWorkingBytes = m_TensorHandleFactoryRegistry.GetAcquiredBytes();
+    for (auto&& workloadFactory : m_WorkloadFactories)
+    {
+        IBackendInternal::IMemoryManagerSharedPtr memoryManager = workloadFactory.second.second;
+        if (memoryManager)
+        {
+            m_AcquiredWorkingBytes += memoryManager->GetAcquiredBytes();
+        }
+    }
+    m_WorkingMemoryCounter->Add(m_AcquiredWorkingBytes);
+}
+
+size_t LoadedNetwork::AcquireWorkingMemory()
+{
+    std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
+    AllocateWorkingMemory(lockGuard);
+    return m_AcquiredWorkingBytes;
 }
 
 void LoadedNetwork::FreeWorkingMemory()
@@ -742,45 +1269,94 @@ void LoadedNetwork::FreeWorkingMemory()
     }
     m_TensorHandleFactoryRegistry.ReleaseMemory();
     m_IsWorkingMemAllocated = false;
+
+    m_WorkingMemoryCounter->Remove(m_AcquiredWorkingBytes);
+    m_AcquiredWorkingBytes = 0;
 }
 
-bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUtils,
-                            profiling::ProfilingGuid inferenceGuid)
+Status LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUtils,
+                              profiling::ProfilingGuid inferenceGuid,
+                              WorkloadQueue& inputQueue,
+                              WorkloadQueue& outputQueue,
+                              const WorkloadSubset* workloadSubset,
+                              const CancellationOptions* cancellationOptions,
+                              const ImportedMemory* boundMemory)
 {
-    bool success = true;
+    Status status = Status::Success;
 
     auto Fail = [&](const std::exception& error)
     {
         ARMNN_LOG(error) << "An error occurred attempting to execute a workload: " << error.what();
-        success = false;
+        status = Status::Failure;
     };
 
     try
     {
         std::lock_guard<std::mutex> lockGuard(m_WorkingMemMutex);
         AllocateWorkingMemory(lockGuard);
+        std::shared_lock<std::shared_timed_mutex> weightsLock(m_WeightsMutex);
+        std::unique_lock<std::shared_timed_mutex> executeAsyncLock(m_ExecuteAsyncMutex);
 
-        ProfilingDynamicGuid workloadInferenceID(0);
-        auto ExecuteQueue = [&timelineUtils, &workloadInferenceID, &inferenceGuid](WorkloadQueue& queue)
+        // The network's tensor handles are shared by all bindings and by EnqueueWorkload(), so the user memory is
+        // imported into them only here, while no other inference can replace it. Importing only records the
+        // pointer, no copy is made.
+        if (boundMemory)
         {
-            for (auto& workload : queue)
+            for (auto&& imported : boundMemory->m_Handles)
             {
-                if(timelineUtils)
-                {
-                    workloadInferenceID = timelineUtils->RecordWorkloadInferenceAndStartOfLifeEvent(workload->GetGuid(),
-                                                                                                    inferenceGuid);
-                }
-                workload->Execute();
-                if(timelineUtils)
+                if (!imported.m_TensorHandle->Import(imported.m_Memory, imported.m_Source))
                 {
-                    timelineUtils->RecordEndOfLifeEvent(workloadInferenceID);
+                    if (imported.m_IsOutput)
+                    {
+                        throw MemoryExportException("EnqueueOutput: Memory Export failed");
+                    }
+                    throw MemoryImportException("EnqueueInput: Memory Import failed");
                 }
             }
+        }
+
+        // Workloads may run on several threads, which must not record timeline events at the same time.
+        std::mutex timelineMutex;
+        auto ExecuteWorkload = [&timelineUtils, &timelineMutex, &inferenceGuid,
+                                cancellationOptions](IWorkload& workload)
+        {
+            if (cancellationOptions && cancellationOptions->IsCancelled())
+            {
+                throw InferenceCancelled();
+            }
+
+            ProfilingDynamicGuid workloadInferenceID(0);
+            if(timelineUtils)
+            {
+                std::lock_guard<std::mutex> timelineLockGuard(timelineMutex);
+                workloadInferenceID = timelineUtils->RecordWorkloadInferenceAndStartOfLifeEvent(workload.GetGuid(),
+                                                                                                inferenceGuid);
+            }
+            workload.Execute();
+            if(timelineUtils)
+            {
+                std::lock_guard<std::mutex> timelineLockGuard(timelineMutex);
+                timelineUtils->RecordEndOfLifeEvent(workloadInferenceID);
+            }
+        };
+        auto ExecuteQueue = [&ExecuteWorkload](WorkloadQueue& queue)
+        {
+            for (auto& workload : queue)
+            {
+                ExecuteWorkload(*workload);
+            }
         };
 
-        ExecuteQueue(m_InputQueue);
-        ExecuteQueue(m_WorkloadQueue);
-        ExecuteQueue(m_OutputQueue);
+        ExecuteQueue(inputQueue);
+        ExecuteWorkloads([this, &ExecuteWorkload](unsigned int workloadIndex)
+        {
+            ExecuteWorkload(*m_WorkloadQueue[workloadIndex]);
+        }, workloadSubset);
+        ExecuteQueue(outputQueue);
+    }
+    catch (const InferenceCancelled&)
+    {
+        status = Status::Cancelled;
     }
     catch (const RuntimeException& error)
     {
@@ -791,7 +1367,684 @@ bool LoadedNetwork::Execute(std::unique_ptr<TimelineUtilityMethods>& timelineUti
         Fail(error);
     }
 
-    return success;
+    return status;
+}
+
+void LoadedNetwork::ExecuteWorkloads(const std::function<void(unsigned int)>& executeWorkload,
+                                     const WorkloadSubset* workloadSubset)
+{
+    const unsigned int numWorkloads = static_cast<unsigned int>(m_WorkloadQueue.size());
+    auto IsIncluded = [workloadSubset](unsigned int workloadIndex)
+    {
+        return !workloadSubset || workloadSubset->m_IsIncluded[workloadIndex];
+    };
+
+    if (!m_WorkloadThreadPool)
+    {
+        if (workloadSubset)
+        {
+            for (unsigned int workloadIndex : workloadSubset->m_Workloads)
+            {
+                executeWorkload(workloadIndex);
+            }
+            return;
+        }
+        for (unsigned int workloadIndex = 0; workloadIndex < numWorkloads; ++workloadIndex)
+        {
+            executeWorkload(workloadIndex);
+        }
+        return;
+    }
+
+    // State of one run of the workload graph, shared by the tasks running its workloads.
+    struct GraphRun
+    {
+        explicit GraphRun(const std::vector<unsigned int>& dependencyCounts)
+            : m_RemainingDependencies(dependencyCounts.size())
+        {
+            for (size_t i = 0; i < dependencyCounts.size(); ++i)
+            {
+                m_RemainingDependencies[i] = dependencyCounts[i];
+            }
+        }
+
+        std::vector<std::atomic<unsigned int>> m_RemainingDependencies;
+        std::atomic<bool> m_Failed{false};
+
+        std::mutex m_Mutex;
+        std::condition_variable m_Finished;
+        unsigned int m_NumScheduled = 0;
+        unsigned int m_NumCompleted = 0;
+        std::exception_ptr m_Error;
+    };
+    GraphRun run(m_WorkloadDependencyCounts);
+
+    std::function<void(unsigned int)> Schedule = [&](unsigned int workloadIndex)
+    {
+        {
+            std::lock_guard<std::mutex> lockGuard(run.m_Mutex);
+            ++run.m_NumScheduled;
+        }
+        m_WorkloadThreadPool->Schedule([&, workloadIndex]()
+        {
+            // Once a workload has failed, workloads which were already scheduled are skipped
+            // and no further workloads are scheduled.
+            if (!run.m_Failed)
+            {
+                try
+                {
+                    executeWorkload(workloadIndex);
+                }
+                catch (...)
+                {
+                    std::lock_guard<std::mutex> lockGuard(run.m_Mutex);
+                    if (!run.m_Error)
+                    {
+                        run.m_Error = std::current_exception();
+                    }
+                    run.m_Failed = true;
+                }
+            }
+
+            if (!run.m_Failed)
+            {
+                for (unsigned int dependent : m_WorkloadDependents[workloadIndex])
+                {
+                    // The workloads of a subset only depend on workloads of the subset, but not the other way round.
+                    if (!IsIncluded(dependent))
+                    {
+                        continue;
+                    }
+                    if (--run.m_RemainingDependencies[dependent] == 0)
+                    {
+                        Schedule(dependent);
+                    }
+                }
+            }
+
+            std::lock_guard<std::mutex> lockGuard(run.m_Mutex);
+            ++run.m_NumCompleted;
+            if (run.m_NumCompleted == run.m_NumScheduled)
+            {
+                run.m_Finished.notify_all();
+            }
+        });
+    };
+
+    for (unsigned int workloadIndex = 0; workloadIndex < numWorkloads; ++workloadIndex)
+    {
+        if (IsIncluded(workloadIndex) && m_WorkloadDependencyCounts[workloadIndex] == 0)
+        {
+            Schedule(workloadIndex);
+        }
+    }
+
+    std::unique_lock<std::mutex> lock(run.m_Mutex);
+    run.m_Finished.wait(lock, [&run] { return run.m_NumCompleted == run.m_NumScheduled; });
+
+    if (run.m_Error)
+    {
+        std::rethrow_exception(run.m_Error);
+    }
+}
+
+std::unique_ptr<IWorkingMemHandle> LoadedNetwork::CreateWorkingMemHandle(NetworkId networkId)
+{
+    Graph& order = m_OptimizedNetwork->GetGraph().TopologicalSort();
+
+    std::unordered_map<const OutputSlot*, ITensorHandle*> slotHandles;
+    std::vector<std::unique_ptr<ITensorHandle>> tensorHandles;
+    std::vector<unsigned int> tensorHandleSizes;
+    std::vector<WorkingMemDescriptor> workingMemDescriptors;
+    WorkingMemHandle::BindingHandles inputHandles;
+    WorkingMemHandle::BindingHandles outputHandles;
+
+    // Mirrors Layer::CreateTensorHandles(), but the handles are owned by the new working memory handle and are not
+    // memory managed, so they don't share the pools used by EnqueueWorkload().
+    auto CreateSlotHandle = [&](const Layer& layer, unsigned int slotIndex) -> ITensorHandle*
+    {
+        const OutputSlot& slot = layer.GetOutputSlot(slotIndex);
+        const TensorInfo& tensorInfo = slot.GetTensorInfo();
+
+        // Sub-tensors, of the layers computing in place over an input (see Layer::CreateTensorHandles()) or of the
+        // Concat and Splitter layers, simply get their own memory as well. The workloads of those layers find out
+        // whether their tensors share memory when they execute.
+        std::unique_ptr<ITensorHandle> tensorHandle;
+        ITensorHandleFactory::FactoryId factoryId = slot.GetTensorHandleFactoryId();
+        if (layer.IsAliasingInput())
+        {
+            // The layer has no workload to write its output, which must stay an alias of its input.
+            ITensorHandleFactory* handleFactory = m_TensorHandleFactoryRegistry.GetFactory(factoryId);
+            ARMNN_ASSERT(handleFactory);
+            tensorHandle = handleFactory->CreateAliasTensorHandle(
+                *slotHandles.at(layer.GetInputSlot(0).GetConnectedOutputSlot()), tensorInfo);
+            ARMNN_ASSERT(tensorHandle);
+        }
+        else if (factoryId == ITensorHandleFactory::LegacyFactoryId)
+        {
+            tensorHandle = GetWorkloadFactory(layer).CreateTensorHandle(tensorInfo, false);
+        }
+        else
+        {
+            ITensorHandleFactory* handleFactory = m_TensorHandleFactoryRegistry.GetFactory(factoryId);
+            ARMNN_ASSERT(handleFactory);
+            tensorHandle = handleFactory->CreateTensorHandle(tensorInfo, false);
+        }
+
+        ITensorHandle* rawHandle = tensorHandle.get();
+        slotHandles[&slot] = rawHandle;
+        tensorHandles.push_back(std::move(tensorHandle));
+        tensorHandleSizes.push_back(tensorInfo.GetNumBytes());
+        return rawHandle;
+    };
+
+    for (auto&& layer : order)
+    {
+        switch (layer->GetType())
+        {
+            case LayerType::Input:
+            {
+                ITensorHandle* tensorHandle = CreateSlotHandle(*layer, 0);
+                inputHandles[PolymorphicDowncast<const BindableLayer*>(layer)->GetBindingId()] = tensorHandle;
+                break;
+            }
+            case LayerType::Output:
+            {
+                const OutputSlot* source = layer->GetInputSlot(0).GetConnectedOutputSlot();
+                outputHandles[PolymorphicDowncast<const BindableLayer*>(layer)->GetBindingId()] =
+                    slotHandles.at(source);
+                break;
+            }
+            default:
+            {
+                if (layer->IsAliasingInput())
+                {
+                    CreateSlotHandle(*layer, 0);
+                    break;
+                }
+
+                // Workloads are created in this same order, see the LoadedNetwork constructor.
+                WorkingMemDescriptor workingMemDescriptor;
+                for (auto&& inputSlot : layer->GetInputSlots())
+                {
+                    workingMemDescriptor.m_Inputs.push_back(slotHandles.at(inputSlot.GetConnectedOutputSlot()));
+                }
+                for (unsigned int slotIndex = 0; slotIndex < layer->GetNumOutputSlots(); ++slotIndex)
+                {
+                    workingMemDescriptor.m_Outputs.push_back(CreateSlotHandle(*layer, slotIndex));
+                }
+                workingMemDescriptors.push_back(std::move(workingMemDescriptor));
+                break;
+            }
+        }
+    }
+
+    ARMNN_ASSERT(workingMemDescriptors.size() == m_WorkloadQueue.size());
+
+    return std::make_unique<WorkingMemHandle>(networkId,
+                                              std::move(workingMemDescriptors),
+                                              std::move(inputHandles),
+                                              std::move(outputHandles),
+                                              std::move(tensorHandles),
+                                              tensorHandleSizes,
+                                              m_WorkingMemoryCounter);
+}
+
+Status LoadedNetwork::Execute(const InputTensors& inputTensors,
+                              const OutputTensors& outputTensors,
+                              IWorkingMemHandle& iWorkingMemHandle)
+{
+    const auto startTime = std::chrono::steady_clock::now();
+    const Graph& graph = m_OptimizedNetwork->GetGraph();
+
+    if (graph.GetNumLayers() < 2)
+    {
+        ARMNN_LOG(warning) << "IRuntime::Execute()::Less than two nodes in graph";
+        return Status::Failure;
+    }
+
+    if (graph.GetNumInputs() != inputTensors.size())
+    {
+        throw InvalidArgumentException("Number of inputs provided does not match network.");
+    }
+
+    WorkingMemHandle& workingMemHandle = *PolymorphicDowncast<WorkingMemHandle*>(&iWorkingMemHandle);
+    std::lock_guard<std::mutex> lockGuard(workingMemHandle.GetMutex());
+
+    if (!workingMemHandle.IsAllocated())
+    {
+        workingMemHandle.Allocate();
+    }
+
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareInputs");
+        CopyInputs(inputTensors, workingMemHandle);
+    }
+
+    bool executionSucceeded = true;
+
+    auto Fail = [&](const std::exception& error)
+    {
+        ARMNN_LOG(error) << "An error occurred attempting to execute a workload: " << error.what();
+        executionSucceeded = false;
+    };
+
+    {
+        if (m_ProfilingService.IsProfilingEnabled())
+        {
+            m_ProfilingService.IncrementCounterValue(armnn::profiling::INFERENCES_RUN);
+        }
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "Execute");
+
+        try
+        {
+            std::shared_lock<std::shared_timed_mutex> weightsLock(m_WeightsMutex);
+            std::shared_lock<std::shared_timed_mutex> executeAsyncLock(m_ExecuteAsyncMutex);
+            ExecuteWorkloads([this, &workingMemHandle](unsigned int workloadIndex)
+            {
+                m_WorkloadQueue[workloadIndex]->ExecuteAsync(
+                    workingMemHandle.GetWorkingMemDescriptorAt(workloadIndex));
+            });
+        }
+        catch (const RuntimeException& error)
+        {
+            Fail(error);
+        }
+        catch (const std::runtime_error& error)
+        {
+            Fail(error);
+        }
+    }
+
+    {
+        ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "PrepareOutputs");
+        CopyOutputs(outputTensors, workingMemHandle);
+    }
+
+    const Status status = executionSucceeded ? Status::Success : Status::Failure;
+    RecordInference(startTime, status);
+    return status;
+}
+
+void LoadedNetwork::CopyInputs(const InputTensors& inputTensors, WorkingMemHandle& workingMemHandle)
+{
+    if (HoldsFileDescriptor(m_InputSource))
+    {
+        throw MemoryImportException("Execute: the inputs hold file descriptors, which can only be imported");
+    }
+
+    for (auto&& inputTensorPair : inputTensors)
+    {
+        ITensorHandle* tensorHandle = workingMemHandle.GetInputHandle(inputTensorPair.first);
+        const ConstTensor& inputTensor = inputTensorPair.second;
+        if (inputTensor.GetNumBytes() != GetInputTensorInfo(inputTensorPair.first).GetNumBytes())
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("Execute: size of the tensor supplied for input %1% does not match network")
+                % inputTensorPair.first));
+        }
+
+        std::memcpy(tensorHandle->Map(), inputTensor.GetMemoryArea(), inputTensor.GetNumBytes());
+        tensorHandle->Unmap();
+    }
+}
+
+void LoadedNetwork::CopyOutputs(const OutputTensors& outputTensors, WorkingMemHandle& workingMemHandle)
+{
+    if (HoldsFileDescriptor(m_OutputSource))
+    {
+        throw MemoryExportException("Execute: the outputs hold file descriptors, which can only be exported");
+    }
+
+    for (auto&& outputTensorPair : outputTensors)
+    {
+        ITensorHandle* tensorHandle = workingMemHandle.GetOutputHandle(outputTensorPair.first);
+        const Tensor& outputTensor = outputTensorPair.second;
+        if (outputTensor.GetNumBytes() != GetOutputTensorInfo(outputTensorPair.first).GetNumBytes())
+        {
+            throw InvalidArgumentException(boost::str(
+                boost::format("Execute: size of the tensor supplied for output %1% does not match network")
+                % outputTensorPair.first));
+        }
+
+        std::memcpy(outputTensor.GetMemoryArea(), tensorHandle->Map(), outputTensor.GetNumBytes());
+        tensorHandle->Unmap();
+    }
+}
+
+void LoadedNetwork::EnqueuePipelined(NetworkId networkId,
+                                     const InputTensors& inputTensors,
+                                     const OutputTensors& outputTensors,
+                                     PipelineCallback onCompleted)
+{
+    ARMNN_ASSERT(m_Pipeline);
+
+    if (m_OptimizedNetwork->GetGraph().GetNumInputs() != inputTensors.size())
+    {
+        throw InvalidArgumentException("Number of inputs provided does not match network.");
+    }
+
+    auto frame = std::make_unique<PipelineFrame>();
+    frame->m_StartTime = std::chrono::steady_clock::now();
+    frame->m_InputTensors = inputTensors;
+    frame->m_OutputTensors = outputTensors;
+    frame->m_OnCompleted = std::move(onCompleted);
+
+    bool createBuffer = false;
+    {
+        std::unique_lock<std::mutex> lock(m_Pipeline->m_Mutex);
+        m_Pipeline->m_BufferAvailable.wait(lock, [this]()
+        {
+            return !m_Pipeline->m_IdleBuffers.empty() || m_Pipeline->m_NumBuffers < m_Pipeline->m_Stages.size();
+        });
+
+        if (m_Pipeline->m_IdleBuffers.empty())
+        {
+            ++m_Pipeline->m_NumBuffers;
+            createBuffer = true;
+        }
+        else
+        {
+            frame->m_WorkingMemHandle = std::move(m_Pipeline->m_IdleBuffers.back());
+            m_Pipeline->m_IdleBuffers.pop_back();
+        }
+    }
+
+    if (createBuffer)
+    {
+        try
+        {
+            frame->m_WorkingMemHandle = CreateWorkingMemHandle(networkId);
+        }
+        catch (...)
+        {
+            {
+                std::lock_guard<std::mutex> lockGuard(m_Pipeline->m_Mutex);
+                --m_Pipeline->m_NumBuffers;
+            }
+            m_Pipeline->m_BufferAvailable.notify_one();
+            throw;
+        }
+    }
+
+    Pipeline::Stage& firstStage = *m_Pipeline->m_Stages.front();
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Pipeline->m_Mutex);
+        firstStage.m_Frames.push_back(std::move(frame));
+    }
+    firstStage.m_FrameAvailable.notify_one();
+}
+
+void LoadedNetwork::RunPipelineStage(unsigned int stageIndex)
+{
+    Pipeline::Stage& stage = *m_Pipeline->m_Stages[stageIndex];
+    const bool isFirstStage = stageIndex == 0;
+    const bool isLastStage  = stageIndex + 1 == m_Pipeline->m_Stages.size();
+
+    while (true)
+    {
+        std::unique_ptr<PipelineFrame> frame;
+        {
+            std::unique_lock<std::mutex> lock(m_Pipeline->m_Mutex);
+            stage.m_FrameAvailable.wait(lock, [&stage]() { return stage.m_Closed || !stage.m_Frames.empty(); });
+            if (stage.m_Frames.empty())
+            {
+                return;
+            }
+            frame = std::move(stage.m_Frames.front());
+            stage.m_Frames.pop_front();
+
+            // The weights are pinned from the first stage of an inference to its last, so that its stages never
+            // run with different weights.
+            if (isFirstStage)
+            {
+                m_Pipeline->m_WeightsUsageChanged.wait(lock, [this]()
+                {
+                    return m_Pipeline->m_NumPendingWeightUpdates == 0;
+                });
+                ++m_Pipeline->m_NumFramesUsingWeights;
+            }
+        }
+
+        // Once an inference has failed its remaining stages are skipped.
+        if (frame->m_Status == Status::Success && !frame->m_Error)
+        {
+            WorkingMemHandle& workingMemHandle = *PolymorphicDowncast<WorkingMemHandle*>(
+                frame->m_WorkingMemHandle.get());
+            try
+            {
+                if (isFirstStage)
+                {
+                    if (!workingMemHandle.IsAllocated())
+                    {
+                        workingMemHandle.Allocate();
+                    }
+                    if (m_ProfilingService.IsProfilingEnabled())
+                    {
+                        m_ProfilingService.IncrementCounterValue(armnn::profiling::INFERENCES_RUN);
+                    }
+                    CopyInputs(frame->m_InputTensors, workingMemHandle);
+                }
+
+                {
+                    std::shared_lock<std::shared_timed_mutex> executeAsyncLock(m_ExecuteAsyncMutex);
+                    for (unsigned int workloadIndex = stage.m_FirstWorkload;
+                         workloadIndex < stage.m_EndWorkload;
+                         ++workloadIndex)
+                    {
+                        m_WorkloadQueue[workloadIndex]->ExecuteAsync(
+                            workingMemHandle.GetWorkingMemDescriptorAt(workloadIndex));
+                    }
+                }
+
+                if (isLastStage)
+                {
+                    CopyOutputs(frame->m_OutputTensors, workingMemHandle);
+                }
+            }
+            catch (const RuntimeException& error)
+            {
+                ARMNN_LOG(error) << "An error occurred attempting to execute a workload: " << error.what();
+                frame->m_Status = Status::Failure;
+            }
+            catch (const std::runtime_error& error)
+            {
+                ARMNN_LOG(error) << "An error occurred attempting to execute a workload: " << error.what();
+                frame->m_Status = Status::Failure;
+            }
+            catch (...)
+            {
+                frame->m_Error = std::current_exception();
+            }
+        }
+
+        if (!isLastStage)
+        {
+            Pipeline::Stage& nextStage = *m_Pipeline->m_Stages[stageIndex + 1];
+            {
+                std::lock_guard<std::mutex> lockGuard(m_Pipeline->m_Mutex);
+                nextStage.m_Frames.push_back(std::move(frame));
+            }
+            nextStage.m_FrameAvailable.notify_one();
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lockGuard(m_Pipeline->m_Mutex);
+            --m_Pipeline->m_NumFramesUsingWeights;
+        }
+        m_Pipeline->m_WeightsUsageChanged.notify_all();
+
+        RecordInference(frame->m_StartTime, frame->m_Error ? Status::Failure : frame->m_Status);
+
+        try
+        {
+            frame->m_OnCompleted(frame->m_Status, frame->m_Error);
+        }
+        catch (const std::exception& error)
+        {
+            ARMNN_LOG(error) << "LoadedNetwork::RunPipelineStage(): the completion callback threw: " << error.what();
+        }
+        catch (...)
+        {
+            ARMNN_LOG(error) << "LoadedNetwork::RunPipelineStage(): the completion callback threw an unknown exception";
+        }
+
+        {
+            std::lock_guard<std::mutex> lockGuard(m_Pipeline->m_Mutex);
+            m_Pipeline->m_IdleBuffers.push_back(std::move(frame->m_WorkingMemHandle));
+        }
+        m_Pipeline->m_BufferAvailable.notify_one();
+    }
+}
+
+void LoadedNetwork::RecordInference(std::chrono::steady_clock::time_point startTime, Status status)
+{
+    const auto endTime = std::chrono::steady_clock::now();
+    m_InferenceLatencies.Record(endTime - startTime);
+    if (status == Status::Failure)
+    {
+        m_NumFailedInferences.fetch_add(1, std::memory_order_relaxed);
+    }
+    else if (status == Status::Cancelled)
+    {
+        m_NumCancelledInferences.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    if (!m_ProfilingService.IsProfilingEnabled())
+    {
+        return;
+    }
+
+    // Computing the percentiles takes a pass over the histogram, so the counters are only refreshed periodically,
+    // by the first inference to complete once the period has elapsed.
+    const int64_t now = std::chrono::duration_cast<std::chrono::nanoseconds>(endTime.time_since_epoch()).count();
+    int64_t nextUpdate = m_NextLatencyCounterUpdate.load(std::memory_order_relaxed);
+    if (now < nextUpdate ||
+        !m_NextLatencyCounterUpdate.compare_exchange_strong(nextUpdate, now + g_LatencyCounterPeriod.count()))
+    {
+        return;
+    }
+
+    const std::vector<std::chrono::nanoseconds> latencies = m_InferenceLatencies.GetPercentiles({ 50.0, 95.0, 99.0 });
+    m_ProfilingService.SetCounterValue(INFERENCE_LATENCY_P50, ToCounterValue(latencies[0]));
+    m_ProfilingService.SetCounterValue(INFERENCE_LATENCY_P95, ToCounterValue(latencies[1]));
+    m_ProfilingService.SetCounterValue(INFERENCE_LATENCY_P99, ToCounterValue(latencies[2]));
+
+    PublishMemoryCounters(m_ConstantBytes, m_WorkingMemoryCounter->GetBytes());
+}
+
+void LoadedNetwork::PublishMemoryCounters(size_t constantBytes, size_t workingBytes)
+{
+    if (!m_ProfilingService.IsProfilingEnabled())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lockGuard(g_MemoryCountersMutex);
+
+    // Replaces the contribution of the network to a counter, returning the new value of the counter.
+    auto UpdateCounter = [this](uint16_t counterUid, uint32_t& publishedValue, uint32_t value)
+    {
+        if (value > publishedValue)
+        {
+            m_ProfilingService.AddCounterValue(counterUid, value - publishedValue);
+        }
+        else if (value < publishedValue)
+        {
+            m_ProfilingService.SubtractCounterValue(counterUid, publishedValue - value);
+        }
+        publishedValue = value;
+        return m_ProfilingService.GetAbsoluteCounterValue(counterUid);
+    };
+
+    UpdateCounter(CONSTANT_MEMORY, m_PublishedConstantKilobytes, ToKilobytesCounterValue(constantBytes));
+    const uint32_t totalWorkingKilobytes =
+        UpdateCounter(WORKING_MEMORY, m_PublishedWorkingKilobytes, ToKilobytesCounterValue(workingBytes));
+    if (totalWorkingKilobytes > m_ProfilingService.GetAbsoluteCounterValue(PEAK_WORKING_MEMORY))
+    {
+        m_ProfilingService.SetCounterValue(PEAK_WORKING_MEMORY, totalWorkingKilobytes);
+    }
+}
+
+NetworkMemoryUsage LoadedNetwork::GetMemoryUsage() const
+{
+    NetworkMemoryUsage memoryUsage;
+    memoryUsage.m_ConstantBytes = m_ConstantBytes;
+    memoryUsage.m_WorkingBytes = m_WorkingMemoryCounter->GetBytes();
+    memoryUsage.m_PeakWorkingBytes = m_WorkingMemoryCounter->GetPeakBytes();
+    memoryUsage.m_ImportedBytes = m_LastImportedBytes.load(std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lockGuard(m_IOBindingsMutex);
+    for (auto&& ioBinding : m_IOBindings)
+    {
+        memoryUsage.m_ImportedBytes += ioBinding.second->m_ImportedMemory.m_NumBytes;
+    }
+    return memoryUsage;
+}
+
+InferenceStatistics LoadedNetwork::GetInferenceStatistics() const
+{
+    InferenceStatistics statistics;
+    statistics.m_NumInferences = m_InferenceLatencies.GetCount();
+    statistics.m_NumFailedInferences = m_NumFailedInferences.load(std::memory_order_relaxed);
+    statistics.m_NumCancelledInferences = m_NumCancelledInferences.load(std::memory_order_relaxed);
+
+    const std::chrono::duration<double> uptime = std::chrono::steady_clock::now() - m_LoadTime;
+    if (uptime.count() > 0.0)
+    {
+        statistics.m_Throughput = static_cast<double>(statistics.m_NumInferences) / uptime.count();
+    }
+
+    const std::vector<std::chrono::nanoseconds> latencies = m_InferenceLatencies.GetPercentiles({ 50.0, 95.0, 99.0 });
+    statistics.m_MeanLatency = m_InferenceLatencies.GetMean();
+    statistics.m_P50Latency = latencies[0];
+    statistics.m_P95Latency = latencies[1];
+    statistics.m_P99Latency = latencies[2];
+    statistics.m_MaxLatency = m_InferenceLatencies.GetMax();
+    return statistics;
+}
+
+Status LoadedNetwork::UpdateLayerWeights(const std::string& layerName,
+                                         const ConstTensor& weights,
+                                         const Optional<ConstTensor>& biases)
+{
+    for (auto&& layer : m_OptimizedNetwork->GetGraph())
+    {
+        if (layer->GetNameStr() != layerName)
+        {
+            continue;
+        }
+
+        auto workloadIt = m_LayerWorkloadIndices.find(layer);
+        if (workloadIt != m_LayerWorkloadIndices.end())
+        {
+            // Waits for the inferences using the current weights to complete, those in the pipeline included.
+            PipelineWeightsUpdate pipelineWeightsUpdate(m_Pipeline.get());
+            std::unique_lock<std::shared_timed_mutex> weightsLock(m_WeightsMutex);
+            if (m_WorkloadQueue[workloadIt->second]->UpdateWeights(weights, biases))
+            {
+                return Status::Success;
+            }
+        }
+        ARMNN_LOG(warning) << "LoadedNetwork::UpdateLayerWeights(): the weights of layer " << layerName
+                           << " on backend " << layer->GetBackendId() << " can't be updated";
+        return Status::Failure;
+    }
+
+    ARMNN_LOG(warning) << "LoadedNetwork::UpdateLayerWeights(): no layer is named " << layerName;
+    return Status::Failure;
+}
+
+void LoadedNetwork::ShareConstantTensors(ConstantTensorStore& constantTensorStore)
+{
+    for (auto&& workload : m_WorkloadQueue)
+    {
+        workload->ShareConstantTensors([&constantTensorStore](ScopedCpuTensorHandle& tensorHandle)
+                                       {
+                                           constantTensorStore.Share(tensorHandle);
+                                       });
+    }
 }
 
 void LoadedNetwork::RegisterDebugCallback(const DebugCallbackFunction& func)
@@ -8,17 +8,28 @@
 #include <armnn/Types.hpp>
 
 #include "Network.hpp"
+#include "ConstantTensorStore.hpp"
+#include "LatencyHistogram.hpp"
 #include "LayerFwd.hpp"
 #include "Profiling.hpp"
+#include "WorkingMemHandle.hpp"
+#include "WorkingMemoryCounter.hpp"
 
 #include <armnn/backends/IBackendInternal.hpp>
 #include <backendsCommon/TensorHandleFactoryRegistry.hpp>
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadFactory.hpp>
+#include <backendsCommon/WorkStealingThreadPool.hpp>
 #include <ProfilingService.hpp>
 #include <TimelineUtilityMethods.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <exception>
+#include <functional>
+#include <map>
 #include <mutex>
+#include <shared_mutex>
 #include <unordered_map>
 
 namespace cl
@@ -35,16 +46,64 @@ class LoadedNetwork
 {
 public:
     using WorkloadQueue = std::vector< std::unique_ptr<IWorkload> >;
-    ~LoadedNetwork(){ FreeWorkingMemory(); }
+    ~LoadedNetwork();
 
     TensorInfo GetInputTensorInfo(LayerBindingId layerId) const;
     TensorInfo GetOutputTensorInfo(LayerBindingId layerId) const;
 
-    Status EnqueueWorkload(const InputTensors& inputTensors, const OutputTensors& outputTensors);
+    std::vector<LayerBindingId> GetInputBindingIds() const;
+    std::vector<LayerBindingId> GetOutputBindingIds() const;
 
+    /// Whether the tensors bound to the inputs or the outputs hold file descriptors rather than data, see
+    /// INetworkProperties::m_InputSource.
+    bool BindsFileDescriptors() const;
+
+    /// outputTensors may hold only some of the outputs of the network, in which case only the workloads these
+    /// outputs depend on are run. Returns Status::Cancelled if cancellationOptions stopped the inference.
+    Status EnqueueWorkload(const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors,
+                           const CancellationOptions& cancellationOptions = CancellationOptions());
+
+    /// Creates the input and output workloads for the given tensors once, so that they can be evaluated
+    /// repeatedly with EnqueueWorkload(IOBindingId) without constructing anything per inference.
+    /// As with EnqueueWorkload(), outputTensors may hold only some of the outputs of the network.
+    IOBindingId BindIOTensors(const InputTensors& inputTensors, const OutputTensors& outputTensors);
+
+    /// Evaluates the network using the tensors bound by BindIOTensors().
+    Status EnqueueWorkload(IOBindingId ioBindingId);
+
+    /// Releases the input and output workloads created by BindIOTensors().
+    Status UnbindIOTensors(IOBindingId ioBindingId);
+
+    /// Creates an execution context with its own intermediate tensor memory for this network.
+    std::unique_ptr<IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId);
+
+    /// Runs an inference using the intermediate tensor memory of the given execution context.
+    /// Thread safe with respect to other calls using different working memory handles.
+    Status Execute(const InputTensors& inputTensors,
+                   const OutputTensors& outputTensors,
+                   IWorkingMemHandle& workingMemHandle);
+
+    /// Called once a pipelined inference has completed, with the exception it threw if any.
+    using PipelineCallback = std::function<void(Status status, std::exception_ptr error)>;
+
+    /// Whether the network was loaded with more than one pipeline stage, see INetworkProperties.
+    bool IsPipelined() const { return m_Pipeline != nullptr; }
+
+    /// Queues an inference on the pipeline stages of the network. Blocks while every intermediate tensor buffer
+    /// of the pipeline is in use by an inference in flight. onCompleted is invoked on the last stage's thread.
+    void EnqueuePipelined(NetworkId networkId,
+                          const InputTensors& inputTensors,
+                          const OutputTensors& outputTensors,
+                          PipelineCallback onCompleted);
+
+    using BackendContexts = std::unordered_map<BackendId, IBackendInternal::IBackendContextPtr>;
+
+    /// backendContexts are the contexts of the runtime loading the network, see IBackendInternal::SetBackendContext().
     static std::unique_ptr<LoadedNetwork> MakeLoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                                                             std::string & errorMessage,
                                                             const INetworkProperties& networkProperties,
+                                                            const BackendContexts& backendContexts,
                                                             profiling::ProfilingService& profilingService);
 
     // NOTE we return by reference as the purpose of this method is only to provide
@@ -54,8 +113,28 @@ public:
 
     void FreeWorkingMemory();
 
+    /// Returns the latency and throughput of the inferences completed since the network was loaded.
+    InferenceStatistics GetInferenceStatistics() const;
+
+    /// Returns the memory currently held by the network, see IRuntime::GetMemoryUsage().
+    NetworkMemoryUsage GetMemoryUsage() const;
+
+    /// Acquires the intermediate tensor memory EnqueueWorkload() uses, unless it is already held, and returns the
+    /// number of bytes the memory managers of the network report as acquired for it.
+    size_t AcquireWorkingMemory();
+
     void RegisterDebugCallback(const DebugCallbackFunction& func);
 
+    /// Overwrites the weights, and the biases if given, of the workload of the layer with the given name, once
+    /// the inferences in progress have completed. See IRuntime::UpdateLayerWeights().
+    Status UpdateLayerWeights(const std::string& layerName,
+                              const ConstTensor& weights,
+                              const Optional<ConstTensor>& biases);
+
+    /// Lets the workloads replace the memory of their constant tensors with that of identical tensors in the
+    /// store, and add the others to it. Must be called before the network executes.
+    void ShareConstantTensors(ConstantTensorStore& constantTensorStore);
+
     void SendNetworkStructure();
 
     profiling::ProfilingGuid GetNetworkGuid();
@@ -65,15 +144,102 @@ private:
 
     LoadedNetwork(std::unique_ptr<OptimizedNetwork> net,
                   const INetworkProperties& networkProperties,
+                  const BackendContexts& backendContexts,
                   profiling::ProfilingService& profilingService);
 
-    void EnqueueInput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
-
-    void EnqueueOutput(const BindableLayer& layer, ITensorHandle* tensorHandle, const TensorInfo& tensorInfo);
-
-    bool Execute(std::unique_ptr<profiling::TimelineUtilityMethods>& timelineUtils,
-                 profiling::ProfilingGuid inferenceGuid);
-
+    /// Tensor handles of the network into which user memory is imported when an inference runs, with the memory.
+    struct ImportedMemory
+    {
+        struct Handle
+        {
+            ITensorHandle* m_TensorHandle;
+            void* m_Memory;
+            MemorySource m_Source;
+            /// Whether the memory is that of a network output, which is exported rather than imported.
+            bool m_IsOutput;
+        };
+        std::vector<Handle> m_Handles;
+        size_t m_NumBytes = 0;
+    };
+
+    /// Input and output workloads created by BindIOTensors(), see LoadedNetwork.cpp.
+    struct IOBinding;
+
+    /// Workloads of m_WorkloadQueue needed to compute a subset of the outputs of the network.
+    struct WorkloadSubset
+    {
+        /// Sorted binding ids of the outputs.
+        std::vector<LayerBindingId> m_OutputIds;
+        /// Indices of the workloads, in the order of m_WorkloadQueue.
+        std::vector<unsigned int> m_Workloads;
+        /// Whether each workload of m_WorkloadQueue is part of the subset.
+        std::vector<bool> m_IsIncluded;
+
+        bool HasOutput(LayerBindingId outputId) const;
+    };
+
+    /// Returns the workloads needed to fill the given output tensors, computed on first use of a set of outputs
+    /// and cached, or nullptr if they are all the outputs of the network and every workload is needed.
+    const WorkloadSubset* GetWorkloadSubset(const OutputTensors& outputTensors);
+
+    /// Stage threads and intermediate tensor buffers used by EnqueuePipelined(), see LoadedNetwork.cpp.
+    struct Pipeline;
+    struct PipelineFrame;
+    /// Holds back the inferences of the pipeline for UpdateLayerWeights(), see LoadedNetwork.cpp.
+    class PipelineWeightsUpdate;
+
+    /// Runs the workloads of one pipeline stage on each inference reaching it, until the stage is closed.
+    void RunPipelineStage(unsigned int stageIndex);
+
+    /// Copies the given tensors into the network inputs and out of the network outputs of a working memory handle.
+    void CopyInputs(const InputTensors& inputTensors, WorkingMemHandle& workingMemHandle);
+    void CopyOutputs(const OutputTensors& outputTensors, WorkingMemHandle& workingMemHandle);
+
+    void EnqueueInput(const BindableLayer& layer,
+                      ITensorHandle* tensorHandle,
+                      const TensorInfo& tensorInfo,
+                      WorkloadQueue& inputQueue,
+                      ImportedMemory& importedMemory);
+
+    void EnqueueOutput(const BindableLayer& layer,
+                       ITensorHandle* tensorHandle,
+                       const TensorInfo& tensorInfo,
+                       WorkloadQueue& outputQueue,
+                       ImportedMemory& importedMemory);
+
+    /// Runs the given input queue, the network's workloads, or only those of workloadSubset if given,
+    /// and the given output queue as one inference, unless cancellationOptions, if given, stop it.
+    /// The memory in boundMemory, if given, is imported into its tensor handles before running them.
+    Status ExecuteInference(WorkloadQueue& inputQueue,
+                            WorkloadQueue& outputQueue,
+                            const WorkloadSubset* workloadSubset,
+                            const CancellationOptions* cancellationOptions,
+                            const ImportedMemory* boundMemory,
+                            std::chrono::steady_clock::time_point startTime);
+
+    /// Adds an inference which started at startTime and has just completed to the statistics of the network,
+    /// and refreshes the latency counters of the profiling service if they are due.
+    void RecordInference(std::chrono::steady_clock::time_point startTime, Status status);
+
+    /// Replaces the contribution of the network to the memory counters of the profiling service with the given
+    /// sizes, if profiling is enabled.
+    void PublishMemoryCounters(size_t constantBytes, size_t workingBytes);
+
+    Status Execute(std::unique_ptr<profiling::TimelineUtilityMethods>& timelineUtils,
+                   profiling::ProfilingGuid inferenceGuid,
+                   WorkloadQueue& inputQueue,
+                   WorkloadQueue& outputQueue,
+                   const WorkloadSubset* workloadSubset,
+                   const CancellationOptions* cancellationOptions,
+                   const ImportedMemory* boundMemory);
+
+
+    /// Calls executeWorkload with the index of every workload of m_WorkloadQueue, or of workloadSubset if given,
+    /// either in order on the calling thread or, if the network has a workload thread pool, on the pool as soon as
+    /// the workloads they depend on have completed. Rethrows the first exception thrown by executeWorkload once no
+    /// workload is running anymore.
+    void ExecuteWorkloads(const std::function<void(unsigned int)>& executeWorkload,
+                          const WorkloadSubset* workloadSubset = nullptr);
 
     const IWorkloadFactory& GetWorkloadFactory(const Layer& layer) const;
 
@@ -88,9 +254,7 @@ private:
     WorkloadFactoryMap  m_WorkloadFactories;
 
     std::unique_ptr<OptimizedNetwork> m_OptimizedNetwork;
-    WorkloadQueue m_InputQueue;
     WorkloadQueue m_WorkloadQueue;
-    WorkloadQueue m_OutputQueue;
     std::shared_ptr<Profiler> m_Profiler;
 
     mutable std::mutex m_WorkingMemMutex;
@@ -98,10 +262,66 @@ private:
     bool m_IsWorkingMemAllocated=false;
     bool m_IsImportEnabled=false;
     bool m_IsExportEnabled=false;
+    MemorySource m_InputSource=MemorySource::Malloc;
+    MemorySource m_OutputSource=MemorySource::Malloc;
 
     TensorHandleFactoryRegistry m_TensorHandleFactoryRegistry;
 
+    /// Runs independent workloads concurrently, only created when more than one workload thread is requested.
+    std::unique_ptr<WorkStealingThreadPool> m_WorkloadThreadPool;
+
+    /// Indices of the workloads consuming the outputs of each workload of m_WorkloadQueue.
+    std::vector<std::vector<unsigned int>> m_WorkloadDependents;
+
+    /// Number of workloads of m_WorkloadQueue each workload consumes outputs of.
+    std::vector<unsigned int> m_WorkloadDependencyCounts;
+
+    /// Index in m_WorkloadQueue of the workload of each layer which has one.
+    std::unordered_map<const Layer*, unsigned int> m_LayerWorkloadIndices;
+
+    /// Held shared while workloads execute and exclusively while UpdateLayerWeights() changes the weights of one.
+    /// Pipelined inferences rely on PipelineWeightsUpdate instead, as they need the same weights for all stages.
+    mutable std::shared_timed_mutex m_WeightsMutex;
+
+    /// Held shared while workloads execute against working memory handles, through IWorkload::ExecuteAsync() which
+    /// may swap the tensor handles of a workload for its own, and exclusively while they execute against their own
+    /// tensor handles, through IWorkload::Execute(), so that Execute() never sees swapped handles.
+    mutable std::shared_timed_mutex m_ExecuteAsyncMutex;
+
+    /// Protects m_WorkloadSubsets, whose entries are never removed so can be used without holding the lock.
+    std::mutex m_WorkloadSubsetsMutex;
+    std::map<std::vector<LayerBindingId>, std::unique_ptr<WorkloadSubset>> m_WorkloadSubsets;
+
+    /// Protects m_IOBindings and m_IOBindingIdCounter.
+    mutable std::mutex m_IOBindingsMutex;
+    std::unordered_map<IOBindingId, std::unique_ptr<IOBinding>> m_IOBindings;
+    IOBindingId m_IOBindingIdCounter = 0;
+
+    /// Only created when more than one pipeline stage is requested.
+    std::unique_ptr<Pipeline> m_Pipeline;
+
     profiling::ProfilingService&  m_ProfilingService;
+
+    const std::chrono::steady_clock::time_point m_LoadTime = std::chrono::steady_clock::now();
+    LatencyHistogram m_InferenceLatencies;
+    std::atomic<uint64_t> m_NumFailedInferences{0};
+    std::atomic<uint64_t> m_NumCancelledInferences{0};
+
+    /// Time since the epoch of steady_clock, in nanoseconds, from which the latency counters are next refreshed.
+    std::atomic<int64_t> m_NextLatencyCounterUpdate{0};
+
+    /// Bytes of the constant tensors held by the workloads, counted when they are created.
+    size_t m_ConstantBytes = 0;
+    /// Shared with the working memory handles of the network, which may outlive it.
+    std::shared_ptr<WorkingMemoryCounter> m_WorkingMemoryCounter = std::make_shared<WorkingMemoryCounter>();
+    /// Bytes acquired by the memory managers for EnqueueWorkload() while m_IsWorkingMemAllocated.
+    size_t m_AcquiredWorkingBytes = 0;
+    /// Bytes of user memory imported by the latest EnqueueWorkload() call.
+    std::atomic<size_t> m_LastImportedBytes{0};
+
+    /// Contributions of the network to the memory counters, protected by a mutex shared by all networks.
+    uint32_t m_PublishedConstantKilobytes = 0;
+    uint32_t m_PublishedWorkingKilobytes = 0;
 };
 
 }
@@ -5,6 +5,7 @@
 
 #include "Network.hpp"
 #include "Graph.hpp"
+#include "GraphSerializer.hpp"
 #include "Layer.hpp"
 #include "DeviceSpec.hpp"
 #include "Optimizer.hpp"
@@ -30,8 +31,11 @@
 
 #include <fcntl.h>
 #include <algorithm>
+#include <cstdio>
 #include <fstream>
+#include <iomanip>
 #include <memory>
+#include <random>
 #include <vector>
 #include <algorithm>
 
@@ -62,6 +66,17 @@ void IOptimizedNetwork::Destroy(IOptimizedNetwork* network)
     delete PolymorphicDowncast<OptimizedNetwork*>(network);
 }
 
+void SaveOptimizedNetwork(const IOptimizedNetwork& network, std::ostream& stream)
+{
+    GraphSerializer::Serialize(PolymorphicDowncast<const OptimizedNetwork*>(&network)->GetGraph(), stream);
+}
+
+IOptimizedNetworkPtr LoadOptimizedNetwork(std::istream& stream)
+{
+    return IOptimizedNetworkPtr(new OptimizedNetwork(GraphSerializer::Deserialize(stream)),
+                                &IOptimizedNetwork::Destroy);
+}
+
 Status OptimizedNetwork::PrintGraph()
 {
     m_Graph->Print();
@@ -1011,6 +1026,112 @@ OptimizationResult SelectTensorHandleStrategy(Graph& optGraph,
     return result;
 }
 
+std::string GetCachedNetworkPath(const Network& network,
+                                 const std::vector<BackendId>& backendPreferences,
+                                 const IDeviceSpec& deviceSpec,
+                                 const OptimizerOptions& options)
+{
+    // Everything the result of the optimization depends on besides the graph of the network, including the backend
+    // options the network was created with.
+    std::vector<std::string> supportedBackends;
+    for (auto&& backendId : deviceSpec.GetSupportedBackends())
+    {
+        supportedBackends.push_back(backendId.Get());
+    }
+    std::sort(supportedBackends.begin(), supportedBackends.end());
+
+    std::stringstream context;
+    context << backendPreferences << ";";
+    for (auto&& backendId : supportedBackends)
+    {
+        context << backendId << ",";
+    }
+    context << ";" << options.m_ReduceFp32ToFp16
+            << options.m_Debug
+            << options.m_ReduceFp32ToBf16
+            << static_cast<int>(options.m_shapeInferenceMethod)
+            << options.m_ImportEnabled << ";";
+    for (auto&& backendOptions : network.GetNetworkOptions())
+    {
+        context << backendOptions.GetBackendId() << "{";
+        for (size_t i = 0; i < backendOptions.GetOptionCount(); ++i)
+        {
+            const BackendOptions::BackendOption& option = backendOptions.GetOption(i);
+            const BackendOptions::Var value = option.GetValue();
+            context << option.GetName() << "=";
+            if (value.IsBool())
+            {
+                context << "b" << value.AsBool();
+            }
+            else if (value.IsInt())
+            {
+                context << "i" << value.AsInt();
+            }
+            else if (value.IsFloat())
+            {
+                context << "f" << std::setprecision(9) << value.AsFloat();
+            }
+            else if (value.IsString())
+            {
+                context << "s" << value.AsString().size() << ":" << value.AsString();
+            }
+            context << ",";
+        }
+        context << "}";
+    }
+
+    std::stringstream path;
+    path << options.m_CachedNetworkDirectory << "/" << std::hex << std::setfill('0') << std::setw(16)
+         << GraphSerializer::Hash(network.GetGraph(), context.str()) << ".armnnopt";
+    return path.str();
+}
+
+IOptimizedNetworkPtr LoadCachedNetwork(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file)
+    {
+        return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
+    }
+
+    try
+    {
+        IOptimizedNetworkPtr optNet = LoadOptimizedNetwork(file);
+        ARMNN_LOG(info) << "Loaded the optimized network from " << path;
+        return optNet;
+    }
+    catch (const std::exception& e)
+    {
+        ARMNN_LOG(warning) << "Ignoring the cached optimized network " << path << ": " << e.what();
+        return IOptimizedNetworkPtr(nullptr, &IOptimizedNetwork::Destroy);
+    }
+}
+
+void SaveCachedNetwork(const IOptimizedNetwork& optNet, const std::string& path)
+{
+    // The network is written to a temporary file first, so that concurrent processes never read a partial file.
+    const std::string temporaryPath = path + "." + std::to_string(std::random_device()()) + ".tmp";
+    try
+    {
+        std::ofstream file(temporaryPath, std::ios::binary);
+        if (!file)
+        {
+            throw RuntimeException("Failed to open " + temporaryPath);
+        }
+        SaveOptimizedNetwork(optNet, file);
+        file.close();
+        if (!file || std::rename(temporaryPath.c_str(), path.c_str()) != 0)
+        {
+            throw RuntimeException("Failed to write " + path);
+        }
+    }
+    catch (const std::exception& e)
+    {
+        std::remove(temporaryPath.c_str());
+        ARMNN_LOG(warning) << "Failed to cache the optimized network: " << e.what();
+    }
+}
+
 IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
                               const std::vector<BackendId>& backendPreferences,
                               const IDeviceSpec& deviceSpec,
@@ -1028,6 +1149,18 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
     }
 
     const Network& network = *PolymorphicDowncast<const Network*>(&inNetwork);
+
+    std::string cachedNetworkPath;
+    if (!options.m_CachedNetworkDirectory.empty())
+    {
+        cachedNetworkPath = GetCachedNetworkPath(network, backendPreferences, deviceSpec, options);
+        IOptimizedNetworkPtr cachedNetwork = LoadCachedNetwork(cachedNetworkPath);
+        if (cachedNetwork)
+        {
+            return cachedNetwork;
+        }
+    }
+
     std::unique_ptr<Graph> graph = std::make_unique<Graph>(network.GetGraph());
 
     auto optNet = IOptimizedNetworkPtr(new OptimizedNetwork(std::move(graph)), &IOptimizedNetwork::Destroy);
@@ -1157,6 +1290,11 @@ IOptimizedNetworkPtr Optimize(const INetwork& inNetwork,
         }
     }
 
+    if (!cachedNetworkPath.empty())
+    {
+        SaveCachedNetwork(*optNet, cachedNetworkPath);
+    }
+
     return optNet;
 }
 bool Network::GetShapeInferenceMethod()
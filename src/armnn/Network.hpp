@@ -33,6 +33,8 @@ public:
 
     const Graph& GetGraph() const { return *m_Graph; }
 
+    const NetworkOptions& GetNetworkOptions() const { return m_NetworkOptions; }
+
     Status PrintGraph() override;
 
     IConnectableLayer* AddInputLayer(LayerBindingId id, const char* name=nullptr) override;
@@ -287,6 +289,7 @@ public:
     profiling::ProfilingGuid GetGuid() const final { return m_Guid; };
 
     Graph& GetGraph() { return *m_Graph; }
+    const Graph& GetGraph() const { return *m_Graph; }
 
 private:
     std::unique_ptr<Graph> m_Graph;
@@ -76,6 +76,7 @@ Status Runtime::LoadNetwork(NetworkId& networkIdOut,
         std::unique_ptr<OptimizedNetwork>(PolymorphicDowncast<OptimizedNetwork*>(rawNetwork)),
         errorMessage,
         networkProperties,
+        m_BackendContexts,
         m_ProfilingService);
 
     if (!loadedNetwork)
@@ -83,6 +84,11 @@ Status Runtime::LoadNetwork(NetworkId& networkIdOut,
         return Status::Failure;
     }
 
+    if (m_ShareConstantTensors)
+    {
+        loadedNetwork->ShareConstantTensors(m_ConstantTensorStore);
+    }
+
     {
         std::lock_guard<std::mutex> lockGuard(m_Mutex);
 
@@ -134,6 +140,19 @@ Status Runtime::UnloadNetwork(NetworkId networkId)
                                            profiling::LabelsAndEventClasses::ARMNN_PROFILING_EOL_EVENT_CLASS);
             }
         }
+        {
+            std::lock_guard<std::mutex> asyncLockGuard(m_AsyncMutex);
+            m_IdleWorkingMemHandles.erase(networkId);
+        }
+        m_WorkingMemoryResidency.Remove(networkId);
+
+        // Batches already being evaluated keep their batcher alive until they complete.
+        for (auto it = m_DynamicBatching.begin(); it != m_DynamicBatching.end();)
+        {
+            it = it->first == networkId || it->second.m_BatchedNetworkId == networkId ? m_DynamicBatching.erase(it)
+                                                                                       : std::next(it);
+        }
+
         if (m_LoadedNetworks.erase(networkId) == 0)
         {
             ARMNN_LOG(warning) << "WARNING: Runtime::UnloadNetwork(): " << networkId << " not found!";
@@ -145,6 +164,7 @@ Status Runtime::UnloadNetwork(NetworkId networkId)
             m_ProfilingService.IncrementCounterValue(armnn::profiling::NETWORK_UNLOADS);
         }
     }
+    m_ConstantTensorStore.RemoveUnusedTensors();
 
     for (auto&& context : m_BackendContexts)
     {
@@ -184,7 +204,11 @@ void Runtime::ReportStructure() // armnn::profiling::IProfilingService& profilin
 
 Runtime::Runtime(const CreationOptions& options)
     : m_NetworkIdCounter(0),
-      m_ProfilingService(*this)
+      m_ProfilingService(*this),
+      m_WorkingMemoryResidency(options.m_WorkingMemoryBudget),
+      m_AsyncWorkerThreads(options.m_AsyncWorkerThreads),
+      m_AsyncQueueDepth(options.m_AsyncQueueDepth),
+      m_ShareConstantTensors(options.m_ShareConstantTensors)
 {
     const auto start_time = armnn::GetTimeNow();
     ARMNN_LOG(info) << "ArmNN v" << ARMNN_VERSION << "\n";
@@ -254,6 +278,11 @@ Runtime::Runtime(const CreationOptions& options)
 Runtime::~Runtime()
 {
     const auto start_time = armnn::GetTimeNow();
+
+    // Finish the queued asynchronous inferences while their networks are still loaded.
+    m_AsyncThreadPool.reset();
+    m_IdleWorkingMemHandles.clear();
+
     std::vector<int> networkIDs;
     try
     {
@@ -322,22 +351,344 @@ Status Runtime::EnqueueWorkload(NetworkId networkId,
                                 const InputTensors& inputTensors,
                                 const OutputTensors& outputTensors)
 {
+    return EnqueueWorkload(networkId, inputTensors, outputTensors, CancellationOptions());
+}
+
+Status Runtime::EnqueueWorkload(NetworkId networkId,
+                                const InputTensors& inputTensors,
+                                const OutputTensors& outputTensors,
+                                const CancellationOptions& cancellationOptions)
+{
+    if (std::shared_ptr<DynamicBatcher> batcher = GetDynamicBatcher(networkId))
+    {
+        // The other samples of the batch still want their results, so a sample can only be dropped before joining.
+        if (cancellationOptions.IsCancelled())
+        {
+            return Status::Cancelled;
+        }
+        return batcher->Execute(inputTensors, outputTensors);
+    }
+
     LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
     ProfilerManager::GetInstance().RegisterProfiler(loadedNetwork->GetProfiler().get());
 
     ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkload");
 
-    static thread_local NetworkId lastId = networkId;
-    if (lastId != networkId)
+    MakeWorkingMemoryResident(networkId, *loadedNetwork);
+
+    return loadedNetwork->EnqueueWorkload(inputTensors, outputTensors, cancellationOptions);
+}
+
+IOBindingId Runtime::BindIOTensors(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    return loadedNetwork->BindIOTensors(inputTensors, outputTensors);
+}
+
+Status Runtime::EnqueueWorkload(NetworkId networkId, IOBindingId ioBindingId)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    ProfilerManager::GetInstance().RegisterProfiler(loadedNetwork->GetProfiler().get());
+
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::Undefined, "EnqueueWorkload");
+
+    MakeWorkingMemoryResident(networkId, *loadedNetwork);
+
+    return loadedNetwork->EnqueueWorkload(ioBindingId);
+}
+
+Status Runtime::UnbindIOTensors(NetworkId networkId, IOBindingId ioBindingId)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    return loadedNetwork->UnbindIOTensors(ioBindingId);
+}
+
+void Runtime::MakeWorkingMemoryResident(NetworkId networkId, LoadedNetwork& loadedNetwork)
+{
+    // The memory is acquired before the other networks are evicted, so that it is accounted with the bytes actually
+    // acquired rather than an estimate.
+    const size_t acquiredBytes = loadedNetwork.AcquireWorkingMemory();
+    std::vector<NetworkId> evicted = m_WorkingMemoryResidency.MakeResident(networkId, acquiredBytes);
+    for (NetworkId evictedId : evicted)
     {
-        LoadedNetworkFuncSafe(lastId, [](LoadedNetwork* network)
+        LoadedNetworkFuncSafe(evictedId, [](LoadedNetwork* network)
             {
                 network->FreeWorkingMemory();
             });
     }
-    lastId=networkId;
+}
+
+WorkingMemoryResidencyStats Runtime::GetWorkingMemoryResidencyStats() const
+{
+    return m_WorkingMemoryResidency.GetStats();
+}
+
+InferenceStatistics Runtime::GetInferenceStatistics(NetworkId networkId) const
+{
+    return GetLoadedNetworkPtr(networkId)->GetInferenceStatistics();
+}
+
+NetworkMemoryUsage Runtime::GetMemoryUsage(NetworkId networkId) const
+{
+    return GetLoadedNetworkPtr(networkId)->GetMemoryUsage();
+}
+
+Status Runtime::EnableDynamicBatching(NetworkId networkId,
+                                      NetworkId batchedNetworkId,
+                                      const DynamicBatchingOptions& options)
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    auto networkIt = m_LoadedNetworks.find(networkId);
+    auto batchedNetworkIt = m_LoadedNetworks.find(batchedNetworkId);
+    if (networkIt == m_LoadedNetworks.end() || batchedNetworkIt == m_LoadedNetworks.end())
+    {
+        ARMNN_LOG(error) << "Runtime::EnableDynamicBatching(): network " << networkId << " or " << batchedNetworkId
+                         << " not found";
+        return Status::Failure;
+    }
+    if (networkId == batchedNetworkId || m_DynamicBatching.count(batchedNetworkId) != 0)
+    {
+        ARMNN_LOG(error) << "Runtime::EnableDynamicBatching(): network " << batchedNetworkId
+                         << " can't evaluate batches as it is batched itself";
+        return Status::Failure;
+    }
+    // The samples are copied into and out of the batches.
+    if (networkIt->second->BindsFileDescriptors() || batchedNetworkIt->second->BindsFileDescriptors())
+    {
+        ARMNN_LOG(error) << "Runtime::EnableDynamicBatching(): networks whose tensors are bound as file descriptors "
+                         << "can't be batched";
+        return Status::Failure;
+    }
+
+    auto GetBindingInfos = [](const LoadedNetwork& network, bool inputs)
+    {
+        DynamicBatcher::BindingInfos infos;
+        for (LayerBindingId bindingId : inputs ? network.GetInputBindingIds() : network.GetOutputBindingIds())
+        {
+            infos.emplace_back(bindingId, inputs ? network.GetInputTensorInfo(bindingId)
+                                                 : network.GetOutputTensorInfo(bindingId));
+        }
+        return infos;
+    };
+
+    std::shared_ptr<DynamicBatcher> batcher;
+    try
+    {
+        batcher = std::make_shared<DynamicBatcher>(
+            GetBindingInfos(*networkIt->second, true),
+            GetBindingInfos(*networkIt->second, false),
+            GetBindingInfos(*batchedNetworkIt->second, true),
+            GetBindingInfos(*batchedNetworkIt->second, false),
+            options.m_MaxBatchSize,
+            options.m_Timeout,
+            [this, batchedNetworkId](const InputTensors& inputTensors, const OutputTensors& outputTensors)
+            {
+                // Batches closed one after the other are evaluated at once, each with its own working memory.
+                return ExecuteWithIdleWorkingMemHandle(batchedNetworkId, inputTensors, outputTensors);
+            });
+    }
+    catch (const InvalidArgumentException& error)
+    {
+        ARMNN_LOG(error) << "Runtime::EnableDynamicBatching(): " << error.what();
+        return Status::Failure;
+    }
+
+    m_DynamicBatching[networkId] = DynamicBatching{ batchedNetworkId, std::move(batcher) };
+    return Status::Success;
+}
 
-    return loadedNetwork->EnqueueWorkload(inputTensors, outputTensors);
+Status Runtime::DisableDynamicBatching(NetworkId networkId)
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    return m_DynamicBatching.erase(networkId) != 0 ? Status::Success : Status::Failure;
+}
+
+std::shared_ptr<DynamicBatcher> Runtime::GetDynamicBatcher(NetworkId networkId) const
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    auto it = m_DynamicBatching.find(networkId);
+    return it != m_DynamicBatching.end() ? it->second.m_Batcher : nullptr;
+}
+
+InferenceThreadPool& Runtime::GetAsyncThreadPool()
+{
+    std::lock_guard<std::mutex> lockGuard(m_AsyncMutex);
+    if (!m_AsyncThreadPool)
+    {
+        m_AsyncThreadPool = std::make_unique<InferenceThreadPool>(m_AsyncWorkerThreads, m_AsyncQueueDepth);
+    }
+    return *m_AsyncThreadPool;
+}
+
+Status Runtime::ExecuteOnWorker(NetworkId networkId,
+                                const InputTensors& inputTensors,
+                                const OutputTensors& outputTensors)
+{
+    // Samples of a batched network are gathered from all the worker threads.
+    if (std::shared_ptr<DynamicBatcher> batcher = GetDynamicBatcher(networkId))
+    {
+        return batcher->Execute(inputTensors, outputTensors);
+    }
+
+    return ExecuteWithIdleWorkingMemHandle(networkId, inputTensors, outputTensors);
+}
+
+Status Runtime::ExecuteWithIdleWorkingMemHandle(NetworkId networkId,
+                                                const InputTensors& inputTensors,
+                                                const OutputTensors& outputTensors)
+{
+    // Each thread borrows a working memory handle, so one network can run on all of them at once
+    // and no more handles are ever created for a network than inferences of it ran at the same time.
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle;
+    {
+        std::lock_guard<std::mutex> lockGuard(m_AsyncMutex);
+        auto it = m_IdleWorkingMemHandles.find(networkId);
+        if (it != m_IdleWorkingMemHandles.end() && !it->second.empty())
+        {
+            workingMemHandle = std::move(it->second.back());
+            it->second.pop_back();
+        }
+    }
+    if (!workingMemHandle)
+    {
+        workingMemHandle = CreateWorkingMemHandle(networkId);
+    }
+
+    auto ReturnWorkingMemHandle = [&]()
+    {
+        // The network may have been unloaded meanwhile, in which case the handle is simply dropped.
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        if (m_LoadedNetworks.find(networkId) != m_LoadedNetworks.end())
+        {
+            std::lock_guard<std::mutex> asyncLockGuard(m_AsyncMutex);
+            m_IdleWorkingMemHandles[networkId].push_back(std::move(workingMemHandle));
+        }
+    };
+
+    Status status = Status::Failure;
+    try
+    {
+        status = Execute(*workingMemHandle, inputTensors, outputTensors);
+    }
+    catch (...)
+    {
+        ReturnWorkingMemHandle();
+        throw;
+    }
+    ReturnWorkingMemHandle();
+
+    return status;
+}
+
+std::future<Status> Runtime::EnqueueWorkloadAsync(NetworkId networkId,
+                                                  const InputTensors& inputTensors,
+                                                  const OutputTensors& outputTensors)
+{
+    auto promise = std::make_shared<std::promise<Status>>();
+    std::future<Status> future = promise->get_future();
+
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    if (loadedNetwork->IsPipelined())
+    {
+        loadedNetwork->EnqueuePipelined(networkId, inputTensors, outputTensors,
+                                        [promise](Status status, std::exception_ptr error)
+        {
+            if (error)
+            {
+                promise->set_exception(error);
+            }
+            else
+            {
+                promise->set_value(status);
+            }
+        });
+        return future;
+    }
+
+    GetAsyncThreadPool().Schedule([this, networkId, inputTensors, outputTensors, promise]()
+    {
+        try
+        {
+            promise->set_value(ExecuteOnWorker(networkId, inputTensors, outputTensors));
+        }
+        catch (...)
+        {
+            promise->set_exception(std::current_exception());
+        }
+    });
+
+    return future;
+}
+
+void Runtime::EnqueueWorkloadAsync(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   AsyncExecutionCallback callback)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    if (loadedNetwork->IsPipelined())
+    {
+        loadedNetwork->EnqueuePipelined(networkId, inputTensors, outputTensors,
+                                        [networkId, callback](Status status, std::exception_ptr error)
+        {
+            if (error)
+            {
+                try
+                {
+                    std::rethrow_exception(error);
+                }
+                catch (const std::exception& e)
+                {
+                    ARMNN_LOG(error) << "Runtime::EnqueueWorkloadAsync(): network " << networkId << ": " << e.what();
+                }
+                catch (...)
+                {
+                    ARMNN_LOG(error) << "Runtime::EnqueueWorkloadAsync(): network " << networkId
+                                     << ": unknown exception";
+                }
+                status = Status::Failure;
+            }
+            callback(status);
+        });
+        return;
+    }
+
+    GetAsyncThreadPool().Schedule([this, networkId, inputTensors, outputTensors, callback]()
+    {
+        Status status = Status::Failure;
+        try
+        {
+            status = ExecuteOnWorker(networkId, inputTensors, outputTensors);
+        }
+        catch (const std::exception& e)
+        {
+            ARMNN_LOG(error) << "Runtime::EnqueueWorkloadAsync(): network " << networkId << ": " << e.what();
+        }
+        catch (...)
+        {
+            ARMNN_LOG(error) << "Runtime::EnqueueWorkloadAsync(): network " << networkId << ": unknown exception";
+        }
+        callback(status);
+    });
+}
+
+std::unique_ptr<IWorkingMemHandle> Runtime::CreateWorkingMemHandle(NetworkId networkId)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    return loadedNetwork->CreateWorkingMemHandle(networkId);
+}
+
+Status Runtime::Execute(IWorkingMemHandle& workingMemHandle,
+                        const InputTensors& inputTensors,
+                        const OutputTensors& outputTensors)
+{
+    // Unlike EnqueueWorkload() this doesn't free the working memory of other networks: each working memory
+    // handle owns its memory, which is released with the handle.
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(workingMemHandle.GetNetworkId());
+    return loadedNetwork->Execute(inputTensors, outputTensors, workingMemHandle);
 }
 
 void Runtime::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func)
@@ -346,6 +697,15 @@ void Runtime::RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunc
     loadedNetwork->RegisterDebugCallback(func);
 }
 
+Status Runtime::UpdateLayerWeights(NetworkId networkId,
+                                   const std::string& layerName,
+                                   const ConstTensor& weights,
+                                   const Optional<ConstTensor>& biases)
+{
+    LoadedNetwork* loadedNetwork = GetLoadedNetworkPtr(networkId);
+    return loadedNetwork->UpdateLayerWeights(layerName, weights, biases);
+}
+
 void Runtime::LoadDynamicBackends(const std::string& overrideBackendPath)
 {
     // Get the paths where to load the dynamic backends from
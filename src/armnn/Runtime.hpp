@@ -5,7 +5,11 @@
 #pragma once
 
 #include "LoadedNetwork.hpp"
+#include "ConstantTensorStore.hpp"
 #include "DeviceSpec.hpp"
+#include "DynamicBatcher.hpp"
+#include "InferenceThreadPool.hpp"
+#include "WorkingMemoryResidencyManager.hpp"
 
 #include <armnn/INetwork.hpp>
 #include <armnn/IRuntime.hpp>
@@ -61,6 +65,54 @@ public:
         const InputTensors& inputTensors,
         const OutputTensors& outputTensors) override;
 
+    /// Evaluates network unless it gets cancelled, see IRuntime::EnqueueWorkload().
+    virtual Status EnqueueWorkload(NetworkId networkId,
+                                   const InputTensors& inputTensors,
+                                   const OutputTensors& outputTensors,
+                                   const CancellationOptions& cancellationOptions) override;
+
+    /// Binds input and output tensors to a network once, see IRuntime::BindIOTensors().
+    virtual IOBindingId BindIOTensors(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors) override;
+
+    // Evaluates network using the input and output tensors bound with BindIOTensors().
+    virtual Status EnqueueWorkload(NetworkId networkId, IOBindingId ioBindingId) override;
+
+    virtual Status UnbindIOTensors(NetworkId networkId, IOBindingId ioBindingId) override;
+
+    /// Queues an evaluation of the network on the runtime's worker threads, see IRuntime::EnqueueWorkloadAsync().
+    virtual std::future<Status> EnqueueWorkloadAsync(NetworkId networkId,
+                                                     const InputTensors& inputTensors,
+                                                     const OutputTensors& outputTensors) override;
+
+    /// Queues an evaluation of the network on the runtime's worker threads, see IRuntime::EnqueueWorkloadAsync().
+    virtual void EnqueueWorkloadAsync(NetworkId networkId,
+                                      const InputTensors& inputTensors,
+                                      const OutputTensors& outputTensors,
+                                      AsyncExecutionCallback callback) override;
+
+    /// Creates an execution context with its own intermediate tensor memory for the given network.
+    virtual std::unique_ptr<IWorkingMemHandle> CreateWorkingMemHandle(NetworkId networkId) override;
+
+    /// Evaluates the network of the given working memory handle. Thread safe across different handles.
+    virtual Status Execute(IWorkingMemHandle& workingMemHandle,
+                           const InputTensors& inputTensors,
+                           const OutputTensors& outputTensors) override;
+
+    virtual WorkingMemoryResidencyStats GetWorkingMemoryResidencyStats() const override;
+
+    virtual InferenceStatistics GetInferenceStatistics(NetworkId networkId) const override;
+
+    virtual NetworkMemoryUsage GetMemoryUsage(NetworkId networkId) const override;
+
+    /// Evaluates concurrent single-sample calls on a network as batches, see IRuntime::EnableDynamicBatching().
+    virtual Status EnableDynamicBatching(NetworkId networkId,
+                                         NetworkId batchedNetworkId,
+                                         const DynamicBatchingOptions& options) override;
+
+    virtual Status DisableDynamicBatching(NetworkId networkId) override;
+
     /// Unloads a network from the Runtime.
     /// At the moment this only removes the network from the m_Impl->m_Network.
     /// This might need more work in the future to be AndroidNN compliant.
@@ -80,6 +132,12 @@ public:
     /// @param func callback function to pass to the debug layer.
     virtual void RegisterDebugCallback(NetworkId networkId, const DebugCallbackFunction& func) override;
 
+    /// Replaces the weights of a layer of a loaded network, see IRuntime::UpdateLayerWeights().
+    virtual Status UpdateLayerWeights(NetworkId networkId,
+                                      const std::string& layerName,
+                                      const ConstTensor& weights,
+                                      const Optional<ConstTensor>& biases) override;
+
     /// Creates a runtime for workload execution.
     Runtime(const CreationOptions& options);
 
@@ -94,10 +152,16 @@ private:
 
     friend profiling::ProfilingService& GetProfilingService(armnn::Runtime* runtime); // See RuntimeTests.cpp
 
+    friend const ConstantTensorStore& GetConstantTensorStore(armnn::Runtime* runtime); // See RuntimeTests.cpp
+
     int GenerateNetworkId();
 
     LoadedNetwork* GetLoadedNetworkPtr(NetworkId networkId) const;
 
+    /// Marks the network as the most recently used one and frees the working memory of the networks
+    /// the residency manager evicts to make room for it.
+    void MakeWorkingMemoryResident(NetworkId networkId, LoadedNetwork& loadedNetwork);
+
     template<typename Func>
     void LoadedNetworkFuncSafe(NetworkId networkId, Func f)
     {
@@ -112,6 +176,21 @@ private:
     /// Loads any available/compatible dynamic backend in the runtime.
     void LoadDynamicBackends(const std::string& overrideBackendPath);
 
+    /// Returns the pool running asynchronous inferences, starting its threads on first use.
+    InferenceThreadPool& GetAsyncThreadPool();
+
+    /// Returns the batcher EnableDynamicBatching() set up for the network, or null.
+    std::shared_ptr<DynamicBatcher> GetDynamicBatcher(NetworkId networkId) const;
+
+    /// Runs an inference on the calling worker thread, as part of a batch if the network is batched.
+    Status ExecuteOnWorker(NetworkId networkId, const InputTensors& inputTensors, const OutputTensors& outputTensors);
+
+    /// Runs an inference on the calling thread using an idle working memory handle of the network, created if there
+    /// is none, which is returned to the idle handles afterwards.
+    Status ExecuteWithIdleWorkingMemHandle(NetworkId networkId,
+                                           const InputTensors& inputTensors,
+                                           const OutputTensors& outputTensors);
+
     mutable std::mutex m_Mutex;
 
     /// Map of Loaded Networks with associated GUID as key
@@ -128,6 +207,35 @@ private:
 
     /// Profiling Service Instance
     profiling::ProfilingService m_ProfilingService;
+
+    /// Decides which networks keep their working memory between calls to EnqueueWorkload().
+    WorkingMemoryResidencyManager m_WorkingMemoryResidency;
+
+    const unsigned int m_AsyncWorkerThreads;
+    const unsigned int m_AsyncQueueDepth;
+
+    const bool m_ShareConstantTensors;
+
+    /// Constant tensors shared between the loaded networks when m_ShareConstantTensors is set.
+    ConstantTensorStore m_ConstantTensorStore;
+
+    /// Protects m_AsyncThreadPool and m_IdleWorkingMemHandles. When both are needed m_Mutex is locked first.
+    std::mutex m_AsyncMutex;
+
+    /// Worker threads for EnqueueWorkloadAsync(), created on first use.
+    std::unique_ptr<InferenceThreadPool> m_AsyncThreadPool;
+
+    /// Working memory handles of each network which are not in use by a worker thread.
+    std::unordered_map<NetworkId, std::vector<std::unique_ptr<IWorkingMemHandle>>> m_IdleWorkingMemHandles;
+
+    struct DynamicBatching
+    {
+        NetworkId m_BatchedNetworkId;
+        std::shared_ptr<DynamicBatcher> m_Batcher;
+    };
+
+    /// Batching set up by EnableDynamicBatching() for each single-sample network. Protected by m_Mutex.
+    std::unordered_map<NetworkId, DynamicBatching> m_DynamicBatching;
 };
 
 } // namespace armnn
@@ -0,0 +1,154 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "WorkingMemHandle.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/MemorySources.hpp>
+#include <armnn/utility/Assert.hpp>
+
+#include <boost/format.hpp>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Intermediate tensors are packed at cache line granularity within the single allocation of a handle.
+constexpr size_t g_TensorAlignment = 64;
+
+size_t AlignUp(size_t value, size_t alignment)
+{
+    return ((value + alignment - 1) / alignment) * alignment;
+}
+
+ITensorHandle* GetBindingHandle(const WorkingMemHandle::BindingHandles& handles,
+                                LayerBindingId layerBindingId,
+                                const char* bindingPointDesc)
+{
+    auto it = handles.find(layerBindingId);
+    if (it == handles.end())
+    {
+        throw InvalidArgumentException(boost::str(
+            boost::format("No %1% layer is associated with id %2%") % bindingPointDesc % layerBindingId));
+    }
+    return it->second;
+}
+
+} // anonymous namespace
+
+WorkingMemHandle::WorkingMemHandle(NetworkId networkId,
+                                   std::vector<WorkingMemDescriptor> workingMemDescriptors,
+                                   BindingHandles inputHandles,
+                                   BindingHandles outputHandles,
+                                   std::vector<std::unique_ptr<ITensorHandle>> tensorHandles,
+                                   const std::vector<unsigned int>& tensorHandleSizes,
+                                   std::shared_ptr<WorkingMemoryCounter> workingMemoryCounter)
+    : m_NetworkId(networkId)
+    , m_WorkingMemDescriptors(std::move(workingMemDescriptors))
+    , m_InputHandles(std::move(inputHandles))
+    , m_OutputHandles(std::move(outputHandles))
+    , m_TensorHandles(std::move(tensorHandles))
+    , m_TotalBytes(0)
+    , m_UnimportedBytes(0)
+    , m_WorkingMemoryCounter(std::move(workingMemoryCounter))
+    , m_IsAllocated(false)
+    , m_AreUnimportedHandlesAllocated(false)
+{
+    ARMNN_ASSERT(m_TensorHandles.size() == tensorHandleSizes.size());
+
+    // Handles which can import host memory are all backed by one allocation made in Allocate().
+    m_Offsets.reserve(m_TensorHandles.size());
+    for (unsigned int i = 0; i < m_TensorHandles.size(); ++i)
+    {
+        if (CheckFlag(m_TensorHandles[i]->GetImportFlags(), MemorySource::Malloc))
+        {
+            m_Offsets.push_back(static_cast<std::ptrdiff_t>(m_TotalBytes));
+            m_TotalBytes += AlignUp(tensorHandleSizes[i], g_TensorAlignment);
+        }
+        else
+        {
+            m_Offsets.push_back(-1);
+            m_UnimportedBytes += tensorHandleSizes[i];
+        }
+    }
+}
+
+WorkingMemHandle::~WorkingMemHandle()
+{
+    Free();
+    if (m_AreUnimportedHandlesAllocated)
+    {
+        m_WorkingMemoryCounter->Remove(m_UnimportedBytes);
+    }
+}
+
+void WorkingMemHandle::Allocate()
+{
+    if (m_IsAllocated)
+    {
+        return;
+    }
+
+    if (!m_AreUnimportedHandlesAllocated)
+    {
+        for (unsigned int i = 0; i < m_TensorHandles.size(); ++i)
+        {
+            if (m_Offsets[i] < 0)
+            {
+                m_TensorHandles[i]->Allocate();
+            }
+        }
+        m_AreUnimportedHandlesAllocated = true;
+        m_WorkingMemoryCounter->Add(m_UnimportedBytes);
+    }
+
+    if (m_TotalBytes > 0)
+    {
+        m_Memory.reset(new unsigned char[m_TotalBytes + g_TensorAlignment]);
+        const uintptr_t base = reinterpret_cast<uintptr_t>(m_Memory.get());
+        unsigned char* alignedBase = m_Memory.get() + (AlignUp(base, g_TensorAlignment) - base);
+
+        for (unsigned int i = 0; i < m_TensorHandles.size(); ++i)
+        {
+            if (m_Offsets[i] >= 0 && !m_TensorHandles[i]->Import(alignedBase + m_Offsets[i], MemorySource::Malloc))
+            {
+                m_Memory.reset();
+                throw MemoryImportException("WorkingMemHandle: failed to import intermediate tensor memory");
+            }
+        }
+        m_WorkingMemoryCounter->Add(m_TotalBytes + g_TensorAlignment);
+    }
+
+    m_IsAllocated = true;
+}
+
+void WorkingMemHandle::Free()
+{
+    if (!m_IsAllocated)
+    {
+        return;
+    }
+
+    if (m_Memory)
+    {
+        m_Memory.reset();
+        m_WorkingMemoryCounter->Remove(m_TotalBytes + g_TensorAlignment);
+    }
+    m_IsAllocated = false;
+}
+
+ITensorHandle* WorkingMemHandle::GetInputHandle(LayerBindingId layerBindingId) const
+{
+    return GetBindingHandle(m_InputHandles, layerBindingId, "input");
+}
+
+ITensorHandle* WorkingMemHandle::GetOutputHandle(LayerBindingId layerBindingId) const
+{
+    return GetBindingHandle(m_OutputHandles, layerBindingId, "output");
+}
+
+} // namespace armnn
@@ -0,0 +1,103 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "WorkingMemoryCounter.hpp"
+
+#include <armnn/IWorkingMemHandle.hpp>
+#include <armnn/Tensor.hpp>
+
+#include <armnn/backends/ITensorHandle.hpp>
+#include <backendsCommon/WorkingMemDescriptor.hpp>
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+class WorkingMemHandle final : public IWorkingMemHandle
+{
+public:
+    using BindingHandles = std::unordered_map<LayerBindingId, ITensorHandle*>;
+
+    /// @param workingMemDescriptors One descriptor per workload, in the order of the network's workload queue.
+    /// @param inputHandles Tensor handles the inputs of the network are copied into, by binding id.
+    /// @param outputHandles Tensor handles the outputs of the network are copied from, by binding id.
+    /// @param tensorHandles Unallocated tensor handles owned by this object which the other arguments refer to.
+    /// @param tensorHandleSizes Size in bytes of each of the tensor handles.
+    /// @param workingMemoryCounter Counts the memory allocated by this object, shared with the network.
+    WorkingMemHandle(NetworkId networkId,
+                     std::vector<WorkingMemDescriptor> workingMemDescriptors,
+                     BindingHandles inputHandles,
+                     BindingHandles outputHandles,
+                     std::vector<std::unique_ptr<ITensorHandle>> tensorHandles,
+                     const std::vector<unsigned int>& tensorHandleSizes,
+                     std::shared_ptr<WorkingMemoryCounter> workingMemoryCounter);
+
+    ~WorkingMemHandle();
+
+    NetworkId GetNetworkId() override
+    {
+        return m_NetworkId;
+    }
+
+    /// Allocate the backing memory required for execution. If this is not called, then allocation will be
+    /// deferred to execution time. The mutex must be locked.
+    void Allocate() override;
+
+    /// Free the backing memory required for execution. The mutex must be locked.
+    /// Tensor handles which cannot import memory keep the memory they allocated until destruction.
+    void Free() override;
+
+    /// IsAllocated returns true if the backing memory is currently allocated. The mutex must be locked.
+    bool IsAllocated() override
+    {
+        return m_IsAllocated;
+    }
+
+    /// Get a mutex which can be used for synchronizing access to the WorkingMemHandle object.
+    std::mutex& GetMutex() override
+    {
+        return m_Mutex;
+    }
+
+    /// Get the WorkingMemDescriptor for the workload at the given position in the workload queue.
+    WorkingMemDescriptor& GetWorkingMemDescriptorAt(unsigned int id)
+    {
+        return m_WorkingMemDescriptors[id];
+    }
+
+    ITensorHandle* GetInputHandle(LayerBindingId layerBindingId) const;
+    ITensorHandle* GetOutputHandle(LayerBindingId layerBindingId) const;
+
+    size_t GetNumInputs() const { return m_InputHandles.size(); }
+    size_t GetNumOutputs() const { return m_OutputHandles.size(); }
+
+private:
+    NetworkId m_NetworkId;
+    std::vector<WorkingMemDescriptor> m_WorkingMemDescriptors;
+    BindingHandles m_InputHandles;
+    BindingHandles m_OutputHandles;
+    std::vector<std::unique_ptr<ITensorHandle>> m_TensorHandles;
+
+    /// Offset into m_Memory of every tensor handle which imports its memory, or -1 for the ones which don't.
+    std::vector<std::ptrdiff_t> m_Offsets;
+    size_t m_TotalBytes;
+    std::unique_ptr<unsigned char[]> m_Memory;
+
+    /// Total size of the tensor handles which don't import their memory.
+    size_t m_UnimportedBytes;
+    std::shared_ptr<WorkingMemoryCounter> m_WorkingMemoryCounter;
+
+    bool m_IsAllocated;
+    bool m_AreUnimportedHandlesAllocated;
+    std::mutex m_Mutex;
+};
+
+} // namespace armnn
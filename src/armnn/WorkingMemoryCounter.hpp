@@ -0,0 +1,37 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace armnn
+{
+
+/// Bytes of intermediate tensor memory a network currently holds, and the most it has held at once. Updated from
+/// any thread without locking.
+class WorkingMemoryCounter
+{
+public:
+    void Add(size_t numBytes)
+    {
+        const size_t bytes = m_Bytes.fetch_add(numBytes, std::memory_order_relaxed) + numBytes;
+        size_t peakBytes = m_PeakBytes.load(std::memory_order_relaxed);
+        while (bytes > peakBytes && !m_PeakBytes.compare_exchange_weak(peakBytes, bytes, std::memory_order_relaxed))
+        {}
+    }
+
+    void Remove(size_t numBytes) { m_Bytes.fetch_sub(numBytes, std::memory_order_relaxed); }
+
+    size_t GetBytes() const { return m_Bytes.load(std::memory_order_relaxed); }
+    size_t GetPeakBytes() const { return m_PeakBytes.load(std::memory_order_relaxed); }
+
+private:
+    std::atomic<size_t> m_Bytes{0};
+    std::atomic<size_t> m_PeakBytes{0};
+};
+
+} // namespace armnn
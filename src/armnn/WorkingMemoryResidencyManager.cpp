@@ -0,0 +1,71 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "WorkingMemoryResidencyManager.hpp"
+
+#include <armnn/utility/Assert.hpp>
+
+namespace armnn
+{
+
+WorkingMemoryResidencyManager::WorkingMemoryResidencyManager(size_t budget)
+    : m_Budget(budget)
+{
+}
+
+std::vector<NetworkId> WorkingMemoryResidencyManager::MakeResident(NetworkId networkId, size_t workingMemorySize)
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    auto it = m_ResidentNetworks.find(networkId);
+    if (it != m_ResidentNetworks.end())
+    {
+        ++m_Stats.m_Hits;
+        m_LruList.splice(m_LruList.begin(), m_LruList, it->second.m_LruPosition);
+        return {};
+    }
+
+    ++m_Stats.m_Misses;
+    m_LruList.push_front(networkId);
+    m_ResidentNetworks.emplace(networkId, ResidentNetwork{ m_LruList.begin(), workingMemorySize });
+    m_Stats.m_ResidentBytes += workingMemorySize;
+
+    std::vector<NetworkId> evicted;
+    while (m_Budget != 0 && m_Stats.m_ResidentBytes > m_Budget && m_LruList.size() > 1)
+    {
+        NetworkId leastRecentlyUsed = m_LruList.back();
+        m_LruList.pop_back();
+
+        auto lruIt = m_ResidentNetworks.find(leastRecentlyUsed);
+        ARMNN_ASSERT(lruIt != m_ResidentNetworks.end());
+        m_Stats.m_ResidentBytes -= lruIt->second.m_WorkingMemorySize;
+        m_ResidentNetworks.erase(lruIt);
+
+        ++m_Stats.m_Evictions;
+        evicted.push_back(leastRecentlyUsed);
+    }
+    return evicted;
+}
+
+void WorkingMemoryResidencyManager::Remove(NetworkId networkId)
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+
+    auto it = m_ResidentNetworks.find(networkId);
+    if (it != m_ResidentNetworks.end())
+    {
+        m_Stats.m_ResidentBytes -= it->second.m_WorkingMemorySize;
+        m_LruList.erase(it->second.m_LruPosition);
+        m_ResidentNetworks.erase(it);
+    }
+}
+
+WorkingMemoryResidencyStats WorkingMemoryResidencyManager::GetStats() const
+{
+    std::lock_guard<std::mutex> lockGuard(m_Mutex);
+    return m_Stats;
+}
+
+} // namespace armnn
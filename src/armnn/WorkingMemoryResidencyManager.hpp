@@ -0,0 +1,61 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/IRuntime.hpp>
+#include <armnn/Types.hpp>
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace armnn
+{
+
+/// Tracks which loaded networks hold their working memory and decides, in least recently used order, which of them
+/// have to release it so that the total stays within a byte budget.
+/// The manager only does the bookkeeping: freeing the memory of the networks it evicts is up to the caller.
+class WorkingMemoryResidencyManager
+{
+public:
+    /// @param budget Number of bytes of working memory the resident networks may hold together, or zero for no
+    ///               limit. A network on its own is always allowed to be resident.
+    explicit WorkingMemoryResidencyManager(size_t budget);
+
+    /// Records that a network is about to run and makes it the most recently used one.
+    /// @param networkId The network about to run.
+    /// @param workingMemorySize Number of bytes of working memory the network has acquired.
+    /// @return The networks whose working memory has to be released to stay within the budget.
+    std::vector<NetworkId> MakeResident(NetworkId networkId, size_t workingMemorySize);
+
+    /// Forgets a network, e.g. because it was unloaded. Doesn't count as an eviction.
+    void Remove(NetworkId networkId);
+
+    WorkingMemoryResidencyStats GetStats() const;
+
+private:
+    using LruList = std::list<NetworkId>;
+
+    struct ResidentNetwork
+    {
+        LruList::iterator m_LruPosition;
+        size_t m_WorkingMemorySize;
+    };
+
+    const size_t m_Budget;
+
+    mutable std::mutex m_Mutex;
+
+    /// Resident networks, most recently used first.
+    LruList m_LruList;
+    std::unordered_map<NetworkId, ResidentNetwork> m_ResidentNetworks;
+
+    WorkingMemoryResidencyStats m_Stats;
+};
+
+} // namespace armnn
@@ -36,6 +36,9 @@ public:
     /// @return A vector to the inferred output shape.
     std::vector<TensorShape> InferOutputShapes(const std::vector<TensorShape>& inputShapes) const override;
 
+    /// A reshape never changes the bytes of its input.
+    bool IsOutputViewOfInput() const override { return true; }
+
     /// Indicates if the other layer received is equal to this one.
     /// @param other The other layer to be compared with.
     /// @return true if other layer is equal to this false otherwise.
@@ -9,6 +9,10 @@
 #include <Processes.hpp>
 #include <Runtime.hpp>
 #include <armnn/TypesUtils.hpp>
+#include <Filesystem.hpp>
+#include <LatencyHistogram.hpp>
+#include <Network.hpp>
+#include <backendsCommon/CpuTensorHandle.hpp>
 
 #include <LabelsAndEventClasses.hpp>
 #include <test/ProfilingTestUtils.hpp>
@@ -24,6 +28,12 @@
 #include "RuntimeTests.hpp"
 #include "TestUtils.hpp"
 
+#include <condition_variable>
+#include <fstream>
+#include <future>
+#include <sstream>
+#include <thread>
+
 namespace armnn
 {
 
@@ -32,8 +42,162 @@ void RuntimeLoadedNetworksReserve(armnn::Runtime* runtime)
     runtime->m_LoadedNetworks.reserve(1);
 }
 
+const ConstantTensorStore& GetConstantTensorStore(armnn::Runtime* runtime)
+{
+    return runtime->m_ConstantTensorStore;
+}
+
+}
+
+namespace
+{
+
+// Input [2,4] -> FullyConnected -> Addition (with Constant) -> ReLu -> Output [2,3]
+armnn::INetworkPtr CreateFullyConnectedAddReluNetwork(armnn::NetworkOptions networkOptions = {})
+{
+    using namespace armnn;
+
+    static const std::vector<float> weightsData = {  0.5f, -1.0f,  2.0f,
+                                                     1.0f,  0.0f, -0.5f,
+                                                    -2.0f,  1.5f,  1.0f,
+                                                     0.25f, 1.0f, -1.0f };
+    static const std::vector<float> biasData     = { 0.1f, -0.2f, 0.3f };
+    static const std::vector<float> constantData = { 1.0f, -1.0f, 0.5f, -0.5f, 2.0f, -2.0f };
+
+    TensorInfo inputInfo({ 2, 4 }, DataType::Float32);
+    TensorInfo outputInfo({ 2, 3 }, DataType::Float32);
+
+    INetworkPtr net(INetwork::Create(networkOptions));
+
+    FullyConnectedDescriptor fullyConnectedDesc;
+    fullyConnectedDesc.m_BiasEnabled = true;
+    ConstTensor weights(TensorInfo({ 4, 3 }, DataType::Float32), weightsData);
+    ConstTensor bias(TensorInfo({ 3 }, DataType::Float32), biasData);
+
+    ActivationDescriptor reluDesc;
+    reluDesc.m_Function = ActivationFunction::ReLu;
+
+    IConnectableLayer* input          = net->AddInputLayer(0, "input");
+    IConnectableLayer* fullyConnected = net->AddFullyConnectedLayer(fullyConnectedDesc, weights,
+                                                                    Optional<ConstTensor>(bias), "fc");
+    IConnectableLayer* constant       = net->AddConstantLayer(ConstTensor(outputInfo, constantData), "constant");
+    IConnectableLayer* addition       = net->AddAdditionLayer("add");
+    IConnectableLayer* relu           = net->AddActivationLayer(reluDesc, "relu");
+    IConnectableLayer* output         = net->AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    constant->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    constant->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    addition->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    relu->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    return net;
+}
+
+// Input [batchSize,4] -> FullyConnected -> ReLu -> Output [batchSize,3]
+armnn::INetworkPtr CreateBatchedFullyConnectedReluNetwork(unsigned int batchSize)
+{
+    using namespace armnn;
+
+    static const std::vector<float> weightsData = {  0.5f, -1.0f,  2.0f,
+                                                     1.0f,  0.0f, -0.5f,
+                                                    -2.0f,  1.5f,  1.0f,
+                                                     0.25f, 1.0f, -1.0f };
+    static const std::vector<float> biasData     = { 0.1f, -0.2f, 0.3f };
+
+    TensorInfo inputInfo({ batchSize, 4 }, DataType::Float32);
+    TensorInfo outputInfo({ batchSize, 3 }, DataType::Float32);
+
+    INetworkPtr net(INetwork::Create());
+
+    FullyConnectedDescriptor fullyConnectedDesc;
+    fullyConnectedDesc.m_BiasEnabled = true;
+    ConstTensor weights(TensorInfo({ 4, 3 }, DataType::Float32), weightsData);
+    ConstTensor bias(TensorInfo({ 3 }, DataType::Float32), biasData);
+
+    ActivationDescriptor reluDesc;
+    reluDesc.m_Function = ActivationFunction::ReLu;
+
+    IConnectableLayer* input          = net->AddInputLayer(0, "input");
+    IConnectableLayer* fullyConnected = net->AddFullyConnectedLayer(fullyConnectedDesc, weights,
+                                                                    Optional<ConstTensor>(bias), "fc");
+    IConnectableLayer* relu           = net->AddActivationLayer(reluDesc, "relu");
+    IConnectableLayer* output         = net->AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(fullyConnected->GetInputSlot(0));
+    fullyConnected->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    fullyConnected->GetOutputSlot(0).SetTensorInfo(outputInfo);
+    relu->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    return net;
+}
+
+// Input [2,8] -> four branches of two activations each -> pairwise Additions -> Addition -> Output [2,8]
+armnn::INetworkPtr CreateMultiBranchNetwork()
+{
+    using namespace armnn;
+
+    TensorInfo tensorInfo({ 2, 8 }, DataType::Float32);
+
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input = net->AddInputLayer(0, "input");
+    input->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    const ActivationFunction branchFunctions[] = { ActivationFunction::ReLu,
+                                                   ActivationFunction::Abs,
+                                                   ActivationFunction::TanH,
+                                                   ActivationFunction::Square };
+    std::vector<IConnectableLayer*> branches;
+    for (unsigned int i = 0; i < 4; ++i)
+    {
+        ActivationDescriptor branchDesc;
+        branchDesc.m_Function = branchFunctions[i];
+        ActivationDescriptor linearDesc;
+        linearDesc.m_Function = ActivationFunction::Linear;
+        linearDesc.m_A        = static_cast<float>(i + 1);
+        linearDesc.m_B        = -0.5f;
+
+        IConnectableLayer* activation = net->AddActivationLayer(branchDesc);
+        IConnectableLayer* linear     = net->AddActivationLayer(linearDesc);
+        input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+        activation->GetOutputSlot(0).Connect(linear->GetInputSlot(0));
+        activation->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        linear->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+        branches.push_back(linear);
+    }
+
+    IConnectableLayer* addition01 = net->AddAdditionLayer("add01");
+    IConnectableLayer* addition23 = net->AddAdditionLayer("add23");
+    IConnectableLayer* addition   = net->AddAdditionLayer("add");
+    IConnectableLayer* output     = net->AddOutputLayer(0, "output");
+
+    branches[0]->GetOutputSlot(0).Connect(addition01->GetInputSlot(0));
+    branches[1]->GetOutputSlot(0).Connect(addition01->GetInputSlot(1));
+    branches[2]->GetOutputSlot(0).Connect(addition23->GetInputSlot(0));
+    branches[3]->GetOutputSlot(0).Connect(addition23->GetInputSlot(1));
+    addition01->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    addition23->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    addition01->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    addition23->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+    addition->GetOutputSlot(0).SetTensorInfo(tensorInfo);
+
+    return net;
 }
 
+} // anonymous namespace
+
 BOOST_AUTO_TEST_SUITE(Runtime)
 
 BOOST_AUTO_TEST_CASE(RuntimeUnloadNetwork)
@@ -323,6 +487,1133 @@ BOOST_AUTO_TEST_CASE(RuntimeBackendOptions)
     BOOST_TEST(backendOptions[1].GetOption(0).GetValue().AsInt() == 42);
 }
 
+BOOST_AUTO_TEST_CASE(RuntimeConcurrentWorkingMemHandles)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                    backends,
+                                                    runtime->GetDeviceSpec())) == Status::Success);
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(netId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(netId, 0);
+
+    constexpr unsigned int numThreads    = 4;
+    constexpr unsigned int numInferences = 20;
+
+    auto MakeInput = [&](unsigned int thread, unsigned int inference)
+    {
+        std::vector<float> inputData(inputInfo.GetNumElements());
+        for (unsigned int i = 0; i < inputData.size(); ++i)
+        {
+            inputData[i] = static_cast<float>((thread * 7 + inference * 3 + i) % 11) - 5.0f;
+        }
+        return inputData;
+    };
+
+    // Expected results come from the regular, serialised, EnqueueWorkload path.
+    std::vector<std::vector<std::vector<float>>> expected(numThreads);
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        for (unsigned int n = 0; n < numInferences; ++n)
+        {
+            std::vector<float> inputData = MakeInput(t, n);
+            std::vector<float> outputData(outputInfo.GetNumElements());
+            InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+            OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+            BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+            expected[t].push_back(outputData);
+        }
+    }
+
+    std::vector<std::unique_ptr<IWorkingMemHandle>> workingMemHandles;
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        workingMemHandles.push_back(runtime->CreateWorkingMemHandle(netId));
+        BOOST_TEST(workingMemHandles.back()->GetNetworkId() == netId);
+    }
+
+    std::vector<std::vector<std::vector<float>>> actual(numThreads);
+    std::vector<std::thread> threads;
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        threads.emplace_back([&, t]()
+        {
+            for (unsigned int n = 0; n < numInferences; ++n)
+            {
+                std::vector<float> inputData = MakeInput(t, n);
+                std::vector<float> outputData(outputInfo.GetNumElements());
+                InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+                OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+                if (runtime->Execute(*workingMemHandles[t], inputTensors, outputTensors) == Status::Success)
+                {
+                    actual[t].push_back(outputData);
+                }
+            }
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    for (unsigned int t = 0; t < numThreads; ++t)
+    {
+        BOOST_CHECK(actual[t] == expected[t]);
+    }
+
+    // Freeing the working memory of a handle doesn't prevent it from being used again.
+    {
+        std::lock_guard<std::mutex> lockGuard(workingMemHandles[0]->GetMutex());
+        workingMemHandles[0]->Free();
+        BOOST_TEST(!workingMemHandles[0]->IsAllocated());
+    }
+    std::vector<float> inputData = MakeInput(0, 0);
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+    BOOST_TEST(runtime->Execute(*workingMemHandles[0], inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == expected[0][0], boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeEnqueueWorkloadAsync)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    options.m_AsyncWorkerThreads = 3;
+    options.m_AsyncQueueDepth    = 2;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                    backends,
+                                                    runtime->GetDeviceSpec())) == Status::Success);
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(netId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(netId, 0);
+
+    constexpr unsigned int numInferences = 16;
+
+    std::vector<std::vector<float>> inputData(numInferences, std::vector<float>(inputInfo.GetNumElements()));
+    std::vector<std::vector<float>> expected(numInferences, std::vector<float>(outputInfo.GetNumElements()));
+    for (unsigned int n = 0; n < numInferences; ++n)
+    {
+        for (unsigned int i = 0; i < inputData[n].size(); ++i)
+        {
+            inputData[n][i] = static_cast<float>((n * 5 + i) % 9) - 4.0f;
+        }
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData[n].data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, expected[n].data()) } };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    }
+
+    // Futures
+    std::vector<std::vector<float>> futureOutputs(numInferences, std::vector<float>(outputInfo.GetNumElements()));
+    std::vector<std::future<Status>> futures;
+    for (unsigned int n = 0; n < numInferences; ++n)
+    {
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData[n].data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, futureOutputs[n].data()) } };
+        futures.push_back(runtime->EnqueueWorkloadAsync(netId, inputTensors, outputTensors));
+    }
+    for (unsigned int n = 0; n < numInferences; ++n)
+    {
+        BOOST_TEST(futures[n].get() == Status::Success);
+        BOOST_CHECK(futureOutputs[n] == expected[n]);
+    }
+
+    // Callbacks
+    std::vector<std::vector<float>> callbackOutputs(numInferences, std::vector<float>(outputInfo.GetNumElements()));
+    std::mutex mutex;
+    std::condition_variable completed;
+    unsigned int numSucceeded = 0;
+    unsigned int numCompleted = 0;
+    for (unsigned int n = 0; n < numInferences; ++n)
+    {
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData[n].data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, callbackOutputs[n].data()) } };
+        runtime->EnqueueWorkloadAsync(netId, inputTensors, outputTensors, [&](Status status)
+        {
+            std::lock_guard<std::mutex> lockGuard(mutex);
+            numSucceeded += status == Status::Success ? 1 : 0;
+            ++numCompleted;
+            completed.notify_one();
+        });
+    }
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        completed.wait(lock, [&] { return numCompleted == numInferences; });
+    }
+    BOOST_TEST(numSucceeded == numInferences);
+    BOOST_CHECK(callbackOutputs == expected);
+
+    // Errors are reported through the future.
+    InputTensors badInputTensors{ { 1, ConstTensor(inputInfo, inputData[0].data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(outputInfo, futureOutputs[0].data()) } };
+    BOOST_CHECK_THROW(runtime->EnqueueWorkloadAsync(netId, badInputTensors, outputTensors).get(),
+                      InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeBoundIOTensors)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    // Without import/export the bound tensors are copied, with it they are imported into the network.
+    for (bool importEnabled : { false, true })
+    {
+        NetworkId netId;
+        std::string errorMessage;
+        INetworkProperties networkProperties(importEnabled, importEnabled);
+        BOOST_TEST(runtime->LoadNetwork(netId,
+                                        Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                 backends,
+                                                 runtime->GetDeviceSpec()),
+                                        errorMessage,
+                                        networkProperties) == Status::Success);
+
+        const TensorInfo inputInfo  = runtime->GetInputTensorInfo(netId, 0);
+        const TensorInfo outputInfo = runtime->GetOutputTensorInfo(netId, 0);
+
+        auto FillInput = [](std::vector<float>& inputData, unsigned int inference)
+        {
+            for (unsigned int i = 0; i < inputData.size(); ++i)
+            {
+                inputData[i] = static_cast<float>((inference * 3 + i) % 11) - 5.0f;
+            }
+        };
+
+        std::vector<float> boundInputA(inputInfo.GetNumElements());
+        std::vector<float> boundOutputA(outputInfo.GetNumElements());
+        std::vector<float> boundInputB(inputInfo.GetNumElements());
+        std::vector<float> boundOutputB(outputInfo.GetNumElements());
+
+        IOBindingId bindingA = runtime->BindIOTensors(netId,
+                                                      { { 0, ConstTensor(inputInfo, boundInputA.data()) } },
+                                                      { { 0, Tensor(outputInfo, boundOutputA.data()) } });
+        IOBindingId bindingB = runtime->BindIOTensors(netId,
+                                                      { { 0, ConstTensor(inputInfo, boundInputB.data()) } },
+                                                      { { 0, Tensor(outputInfo, boundOutputB.data()) } });
+        BOOST_TEST(bindingA != bindingB);
+
+        // Bound and unbound inferences are interleaved, so each one has to use its own buffers.
+        for (unsigned int n = 0; n < 6; ++n)
+        {
+            std::vector<float> inputData(inputInfo.GetNumElements());
+            std::vector<float> expectedOutput(outputInfo.GetNumElements());
+            FillInput(inputData, n);
+            BOOST_TEST(runtime->EnqueueWorkload(netId,
+                                                { { 0, ConstTensor(inputInfo, inputData.data()) } },
+                                                { { 0, Tensor(outputInfo, expectedOutput.data()) } })
+                       == Status::Success);
+
+            std::vector<float>& boundInput  = (n % 2 == 0) ? boundInputA : boundInputB;
+            std::vector<float>& boundOutput = (n % 2 == 0) ? boundOutputA : boundOutputB;
+            FillInput(boundInput, n);
+            BOOST_TEST(runtime->EnqueueWorkload(netId, (n % 2 == 0) ? bindingA : bindingB) == Status::Success);
+            BOOST_CHECK(boundOutput == expectedOutput);
+        }
+
+        BOOST_TEST(runtime->UnbindIOTensors(netId, bindingA) == Status::Success);
+        BOOST_TEST(runtime->UnbindIOTensors(netId, bindingA) == Status::Failure);
+        BOOST_CHECK_THROW(runtime->EnqueueWorkload(netId, bindingA), InvalidArgumentException);
+        BOOST_TEST(runtime->EnqueueWorkload(netId, bindingB) == Status::Success);
+
+        BOOST_TEST(runtime->UnloadNetwork(netId) == Status::Success);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeWorkingMemoryResidency)
+{
+    using namespace armnn;
+
+    auto RunInterleaved = [](size_t workingMemoryBudget)
+    {
+        IRuntime::CreationOptions options;
+        options.m_WorkingMemoryBudget = workingMemoryBudget;
+        IRuntimePtr runtime(IRuntime::Create(options));
+
+        std::vector<BackendId> backends = { Compute::CpuRef };
+        NetworkId netIdA;
+        NetworkId netIdB;
+        BOOST_TEST(runtime->LoadNetwork(netIdA, Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                         backends,
+                                                         runtime->GetDeviceSpec())) == Status::Success);
+        BOOST_TEST(runtime->LoadNetwork(netIdB, Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                         backends,
+                                                         runtime->GetDeviceSpec())) == Status::Success);
+
+        const TensorInfo inputInfo  = runtime->GetInputTensorInfo(netIdA, 0);
+        const TensorInfo outputInfo = runtime->GetOutputTensorInfo(netIdA, 0);
+        std::vector<float> inputData(inputInfo.GetNumElements(), 1.0f);
+        std::vector<float> outputData(outputInfo.GetNumElements());
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+
+        for (NetworkId netId : { netIdA, netIdB, netIdA, netIdB, netIdB })
+        {
+            BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        }
+        WorkingMemoryResidencyStats stats = runtime->GetWorkingMemoryResidencyStats();
+
+        // The resident networks are accounted with the memory they have actually acquired.
+        BOOST_TEST(stats.m_ResidentBytes == runtime->GetMemoryUsage(netIdA).m_WorkingBytes +
+                                            runtime->GetMemoryUsage(netIdB).m_WorkingBytes);
+
+        BOOST_TEST(runtime->UnloadNetwork(netIdA) == Status::Success);
+        BOOST_TEST(runtime->UnloadNetwork(netIdB) == Status::Success);
+        BOOST_TEST(runtime->GetWorkingMemoryResidencyStats().m_ResidentBytes == 0);
+
+        return stats;
+    };
+
+    // Without a budget the working memory of each network is only acquired once.
+    WorkingMemoryResidencyStats stats = RunInterleaved(0);
+    BOOST_TEST(stats.m_Hits == 3);
+    BOOST_TEST(stats.m_Misses == 2);
+    BOOST_TEST(stats.m_Evictions == 0);
+    BOOST_TEST(stats.m_ResidentBytes > 0);
+    const size_t singleNetworkBytes = stats.m_ResidentBytes / 2;
+
+    // With room for a single network every switch of network releases the working memory of the previous one.
+    stats = RunInterleaved(1);
+    BOOST_TEST(stats.m_Hits == 1);
+    BOOST_TEST(stats.m_Misses == 4);
+    BOOST_TEST(stats.m_Evictions == 3);
+    BOOST_TEST(stats.m_ResidentBytes == singleNetworkBytes);
+
+    // With room for both networks their working memory is only acquired once.
+    stats = RunInterleaved(2 * singleNetworkBytes);
+    BOOST_TEST(stats.m_Hits == 3);
+    BOOST_TEST(stats.m_Misses == 2);
+    BOOST_TEST(stats.m_Evictions == 0);
+    BOOST_TEST(stats.m_ResidentBytes == 2 * singleNetworkBytes);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeParallelWorkloadExecution)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    std::string errorMessage;
+
+    NetworkId sequentialNetId;
+    BOOST_TEST(runtime->LoadNetwork(sequentialNetId, Optimize(*CreateMultiBranchNetwork(),
+                                                              backends,
+                                                              runtime->GetDeviceSpec())) == Status::Success);
+
+    NetworkId parallelNetId;
+    INetworkProperties parallelProperties(false, false, 4);
+    BOOST_TEST(runtime->LoadNetwork(parallelNetId,
+                                    Optimize(*CreateMultiBranchNetwork(), backends, runtime->GetDeviceSpec()),
+                                    errorMessage,
+                                    parallelProperties) == Status::Success);
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(sequentialNetId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(sequentialNetId, 0);
+
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(parallelNetId);
+
+    for (unsigned int n = 0; n < 10; ++n)
+    {
+        std::vector<float> inputData(inputInfo.GetNumElements());
+        for (unsigned int i = 0; i < inputData.size(); ++i)
+        {
+            inputData[i] = static_cast<float>((n * 5 + i) % 9) * 0.5f - 2.0f;
+        }
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+
+        std::vector<float> expectedOutput(outputInfo.GetNumElements());
+        BOOST_TEST(runtime->EnqueueWorkload(sequentialNetId,
+                                            inputTensors,
+                                            { { 0, Tensor(outputInfo, expectedOutput.data()) } }) == Status::Success);
+
+        std::vector<float> parallelOutput(outputInfo.GetNumElements());
+        BOOST_TEST(runtime->EnqueueWorkload(parallelNetId,
+                                            inputTensors,
+                                            { { 0, Tensor(outputInfo, parallelOutput.data()) } }) == Status::Success);
+        BOOST_CHECK(parallelOutput == expectedOutput);
+
+        std::vector<float> handleOutput(outputInfo.GetNumElements());
+        BOOST_TEST(runtime->Execute(*workingMemHandle,
+                                    inputTensors,
+                                    { { 0, Tensor(outputInfo, handleOutput.data()) } }) == Status::Success);
+        BOOST_CHECK(handleOutput == expectedOutput);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RuntimePipelinedExecution)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    std::string errorMessage;
+
+    NetworkId sequentialNetId;
+    BOOST_TEST(runtime->LoadNetwork(sequentialNetId, Optimize(*CreateMultiBranchNetwork(),
+                                                              backends,
+                                                              runtime->GetDeviceSpec())) == Status::Success);
+
+    NetworkId pipelinedNetId;
+    INetworkProperties pipelinedProperties(false, false, 0, 3);
+    BOOST_TEST(runtime->LoadNetwork(pipelinedNetId,
+                                    Optimize(*CreateMultiBranchNetwork(), backends, runtime->GetDeviceSpec()),
+                                    errorMessage,
+                                    pipelinedProperties) == Status::Success);
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(sequentialNetId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(sequentialNetId, 0);
+
+    constexpr unsigned int numFrames = 20;
+
+    std::vector<std::vector<float>> inputData(numFrames, std::vector<float>(inputInfo.GetNumElements()));
+    std::vector<std::vector<float>> expected(numFrames, std::vector<float>(outputInfo.GetNumElements()));
+    for (unsigned int n = 0; n < numFrames; ++n)
+    {
+        for (unsigned int i = 0; i < inputData[n].size(); ++i)
+        {
+            inputData[n][i] = static_cast<float>((n * 7 + i) % 11) * 0.5f - 2.5f;
+        }
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData[n].data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, expected[n].data()) } };
+        BOOST_TEST(runtime->EnqueueWorkload(sequentialNetId, inputTensors, outputTensors) == Status::Success);
+    }
+
+    // Frames pushed back-to-back overlap in the pipeline and complete in submission order.
+    std::vector<std::vector<float>> outputs(numFrames, std::vector<float>(outputInfo.GetNumElements()));
+    std::vector<std::future<Status>> futures;
+    for (unsigned int n = 0; n < numFrames; ++n)
+    {
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData[n].data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputs[n].data()) } };
+        futures.push_back(runtime->EnqueueWorkloadAsync(pipelinedNetId, inputTensors, outputTensors));
+    }
+    for (unsigned int n = 0; n < numFrames; ++n)
+    {
+        BOOST_TEST(futures[n].get() == Status::Success);
+        BOOST_CHECK(outputs[n] == expected[n]);
+    }
+
+    std::vector<unsigned int> completionOrder;
+    std::vector<std::vector<float>> callbackOutputs(numFrames, std::vector<float>(outputInfo.GetNumElements()));
+    for (unsigned int n = 0; n < numFrames; ++n)
+    {
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData[n].data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, callbackOutputs[n].data()) } };
+        runtime->EnqueueWorkloadAsync(pipelinedNetId, inputTensors, outputTensors,
+                                      [&completionOrder, n](Status status)
+        {
+            // Callbacks all run on the last stage's thread.
+            if (status == Status::Success)
+            {
+                completionOrder.push_back(n);
+            }
+            // Exceptions of any type thrown by the callback don't stop the pipeline.
+            if (n % 2 == 1)
+            {
+                throw n;
+            }
+        });
+    }
+
+    // Unloading waits for the frames in flight.
+    BOOST_TEST(runtime->UnloadNetwork(pipelinedNetId) == Status::Success);
+    BOOST_TEST(completionOrder.size() == numFrames);
+    for (unsigned int n = 0; n < completionOrder.size(); ++n)
+    {
+        BOOST_TEST(completionOrder[n] == n);
+    }
+    BOOST_CHECK(callbackOutputs == expected);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeDynamicBatching)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*CreateBatchedFullyConnectedReluNetwork(1),
+                                                    backends,
+                                                    runtime->GetDeviceSpec())) == Status::Success);
+    NetworkId batchedNetId;
+    BOOST_TEST(runtime->LoadNetwork(batchedNetId, Optimize(*CreateBatchedFullyConnectedReluNetwork(4),
+                                                           backends,
+                                                           runtime->GetDeviceSpec())) == Status::Success);
+    NetworkId otherNetId;
+    BOOST_TEST(runtime->LoadNetwork(otherNetId, Optimize(*CreateMultiBranchNetwork(),
+                                                         backends,
+                                                         runtime->GetDeviceSpec())) == Status::Success);
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(netId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(netId, 0);
+
+    constexpr unsigned int numSamples = 10;
+
+    std::vector<std::vector<float>> inputData(numSamples, std::vector<float>(inputInfo.GetNumElements()));
+    std::vector<std::vector<float>> expected(numSamples, std::vector<float>(outputInfo.GetNumElements()));
+    for (unsigned int n = 0; n < numSamples; ++n)
+    {
+        for (unsigned int i = 0; i < inputData[n].size(); ++i)
+        {
+            inputData[n][i] = static_cast<float>((n * 3 + i) % 7) * 0.75f - 2.0f;
+        }
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData[n].data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, expected[n].data()) } };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    }
+
+    // Only networks differing by their batch size can be batched.
+    BOOST_TEST(runtime->EnableDynamicBatching(netId, otherNetId) == Status::Failure);
+    BOOST_TEST(runtime->EnableDynamicBatching(batchedNetId, netId) == Status::Failure);
+
+    DynamicBatchingOptions batchingOptions;
+    batchingOptions.m_Timeout = std::chrono::milliseconds(20);
+    BOOST_TEST(runtime->EnableDynamicBatching(netId, batchedNetId, batchingOptions) == Status::Success);
+
+    // Concurrent samples, whose batches are completed by the timeout when fewer than 4 samples are waiting.
+    std::vector<std::vector<float>> outputs(numSamples, std::vector<float>(outputInfo.GetNumElements()));
+    std::vector<std::thread> threads;
+    std::vector<Status> statuses(numSamples, Status::Failure);
+    for (unsigned int n = 0; n < numSamples; ++n)
+    {
+        threads.emplace_back([&, n]()
+        {
+            InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData[n].data()) } };
+            OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputs[n].data()) } };
+            statuses[n] = runtime->EnqueueWorkload(netId, inputTensors, outputTensors);
+        });
+    }
+    for (auto&& thread : threads)
+    {
+        thread.join();
+    }
+    for (unsigned int n = 0; n < numSamples; ++n)
+    {
+        BOOST_TEST(statuses[n] == Status::Success);
+        BOOST_CHECK(outputs[n] == expected[n]);
+    }
+
+    // A sample on its own.
+    std::vector<float> output(outputInfo.GetNumElements());
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData[3].data()) } };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, { { 0, Tensor(outputInfo, output.data()) } })
+               == Status::Success);
+    BOOST_CHECK(output == expected[3]);
+
+    // Invalid samples are rejected before joining a batch.
+    InputTensors badInputTensors{ { 1, ConstTensor(inputInfo, inputData[0].data()) } };
+    BOOST_CHECK_THROW(runtime->EnqueueWorkload(netId, badInputTensors, { { 0, Tensor(outputInfo, output.data()) } }),
+                      InvalidArgumentException);
+
+    // Unloading the batched network stops the batching.
+    BOOST_TEST(runtime->UnloadNetwork(batchedNetId) == Status::Success);
+    BOOST_TEST(runtime->DisableDynamicBatching(netId) == Status::Failure);
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, { { 0, Tensor(outputInfo, output.data()) } })
+               == Status::Success);
+    BOOST_CHECK(output == expected[3]);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeOptimizedNetworkCache)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    INetworkPtr net = CreateFullyConnectedAddReluNetwork();
+    const TensorInfo inputInfo({ 2, 4 }, DataType::Float32);
+    const TensorInfo outputInfo({ 2, 3 }, DataType::Float32);
+    const std::vector<float> inputData = { 1.0f, -2.0f, 0.5f, 3.0f, -1.0f, 0.25f, 2.0f, -0.5f };
+
+    auto Run = [&](IOptimizedNetworkPtr optNet)
+    {
+        NetworkId netId;
+        BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+        std::vector<float> output(outputInfo.GetNumElements());
+        InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, output.data()) } };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        runtime->UnloadNetwork(netId);
+        return output;
+    };
+
+    const std::vector<float> expected = Run(Optimize(*net, backends, runtime->GetDeviceSpec()));
+
+    // An optimized network written to a stream and read back behaves like the original.
+    std::stringstream stream;
+    SaveOptimizedNetwork(*Optimize(*net, backends, runtime->GetDeviceSpec()), stream);
+    const std::string savedNetwork = stream.str();
+    BOOST_CHECK(Run(LoadOptimizedNetwork(stream)) == expected);
+
+    std::stringstream truncatedStream(savedNetwork.substr(0, savedNetwork.size() / 2));
+    BOOST_CHECK_THROW(LoadOptimizedNetwork(truncatedStream), ParseException);
+
+    // A length past the end of the stream, here the one of the version string following the magic and the format
+    // version, is reported rather than allocated.
+    std::string corruptNetwork = savedNetwork;
+    std::fill(corruptNetwork.begin() + 12, corruptNetwork.begin() + 20, '\x7f');
+    std::stringstream corruptStream(corruptNetwork);
+    BOOST_CHECK_THROW(LoadOptimizedNetwork(corruptStream), ParseException);
+
+    // The first optimization with a cache directory fills the cache, the next ones are read from it.
+    fs::path cacheDirectory = armnnUtils::Filesystem::NamedTempFile("Armnn-RuntimeOptimizedNetworkCache");
+    fs::remove_all(cacheDirectory);
+    fs::create_directories(cacheDirectory);
+
+    OptimizerOptions optimizerOptions;
+    optimizerOptions.m_CachedNetworkDirectory = cacheDirectory.string();
+    BOOST_CHECK(Run(Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions)) == expected);
+
+    std::vector<fs::path> cachedFiles(fs::directory_iterator(cacheDirectory), fs::directory_iterator{});
+    BOOST_TEST(cachedFiles.size() == 1);
+    BOOST_TEST(cachedFiles[0].extension().string() == ".armnnopt");
+
+    // Shows the cache is used by replacing its content with another network.
+    {
+        std::ofstream cachedFile(cachedFiles[0].string(), std::ios::binary);
+        SaveOptimizedNetwork(*Optimize(*CreateBatchedFullyConnectedReluNetwork(1), backends,
+                                       runtime->GetDeviceSpec()), cachedFile);
+    }
+    NetworkId cachedNetId;
+    BOOST_TEST(runtime->LoadNetwork(cachedNetId, Optimize(*net, backends, runtime->GetDeviceSpec(),
+                                                          optimizerOptions)) == Status::Success);
+    BOOST_TEST(runtime->GetInputTensorInfo(cachedNetId, 0).GetShape()[0] == 1);
+    runtime->UnloadNetwork(cachedNetId);
+
+    // Other options use another entry.
+    optimizerOptions.m_ImportEnabled = true;
+    BOOST_CHECK(Run(Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions)) == expected);
+    BOOST_TEST(std::distance(fs::directory_iterator(cacheDirectory), fs::directory_iterator{}) == 2);
+    optimizerOptions.m_ImportEnabled = false;
+
+    // So do the backend options the network was created with.
+    INetworkPtr netWithOptions = CreateFullyConnectedAddReluNetwork({ BackendOptions("CpuRef", { { "Option", 1 } }) });
+    BOOST_CHECK(Run(Optimize(*netWithOptions, backends, runtime->GetDeviceSpec(), optimizerOptions)) == expected);
+    BOOST_TEST(std::distance(fs::directory_iterator(cacheDirectory), fs::directory_iterator{}) == 3);
+
+    // A corrupted entry is ignored and replaced.
+    {
+        std::ofstream cachedFile(cachedFiles[0].string(), std::ios::binary);
+        cachedFile << savedNetwork.substr(0, savedNetwork.size() / 2);
+    }
+    BOOST_CHECK(Run(Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions)) == expected);
+    std::ifstream cachedFile(cachedFiles[0].string(), std::ios::binary);
+    BOOST_CHECK(Run(LoadOptimizedNetwork(cachedFile)) == expected);
+
+    fs::remove_all(cacheDirectory);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeInferenceStatistics)
+{
+    using namespace armnn;
+
+    // Percentiles are reported within 1/32 of the recorded durations.
+    LatencyHistogram histogram;
+    for (int64_t i = 1; i <= 1000; ++i)
+    {
+        histogram.Record(std::chrono::microseconds(i));
+    }
+    const std::vector<std::chrono::nanoseconds> percentiles = histogram.GetPercentiles({ 0.0, 50.0, 99.0, 100.0 });
+    BOOST_TEST(histogram.GetCount() == 1000);
+    BOOST_TEST(histogram.GetMean().count() == 500500);
+    BOOST_TEST(histogram.GetMax().count() == 1000000);
+    BOOST_TEST(percentiles[0].count() >= 1000);
+    BOOST_TEST(percentiles[0].count() <= 1000 + 1000 / 32);
+    BOOST_TEST(percentiles[1].count() >= 500000);
+    BOOST_TEST(percentiles[1].count() <= 500000 + 500000 / 32);
+    BOOST_TEST(percentiles[2].count() >= 990000);
+    BOOST_TEST(percentiles[2].count() <= 990000 + 990000 / 32);
+    BOOST_TEST(percentiles[3].count() == 1000000);
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                    backends,
+                                                    runtime->GetDeviceSpec())) == Status::Success);
+
+    InferenceStatistics statistics = runtime->GetInferenceStatistics(netId);
+    BOOST_TEST(statistics.m_NumInferences == 0);
+    BOOST_TEST(statistics.m_MaxLatency.count() == 0);
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(netId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(netId, 0);
+    std::vector<float> inputData(inputInfo.GetNumElements(), 1.0f);
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+
+    const unsigned int numInferences = 20;
+    for (unsigned int i = 0; i < numInferences; ++i)
+    {
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    }
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+    BOOST_TEST(runtime->Execute(*workingMemHandle, inputTensors, outputTensors) == Status::Success);
+
+    statistics = runtime->GetInferenceStatistics(netId);
+    BOOST_TEST(statistics.m_NumInferences == numInferences + 1);
+    BOOST_TEST(statistics.m_NumFailedInferences == 0);
+    BOOST_TEST(statistics.m_Throughput > 0.0);
+    BOOST_TEST(statistics.m_MaxLatency.count() > 0);
+    BOOST_TEST(statistics.m_MeanLatency.count() <= statistics.m_MaxLatency.count());
+    BOOST_TEST(statistics.m_P50Latency.count() <= statistics.m_P95Latency.count());
+    BOOST_TEST(statistics.m_P95Latency.count() <= statistics.m_P99Latency.count());
+    BOOST_TEST(statistics.m_P99Latency.count() <= statistics.m_MaxLatency.count());
+
+    BOOST_CHECK_THROW(runtime->GetInferenceStatistics(netId + 1), std::out_of_range);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeOutputSubset)
+{
+    using namespace armnn;
+
+    // input -> ReLu -> output 0
+    //       -> Abs  -> output 1
+    INetworkPtr net(INetwork::Create());
+    const TensorInfo info({ 1, 4 }, DataType::Float32);
+
+    IConnectableLayer* input = net->AddInputLayer(0);
+    ActivationDescriptor reluDescriptor;
+    reluDescriptor.m_Function = ActivationFunction::ReLu;
+    IConnectableLayer* relu = net->AddActivationLayer(reluDescriptor, "relu");
+    ActivationDescriptor absDescriptor;
+    absDescriptor.m_Function = ActivationFunction::Abs;
+    IConnectableLayer* abs = net->AddActivationLayer(absDescriptor, "abs");
+    IConnectableLayer* reluOutput = net->AddOutputLayer(0);
+    IConnectableLayer* absOutput = net->AddOutputLayer(1);
+
+    input->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    input->GetOutputSlot(0).Connect(abs->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(reluOutput->GetInputSlot(0));
+    abs->GetOutputSlot(0).Connect(absOutput->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    relu->GetOutputSlot(0).SetTensorInfo(info);
+    abs->GetOutputSlot(0).SetTensorInfo(info);
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // Debug layers report the layers which ran through the debug callback.
+    OptimizerOptions optimizerOptions(false, true);
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    const std::vector<float> inputData = { -2.0f, -1.0f, 1.0f, 2.0f };
+    InputTensors inputTensors{ { 0, ConstTensor(info, inputData.data()) } };
+    const std::vector<float> expectedRelu = { 0.0f, 0.0f, 1.0f, 2.0f };
+    const std::vector<float> expectedAbs = { 2.0f, 1.0f, 1.0f, 2.0f };
+
+    for (unsigned int numWorkloadThreads : { 0u, 2u })
+    {
+        NetworkId netId;
+        std::string errorMessage;
+        INetworkProperties networkProperties(false, false, numWorkloadThreads);
+        BOOST_TEST(runtime->LoadNetwork(netId,
+                                        Optimize(*net, backends, runtime->GetDeviceSpec(), optimizerOptions),
+                                        errorMessage,
+                                        networkProperties) == Status::Success);
+
+        std::atomic<unsigned int> numDebugCalls(0);
+        runtime->RegisterDebugCallback(netId, [&numDebugCalls](LayerGuid, unsigned int, ITensorHandle*)
+        {
+            ++numDebugCalls;
+        });
+
+        std::vector<float> reluData(4, -1.0f);
+        std::vector<float> absData(4, -1.0f);
+        OutputTensors reluTensors{ { 0, Tensor(info, reluData.data()) } };
+        OutputTensors absTensors{ { 1, Tensor(info, absData.data()) } };
+
+        // All outputs: the input, ReLu and Abs layers run.
+        OutputTensors allTensors{ { 0, Tensor(info, reluData.data()) }, { 1, Tensor(info, absData.data()) } };
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, allTensors) == Status::Success);
+        BOOST_TEST(numDebugCalls == 3);
+        BOOST_CHECK(reluData == expectedRelu);
+        BOOST_CHECK(absData == expectedAbs);
+
+        // Only the Abs branch runs for output 1, and the other output is left untouched.
+        numDebugCalls = 0;
+        std::fill(reluData.begin(), reluData.end(), -1.0f);
+        std::fill(absData.begin(), absData.end(), -1.0f);
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, absTensors) == Status::Success);
+        BOOST_TEST(numDebugCalls == 2);
+        BOOST_CHECK(absData == expectedAbs);
+        BOOST_CHECK(reluData == std::vector<float>(4, -1.0f));
+
+        // The same with tensors bound once.
+        numDebugCalls = 0;
+        IOBindingId ioBindingId = runtime->BindIOTensors(netId, inputTensors, reluTensors);
+        BOOST_TEST(runtime->EnqueueWorkload(netId, ioBindingId) == Status::Success);
+        BOOST_TEST(numDebugCalls == 2);
+        BOOST_CHECK(reluData == expectedRelu);
+        BOOST_CHECK(absData == expectedAbs);
+        BOOST_TEST(runtime->UnbindIOTensors(netId, ioBindingId) == Status::Success);
+
+        OutputTensors unknownTensors{ { 2, Tensor(info, absData.data()) } };
+        BOOST_CHECK_THROW(runtime->EnqueueWorkload(netId, inputTensors, unknownTensors), InvalidArgumentException);
+
+        runtime->UnloadNetwork(netId);
+    }
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeCancelInference)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // Debug layers report the layers which ran through the debug callback.
+    OptimizerOptions optimizerOptions(false, true);
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                    backends,
+                                                    runtime->GetDeviceSpec(),
+                                                    optimizerOptions)) == Status::Success);
+
+    auto token = std::make_shared<CancellationToken>();
+    unsigned int numDebugCalls = 0;
+    bool cancelOnDebugCall = false;
+    runtime->RegisterDebugCallback(netId, [&](LayerGuid, unsigned int, ITensorHandle*)
+    {
+        ++numDebugCalls;
+        if (cancelOnDebugCall)
+        {
+            token->Cancel();
+        }
+    });
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(netId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(netId, 0);
+    std::vector<float> inputData(inputInfo.GetNumElements(), 1.0f);
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+
+    // Neither a deadline in the future nor a token which isn't cancelled stop an inference.
+    CancellationOptions cancellationOptions;
+    cancellationOptions.m_Deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+    cancellationOptions.m_CancellationToken = token;
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors, cancellationOptions) == Status::Success);
+    const unsigned int numLayers = numDebugCalls;
+    BOOST_TEST(numLayers > 1);
+
+    // A token cancelled while the first layer runs stops the inference before the next one.
+    numDebugCalls = 0;
+    cancelOnDebugCall = true;
+    Status status = runtime->EnqueueWorkload(netId, inputTensors, outputTensors, cancellationOptions);
+    BOOST_TEST(status == Status::Cancelled);
+    BOOST_TEST(numDebugCalls == 1);
+    BOOST_TEST(std::string(GetStatusAsCString(status)) == "Status::Cancelled");
+
+    numDebugCalls = 0;
+    cancelOnDebugCall = false;
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors, cancellationOptions) == Status::Cancelled);
+    BOOST_TEST(numDebugCalls == 0);
+
+    // So does a deadline which has passed.
+    CancellationOptions expiredOptions;
+    expiredOptions.m_Deadline = std::chrono::steady_clock::now();
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors, expiredOptions) == Status::Cancelled);
+    BOOST_TEST(numDebugCalls == 0);
+
+    InferenceStatistics statistics = runtime->GetInferenceStatistics(netId);
+    BOOST_TEST(statistics.m_NumInferences == 4);
+    BOOST_TEST(statistics.m_NumCancelledInferences == 3);
+    BOOST_TEST(statistics.m_NumFailedInferences == 0);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeUpdateLayerWeights)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                    backends,
+                                                    runtime->GetDeviceSpec())) == Status::Success);
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(netId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(netId, 0);
+    const std::vector<float> inputData = { 1.0f, -2.0f, 0.5f, 3.0f, -1.0f, 0.25f, 2.0f, -0.5f };
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    const std::vector<float> originalOutput = outputData;
+
+    // With zero weights the fully connected layer outputs its biases, to which the constant is added.
+    const std::vector<float> weightsData(12, 0.0f);
+    const std::vector<float> biasData = { 1.0f, 2.0f, 3.0f };
+    const ConstTensor weights(TensorInfo({ 4, 3 }, DataType::Float32), weightsData);
+    const ConstTensor bias(TensorInfo({ 3 }, DataType::Float32), biasData);
+    BOOST_TEST(runtime->UpdateLayerWeights(netId, "fc", weights, Optional<ConstTensor>(bias)) == Status::Success);
+
+    const std::vector<float> expectedOutput = { 2.0f, 1.0f, 3.5f, 0.5f, 4.0f, 1.0f };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_CHECK(outputData == expectedOutput);
+
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+    std::fill(outputData.begin(), outputData.end(), 0.0f);
+    BOOST_TEST(runtime->Execute(*workingMemHandle, inputTensors, outputTensors) == Status::Success);
+    BOOST_CHECK(outputData == expectedOutput);
+
+    // Tensors which don't match are rejected without changing anything.
+    const std::vector<float> wrongBiasData = { 1.0f, 2.0f };
+    const ConstTensor wrongBias(TensorInfo({ 2 }, DataType::Float32), wrongBiasData);
+    const ConstTensor wrongWeights(TensorInfo({ 3, 4 }, DataType::Float32), weightsData);
+    BOOST_CHECK_THROW(runtime->UpdateLayerWeights(netId, "fc", weights, Optional<ConstTensor>(wrongBias)),
+                      InvalidArgumentException);
+    BOOST_CHECK_THROW(runtime->UpdateLayerWeights(netId, "fc", wrongWeights, EmptyOptional()),
+                      InvalidArgumentException);
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_CHECK(outputData == expectedOutput);
+
+    BOOST_TEST(runtime->UpdateLayerWeights(netId, "relu", weights, EmptyOptional()) == Status::Failure);
+    BOOST_TEST(runtime->UpdateLayerWeights(netId, "missing", weights, EmptyOptional()) == Status::Failure);
+
+    // Restoring the original tensors restores the original results.
+    const std::vector<float> originalWeightsData = {  0.5f, -1.0f,  2.0f,
+                                                      1.0f,  0.0f, -0.5f,
+                                                     -2.0f,  1.5f,  1.0f,
+                                                      0.25f, 1.0f, -1.0f };
+    const std::vector<float> originalBiasData = { 0.1f, -0.2f, 0.3f };
+    const ConstTensor originalWeights(TensorInfo({ 4, 3 }, DataType::Float32), originalWeightsData);
+    const ConstTensor originalBias(TensorInfo({ 3 }, DataType::Float32), originalBiasData);
+    BOOST_TEST(runtime->UpdateLayerWeights(netId, "fc", originalWeights, EmptyOptional()) == Status::Success);
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_CHECK(outputData != originalOutput);
+
+    BOOST_TEST(runtime->UpdateLayerWeights(netId, "fc", originalWeights, Optional<ConstTensor>(originalBias)) ==
+               Status::Success);
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_CHECK(outputData == originalOutput);
+
+    // The inferences in flight in a pipeline complete with the weights they started with, the next ones use the
+    // updated weights.
+    NetworkId pipelinedNetId;
+    std::string errorMessage;
+    INetworkProperties pipelinedProperties(false, false, 0, 2);
+    BOOST_TEST(runtime->LoadNetwork(pipelinedNetId,
+                                    Optimize(*CreateFullyConnectedAddReluNetwork(), backends, runtime->GetDeviceSpec()),
+                                    errorMessage,
+                                    pipelinedProperties) == Status::Success);
+
+    constexpr unsigned int numFrames = 8;
+    std::vector<std::vector<float>> outputs(numFrames, std::vector<float>(outputInfo.GetNumElements()));
+    std::vector<std::future<Status>> futures;
+    for (unsigned int n = 0; n < numFrames; ++n)
+    {
+        futures.push_back(runtime->EnqueueWorkloadAsync(pipelinedNetId, inputTensors,
+                                                        { { 0, Tensor(outputInfo, outputs[n].data()) } }));
+    }
+    BOOST_TEST(runtime->UpdateLayerWeights(pipelinedNetId, "fc", weights, Optional<ConstTensor>(bias)) ==
+               Status::Success);
+    for (unsigned int n = 0; n < numFrames; ++n)
+    {
+        BOOST_TEST(futures[n].get() == Status::Success);
+        BOOST_CHECK(outputs[n] == originalOutput || outputs[n] == expectedOutput);
+    }
+    BOOST_TEST(runtime->EnqueueWorkloadAsync(pipelinedNetId, inputTensors, outputTensors).get() == Status::Success);
+    BOOST_CHECK(outputData == expectedOutput);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeShareConstantTensors)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    armnn::Runtime runtime(options);
+    const ConstantTensorStore& constantTensorStore = GetConstantTensorStore(&runtime);
+
+    // Each instance of the network holds the weights and biases of its fully connected layer, 60 bytes in all.
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    constexpr unsigned int numInstances = 3;
+    std::vector<NetworkId> netIds(numInstances);
+    for (NetworkId& netId : netIds)
+    {
+        BOOST_TEST(runtime.LoadNetwork(netId, Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                       backends,
+                                                       runtime.GetDeviceSpec())) == Status::Success);
+        BOOST_TEST(constantTensorStore.GetNumTensors() == 2);
+        BOOST_TEST(constantTensorStore.GetNumBytes() == 60);
+    }
+
+    const TensorInfo inputInfo  = runtime.GetInputTensorInfo(netIds[0], 0);
+    const TensorInfo outputInfo = runtime.GetOutputTensorInfo(netIds[0], 0);
+    const std::vector<float> inputData = { 1.0f, -2.0f, 0.5f, 3.0f, -1.0f, 0.25f, 2.0f, -0.5f };
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+
+    std::vector<std::vector<float>> outputData(numInstances, std::vector<float>(outputInfo.GetNumElements()));
+    for (unsigned int i = 0; i < numInstances; ++i)
+    {
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData[i].data()) } };
+        BOOST_TEST(runtime.EnqueueWorkload(netIds[i], inputTensors, outputTensors) == Status::Success);
+        BOOST_CHECK(outputData[i] == outputData[0]);
+    }
+
+    // Updating the weights of an instance gives it its own copy, leaving the other instances unchanged.
+    const std::vector<float> weightsData(12, 0.0f);
+    const ConstTensor weights(TensorInfo({ 4, 3 }, DataType::Float32), weightsData);
+    BOOST_TEST(runtime.UpdateLayerWeights(netIds[0], "fc", weights, EmptyOptional()) == Status::Success);
+
+    std::vector<float> updatedOutputData(outputInfo.GetNumElements());
+    OutputTensors updatedOutputTensors{ { 0, Tensor(outputInfo, updatedOutputData.data()) } };
+    BOOST_TEST(runtime.EnqueueWorkload(netIds[0], inputTensors, updatedOutputTensors) == Status::Success);
+    BOOST_CHECK(updatedOutputData != outputData[0]);
+    BOOST_TEST(runtime.EnqueueWorkload(netIds[1], inputTensors, updatedOutputTensors) == Status::Success);
+    BOOST_CHECK(updatedOutputData == outputData[0]);
+    BOOST_TEST(constantTensorStore.GetNumTensors() == 2);
+
+    for (NetworkId netId : netIds)
+    {
+        BOOST_TEST(runtime.UnloadNetwork(netId) == Status::Success);
+    }
+    BOOST_TEST(constantTensorStore.GetNumTensors() == 0);
+    BOOST_TEST(constantTensorStore.GetNumBytes() == 0);
+
+    // Networks don't share anything unless enabled.
+    options.m_ShareConstantTensors = false;
+    armnn::Runtime unsharedRuntime(options);
+    NetworkId netId;
+    BOOST_TEST(unsharedRuntime.LoadNetwork(netId, Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                           backends,
+                                                           unsharedRuntime.GetDeviceSpec())) == Status::Success);
+    BOOST_TEST(GetConstantTensorStore(&unsharedRuntime).GetNumTensors() == 0);
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeConstantTensorsAreNotCopied)
+{
+    using namespace armnn;
+
+    auto GetFullyConnectedWeights = [](const Graph& graph) -> ScopedCpuTensorHandle&
+    {
+        for (auto&& layer : graph)
+        {
+            if (layer->GetType() == LayerType::FullyConnected)
+            {
+                return *PolymorphicDowncast<const FullyConnectedLayer*>(layer)->m_Weight;
+            }
+        }
+        throw InvalidArgumentException("No fully connected layer");
+    };
+
+    // The optimized network and the workloads share the weights held by the network.
+    INetworkPtr net = CreateFullyConnectedAddReluNetwork();
+    ScopedCpuTensorHandle& weights = GetFullyConnectedWeights(PolymorphicDowncast<Network*>(net.get())->GetGraph());
+    const std::vector<float> originalWeightsData(weights.GetConstTensor<float>(),
+                                                 weights.GetConstTensor<float>() + 12);
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+    ScopedCpuTensorHandle& optimizedWeights =
+        GetFullyConnectedWeights(PolymorphicDowncast<OptimizedNetwork*>(optNet.get())->GetGraph());
+    BOOST_TEST(optimizedWeights.GetConstTensor<void>() == weights.GetConstTensor<void>());
+    {
+        const ScopedCpuTensorHandle workloadWeights(static_cast<const ConstCpuTensorHandle&>(optimizedWeights));
+        BOOST_TEST(workloadWeights.GetConstTensor<void>() == weights.GetConstTensor<void>());
+    }
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, std::move(optNet)) == Status::Success);
+    BOOST_TEST(weights.GetSharedMemory().use_count() == 2);
+
+    // Updating the weights of the loaded network leaves those of the network alone.
+    const std::vector<float> newWeightsData(12, 0.0f);
+    const ConstTensor newWeights(TensorInfo({ 4, 3 }, DataType::Float32), newWeightsData);
+    BOOST_TEST(runtime->UpdateLayerWeights(netId, "fc", newWeights, EmptyOptional()) == Status::Success);
+    BOOST_TEST(weights.GetSharedMemory().use_count() == 1);
+    BOOST_TEST(std::vector<float>(weights.GetConstTensor<float>(), weights.GetConstTensor<float>() + 12) ==
+               originalWeightsData, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RuntimeMemoryUsage)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<BackendId> backends = { Compute::CpuRef };
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*CreateFullyConnectedAddReluNetwork(),
+                                                    backends,
+                                                    runtime->GetDeviceSpec())) == Status::Success);
+
+    // The weights, bias and constant tensors are held from the start, the working memory only once used.
+    NetworkMemoryUsage memoryUsage = runtime->GetMemoryUsage(netId);
+    BOOST_TEST(memoryUsage.m_ConstantBytes == (12 + 3 + 6) * sizeof(float));
+    BOOST_TEST(memoryUsage.m_WorkingBytes == 0);
+    BOOST_TEST(memoryUsage.m_PeakWorkingBytes == 0);
+    BOOST_TEST(memoryUsage.m_ImportedBytes == 0);
+
+    const TensorInfo inputInfo  = runtime->GetInputTensorInfo(netId, 0);
+    const TensorInfo outputInfo = runtime->GetOutputTensorInfo(netId, 0);
+    std::vector<float> inputData(inputInfo.GetNumElements(), 1.0f);
+    std::vector<float> outputData(outputInfo.GetNumElements());
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    memoryUsage = runtime->GetMemoryUsage(netId);
+    const size_t enqueueWorkingBytes = memoryUsage.m_WorkingBytes;
+    BOOST_TEST(enqueueWorkingBytes > 0);
+    BOOST_TEST(memoryUsage.m_PeakWorkingBytes == enqueueWorkingBytes);
+
+    // Working memory handles add their memory to that of the network for as long as they live.
+    {
+        std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+        BOOST_TEST(runtime->Execute(*workingMemHandle, inputTensors, outputTensors) == Status::Success);
+        memoryUsage = runtime->GetMemoryUsage(netId);
+        BOOST_TEST(memoryUsage.m_WorkingBytes > enqueueWorkingBytes);
+        BOOST_TEST(memoryUsage.m_PeakWorkingBytes == memoryUsage.m_WorkingBytes);
+    }
+    const size_t peakWorkingBytes = memoryUsage.m_PeakWorkingBytes;
+    memoryUsage = runtime->GetMemoryUsage(netId);
+    BOOST_TEST(memoryUsage.m_WorkingBytes == enqueueWorkingBytes);
+    BOOST_TEST(memoryUsage.m_PeakWorkingBytes == peakWorkingBytes);
+
+    BOOST_CHECK_THROW(runtime->GetMemoryUsage(netId + 1), std::out_of_range);
+
+    // A working memory handle can still be released once its network has been unloaded.
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+    BOOST_TEST(runtime->Execute(*workingMemHandle, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(runtime->UnloadNetwork(netId) == Status::Success);
+    workingMemHandle.reset();
+}
+
 BOOST_AUTO_TEST_CASE(ProfilingDisable)
 {
     using namespace armnn;
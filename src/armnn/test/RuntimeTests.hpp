@@ -11,4 +11,6 @@ namespace armnn
 
 void RuntimeLoadedNetworksReserve(armnn::Runtime* runtime);
 
+const ConstantTensorStore& GetConstantTensorStore(armnn::Runtime* runtime);
+
 } // namespace armnn
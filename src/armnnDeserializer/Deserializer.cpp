@@ -16,6 +16,7 @@
 #include <armnn/utility/Assert.hpp>
 #include <armnn/utility/IgnoreUnused.hpp>
 
+#include <MappedFile.hpp>
 #include <ParserHelper.hpp>
 #include <VerificationHelpers.hpp>
 
@@ -718,6 +719,16 @@ armnn::INetworkPtr Deserializer::CreateNetworkFromBinary(std::istream& binaryCon
     return CreateNetworkFromGraph(graph);
 }
 
+armnn::INetworkPtr Deserializer::CreateNetworkFromBinaryFile(const char* graphFile)
+{
+    ResetParser();
+    // The graph, including the data of its constant tensors, is read in place from the mapped file. The network
+    // takes its own copy of the constants, so the mapping is only needed while it is built.
+    armnnUtils::MappedFile content(graphFile);
+    GraphPtr graph = LoadGraphFromBinary(content.GetData(), content.GetSize());
+    return CreateNetworkFromGraph(graph);
+}
+
 Deserializer::GraphPtr Deserializer::LoadGraphFromBinary(const uint8_t* binaryContent, size_t len)
 {
     if (binaryContent == nullptr)
@@ -39,6 +39,9 @@ public:
     /// Create an input network from a binary input stream
     armnn::INetworkPtr CreateNetworkFromBinary(std::istream& binaryContent) override;
 
+    /// Create an input network from a binary file, which is memory mapped rather than read into memory
+    armnn::INetworkPtr CreateNetworkFromBinaryFile(const char* graphFile) override;
+
     /// Retrieve binding info (layer id and tensor info) for the network input identified by the given layer name
     BindingPointInfo GetNetworkInputBindingInfo(unsigned int layerId, const std::string& name) const override;
 
@@ -22,18 +22,6 @@ int main(int argc, char* argv[])
         return -1;
     }
     armnnDeserializer::IDeserializerPtr parser = armnnDeserializer::IDeserializer::Create();
-    std::ifstream inputFileStream(cmdline.GetInputFileName(), std::ios::binary);
-    std::vector<std::uint8_t> binaryContent;
-    while (inputFileStream)
-    {
-        char c;
-        inputFileStream.get(c);
-        if (inputFileStream)
-        {
-            binaryContent.push_back(static_cast<std::uint8_t>(c));
-        }
-    }
-    inputFileStream.close();
 
     armnn::QuantizerOptions quantizerOptions;
 
@@ -52,7 +40,7 @@ int main(int argc, char* argv[])
 
     quantizerOptions.m_PreserveType = cmdline.HasPreservedDataType();
 
-    armnn::INetworkPtr network = parser->CreateNetworkFromBinary(binaryContent);
+    armnn::INetworkPtr network = parser->CreateNetworkFromBinaryFile(cmdline.GetInputFileName().c_str());
     armnn::INetworkQuantizerPtr quantizer = armnn::INetworkQuantizer::Create(network.get(), quantizerOptions);
 
     if (cmdline.HasQuantizationData())
@@ -18,6 +18,7 @@
 // armnnUtils:
 #include <armnnUtils/Permute.hpp>
 #include <Filesystem.hpp>
+#include <MappedFile.hpp>
 
 #include <ParserHelper.hpp>
 #include <VerificationHelpers.hpp>
@@ -30,7 +31,6 @@
 #include <boost/format.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 
-#include <fstream>
 #include <algorithm>
 #include <limits>
 #include <numeric>
@@ -472,19 +472,18 @@ CreateConstTensorImpl(TfLiteParser::BufferRawPtr bufferPtr,
         boost::str(
             boost::format("Buffer for buffer:%1% is null") % tensorPtr->buffer).c_str());
 
-    std::unique_ptr<T[]> data(new T[tensorInfo.GetNumElements()]);
-
-    if (permutationVector.has_value() && permutationVector.value().GetSize() > 0)
+    // The network copies the constant tensors it is given, so unless the data has to be permuted the tensor can
+    // simply point into the model, which outlives it.
+    if (!permutationVector.has_value() || permutationVector.value().GetSize() == 0)
     {
-        tensorInfo = armnnUtils::Permuted(tensorInfo, permutationVector.value());
-        armnnUtils::Permute(tensorInfo.GetShape(), permutationVector.value(),
-                            reinterpret_cast<const T*>(bufferPtr->data.data()), data.get(), sizeof(T));
-    }
-    else
-    {
-        ::memcpy(data.get(), bufferPtr->data.data(), tensorInfo.GetNumBytes());
+        return std::make_pair(ConstTensor(tensorInfo, bufferPtr->data.data()), std::unique_ptr<T[]>());
     }
 
+    std::unique_ptr<T[]> data(new T[tensorInfo.GetNumElements()]);
+    tensorInfo = armnnUtils::Permuted(tensorInfo, permutationVector.value());
+    armnnUtils::Permute(tensorInfo.GetShape(), permutationVector.value(),
+                        reinterpret_cast<const T*>(bufferPtr->data.data()), data.get(), sizeof(T));
+
     return std::make_pair(ConstTensor(tensorInfo, data.get()), std::move(data));
 }
 
@@ -3056,10 +3055,9 @@ TfLiteParser::ModelPtr TfLiteParser::LoadModelFromFile(const char * fileName)
                                          locationString);
         throw FileNotFoundException(msg);
     }
-    std::ifstream file(fileName, std::ios::binary);
-    std::string fileContent((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
-    return LoadModelFromBinary(reinterpret_cast<const uint8_t *>(fileContent.c_str()),
-                               fileContent.size());
+    // The model is verified and unpacked straight from the mapped file, which is only needed until it is unpacked.
+    armnnUtils::MappedFile fileContent(fileName);
+    return LoadModelFromBinary(fileContent.GetData(), fileContent.GetSize());
 }
 
 TfLiteParser::ModelPtr TfLiteParser::LoadModelFromBinary(const uint8_t * binaryContent, size_t len)
@@ -0,0 +1,108 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "MappedFile.hpp"
+
+#include <armnn/Exceptions.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+namespace armnnUtils
+{
+
+namespace
+{
+
+const uint8_t g_EmptyContents = 0;
+
+}
+
+MappedFile::MappedFile(const char* fileName)
+    : m_Data(&g_EmptyContents),
+      m_Size(0),
+      m_IsMapped(false)
+{
+    if (fileName == nullptr)
+    {
+        throw armnn::InvalidArgumentException("MappedFile: invalid (null) file name");
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    const int fd = ::open(fileName, O_RDONLY);
+    if (fd < 0)
+    {
+        throw armnn::FileNotFoundException(std::string("MappedFile: cannot open ") + fileName + ": " +
+                                           std::strerror(errno));
+    }
+
+    struct stat fileStat;
+    if (::fstat(fd, &fileStat) != 0)
+    {
+        const int error = errno;
+        ::close(fd);
+        throw armnn::RuntimeException(std::string("MappedFile: cannot stat ") + fileName + ": " +
+                                      std::strerror(error));
+    }
+
+    // A mapping can't be empty, so an empty file is left pointing at g_EmptyContents.
+    if (fileStat.st_size > 0)
+    {
+        const size_t size = static_cast<size_t>(fileStat.st_size);
+        void* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (data == MAP_FAILED)
+        {
+            const int error = errno;
+            ::close(fd);
+            throw armnn::RuntimeException(std::string("MappedFile: cannot map ") + fileName + ": " +
+                                          std::strerror(error));
+        }
+        m_Data = static_cast<const uint8_t*>(data);
+        m_Size = size;
+        m_IsMapped = true;
+    }
+
+    // The mapping keeps its own reference to the file.
+    ::close(fd);
+#else
+    std::ifstream file(fileName, std::ios::binary);
+    if (!file)
+    {
+        throw armnn::FileNotFoundException(std::string("MappedFile: cannot open ") + fileName);
+    }
+    m_Contents.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    if (file.bad())
+    {
+        throw armnn::RuntimeException(std::string("MappedFile: cannot read ") + fileName);
+    }
+    if (!m_Contents.empty())
+    {
+        m_Data = m_Contents.data();
+        m_Size = m_Contents.size();
+    }
+#endif
+}
+
+MappedFile::~MappedFile()
+{
+#if defined(__unix__) || defined(__APPLE__)
+    if (m_IsMapped)
+    {
+        ::munmap(const_cast<uint8_t*>(m_Data), m_Size);
+    }
+#endif
+}
+
+}
@@ -0,0 +1,42 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace armnnUtils
+{
+
+/// Read-only view of the contents of a file, held for the lifetime of the object. Where the platform supports it
+/// the file is memory mapped, so that its pages are read in on first access and shared with the page cache rather
+/// than copied into the heap; elsewhere it is read into memory.
+class MappedFile
+{
+public:
+    /// Throws armnn::FileNotFoundException if the file can't be opened, or armnn::RuntimeException if it can't be
+    /// mapped or read.
+    explicit MappedFile(const char* fileName);
+    ~MappedFile();
+
+    /// Never null, even for an empty file.
+    const uint8_t* GetData() const { return m_Data; }
+    size_t GetSize() const { return m_Size; }
+
+private:
+    MappedFile(const MappedFile&) = delete; // Noncopyable
+    MappedFile& operator=(const MappedFile&) = delete; // Noncopyable
+
+    const uint8_t* m_Data;
+    size_t m_Size;
+    bool m_IsMapped;
+
+    /// Contents of the file when it is not mapped.
+    std::vector<uint8_t> m_Contents;
+};
+
+}
@@ -0,0 +1,54 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <Filesystem.hpp>
+#include <MappedFile.hpp>
+
+#include <armnn/Exceptions.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <fstream>
+
+BOOST_AUTO_TEST_SUITE(MappedFileSuite)
+
+BOOST_AUTO_TEST_CASE(MappedFileContents)
+{
+    fs::path fileName = armnnUtils::Filesystem::NamedTempFile("Armnn-MappedFileContentsTest-TempFile");
+    const std::vector<uint8_t> contents = { 0, 1, 2, 3, 254, 255, 10, 13 };
+    {
+        std::ofstream file(fileName.string(), std::ios::binary);
+        file.write(reinterpret_cast<const char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+    }
+
+    {
+        armnnUtils::MappedFile mappedFile(fileName.string().c_str());
+        BOOST_TEST(mappedFile.GetSize() == contents.size());
+        BOOST_TEST(std::vector<uint8_t>(mappedFile.GetData(), mappedFile.GetData() + mappedFile.GetSize()) ==
+                   contents, boost::test_tools::per_element());
+    }
+    fs::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(MappedFileEmpty)
+{
+    fs::path fileName = armnnUtils::Filesystem::NamedTempFile("Armnn-MappedFileEmptyTest-TempFile");
+    std::ofstream(fileName.string(), std::ios::binary).close();
+
+    {
+        armnnUtils::MappedFile mappedFile(fileName.string().c_str());
+        BOOST_TEST(mappedFile.GetSize() == 0);
+        BOOST_TEST(mappedFile.GetData() != nullptr);
+    }
+    fs::remove(fileName);
+}
+
+BOOST_AUTO_TEST_CASE(MappedFileNotFound)
+{
+    fs::path fileName = armnnUtils::Filesystem::NamedTempFile("Armnn-MappedFileNotFoundTest-TempFile");
+    BOOST_CHECK_THROW(armnnUtils::MappedFile(fileName.string().c_str()), armnn::FileNotFoundException);
+}
+
+BOOST_AUTO_TEST_SUITE_END()
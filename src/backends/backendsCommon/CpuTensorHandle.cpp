@@ -66,33 +66,44 @@ ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstTensor& tensor)
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle)
 : ScopedCpuTensorHandle(tensorHandle.GetTensorInfo())
 {
-    CopyFrom(tensorHandle.GetConstTensor<void>(), tensorHandle.GetTensorInfo().GetNumBytes());
+    // Workloads take their constant tensors from the layers as ConstCpuTensorHandles.
+    const ScopedCpuTensorHandle* scopedTensorHandle = dynamic_cast<const ScopedCpuTensorHandle*>(&tensorHandle);
+    if (scopedTensorHandle)
+    {
+        ShareFrom(*scopedTensorHandle);
+    }
+    else
+    {
+        CopyFrom(tensorHandle.GetConstTensor<void>(), tensorHandle.GetTensorInfo().GetNumBytes());
+    }
 }
 
 ScopedCpuTensorHandle::ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other)
 : CpuTensorHandle(other.GetTensorInfo())
 {
-    CopyFrom(other);
+    ShareFrom(other);
 }
 
 ScopedCpuTensorHandle& ScopedCpuTensorHandle::operator=(const ScopedCpuTensorHandle& other)
 {
-    ::operator delete(GetTensor<void>());
+    m_SharedMemory.reset();
+    m_IsMemoryShared = false;
     SetMemory(nullptr);
-    CopyFrom(other);
+    ShareFrom(other);
     return *this;
 }
 
 ScopedCpuTensorHandle::~ScopedCpuTensorHandle()
 {
-    ::operator delete(GetTensor<void>());
 }
 
 void ScopedCpuTensorHandle::Allocate()
 {
     if (GetTensor<void>() == nullptr)
     {
-        SetMemory(::operator new(GetTensorInfo().GetNumBytes()));
+        m_SharedMemory = std::shared_ptr<void>(::operator new(GetTensorInfo().GetNumBytes()),
+                                               [](void* memory) { ::operator delete(memory); });
+        SetMemory(m_SharedMemory.get());
     }
     else
     {
@@ -108,12 +119,17 @@ void ScopedCpuTensorHandle::CopyOutTo(void* memory) const
 
 void ScopedCpuTensorHandle::CopyInFrom(const void* memory)
 {
+    UnshareMemory();
     memcpy(GetTensor<void>(), memory, GetTensorInfo().GetNumBytes());
 }
 
-void ScopedCpuTensorHandle::CopyFrom(const ScopedCpuTensorHandle& other)
+void ScopedCpuTensorHandle::ShareFrom(const ScopedCpuTensorHandle& other)
 {
-    CopyFrom(other.GetTensor<void>(), other.GetTensorInfo().GetNumBytes());
+    ARMNN_ASSERT(GetTensor<void>() == nullptr);
+    ARMNN_ASSERT(GetTensorInfo().GetNumBytes() == other.GetTensorInfo().GetNumBytes());
+
+    m_SharedMemory = other.m_SharedMemory;
+    SetMemory(m_SharedMemory.get());
 }
 
 void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numBytes)
@@ -128,6 +144,57 @@ void ScopedCpuTensorHandle::CopyFrom(const void* srcMemory, unsigned int numByte
     }
 }
 
+void ScopedCpuTensorHandle::UpdateWeightsAndBiases(ScopedCpuTensorHandle& weights,
+                                                   ScopedCpuTensorHandle* biases,
+                                                   const ConstTensor& newWeights,
+                                                   const Optional<ConstTensor>& newBiases)
+{
+    if (newWeights.GetInfo() != weights.GetTensorInfo())
+    {
+        throw InvalidArgumentException("The new weights don't match the shape, data type or quantization "
+                                       "of the weights they replace");
+    }
+    if (newBiases.has_value())
+    {
+        if (!biases)
+        {
+            throw InvalidArgumentException("Biases were given for a layer which doesn't have any");
+        }
+        if (newBiases.value().GetInfo() != biases->GetTensorInfo())
+        {
+            throw InvalidArgumentException("The new biases don't match the shape, data type or quantization "
+                                           "of the biases they replace");
+        }
+    }
+
+    weights.UnshareMemory();
+    memcpy(weights.GetTensor<void>(), newWeights.GetMemoryArea(), newWeights.GetNumBytes());
+    if (newBiases.has_value())
+    {
+        biases->UnshareMemory();
+        memcpy(biases->GetTensor<void>(), newBiases.value().GetMemoryArea(), newBiases.value().GetNumBytes());
+    }
+}
+
+void ScopedCpuTensorHandle::ShareMemory(std::shared_ptr<void> memory)
+{
+    ARMNN_ASSERT(memory);
+    m_SharedMemory = std::move(memory);
+    m_IsMemoryShared = true;
+    SetMemory(m_SharedMemory.get());
+}
+
+void ScopedCpuTensorHandle::UnshareMemory()
+{
+    if (m_IsMemoryShared || m_SharedMemory.use_count() > 1)
+    {
+        m_SharedMemory.reset();
+        m_IsMemoryShared = false;
+        SetMemory(nullptr);
+        Allocate();
+    }
+}
+
 void PassthroughCpuTensorHandle::Allocate()
 {
     throw InvalidArgumentException("PassthroughCpuTensorHandle::Allocate() should never be called");
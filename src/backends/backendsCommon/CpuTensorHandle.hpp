@@ -13,6 +13,7 @@
 #include <CompatibleTypes.hpp>
 
 #include <algorithm>
+#include <memory>
 
 #include <armnn/utility/Assert.hpp>
 
@@ -111,22 +112,50 @@ public:
     // Copies contents from Tensor.
     explicit ScopedCpuTensorHandle(const ConstTensor& tensor);
 
-    // Copies contents from ConstCpuTensorHandle
+    // Copies contents from ConstCpuTensorHandle, or shares them if it is a ScopedCpuTensorHandle
     explicit ScopedCpuTensorHandle(const ConstCpuTensorHandle& tensorHandle);
 
+    /// Shares the memory of other rather than copying it, so that the constant tensors of a layer aren't copied
+    /// again when the graph is cloned or a workload is created. The memory is read-only from then on.
     ScopedCpuTensorHandle(const ScopedCpuTensorHandle& other);
     ScopedCpuTensorHandle& operator=(const ScopedCpuTensorHandle& other);
     ~ScopedCpuTensorHandle();
 
     virtual void Allocate() override;
 
+    /// Overwrites the contents with those of weights, and those of biases with newBiases if given, reusing their
+    /// memory, for workloads whose constant tensors are replaced while loaded. Throws InvalidArgumentException,
+    /// without changing either, unless the new tensors have the shapes, data types and quantization of the old ones.
+    /// Memory shared with other handles is never overwritten: the handles updated get a private copy instead.
+    static void UpdateWeightsAndBiases(ScopedCpuTensorHandle& weights,
+                                       ScopedCpuTensorHandle* biases,
+                                       const ConstTensor& newWeights,
+                                       const Optional<ConstTensor>& newBiases);
+
+    /// Memory of the handle, owned jointly with the handles it has been shared with. Null until allocated.
+    const std::shared_ptr<void>& GetSharedMemory() const { return m_SharedMemory; }
+
+    /// Replaces the memory of the handle with the given memory, which must hold the same contents (e.g. those of an
+    /// identical constant tensor of another network), and marks it read-only. Passing the handle's own memory only
+    /// marks it read-only, for when it is about to be shared with other handles.
+    void ShareMemory(std::shared_ptr<void> memory);
+
 private:
     // Only used for testing
     void CopyOutTo(void* memory) const override;
     void CopyInFrom(const void* memory) override;
 
-    void CopyFrom(const ScopedCpuTensorHandle& other);
+    void ShareFrom(const ScopedCpuTensorHandle& other);
     void CopyFrom(const void* srcMemory, unsigned int numBytes);
+
+    /// Gives the handle newly allocated memory, with undefined contents, if its memory is shared.
+    void UnshareMemory();
+
+    std::shared_ptr<void> m_SharedMemory;
+
+    /// Whether the memory has been passed to ShareMemory(), and so may be handed to other handles at any time.
+    /// Memory held by several handles is shared regardless.
+    bool m_IsMemoryShared = false;
 };
 
 // A CpuTensorHandle that wraps an already allocated memory region.
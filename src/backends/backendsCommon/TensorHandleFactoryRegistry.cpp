@@ -65,4 +65,14 @@ void TensorHandleFactoryRegistry::ReleaseMemory()
     }
 }
 
+size_t TensorHandleFactoryRegistry::GetAcquiredBytes() const
+{
+    size_t acquiredBytes = 0;
+    for (auto& mgr : m_MemoryManagers)
+    {
+        acquiredBytes += mgr->GetAcquiredBytes();
+    }
+    return acquiredBytes;
+}
+
 } // namespace armnn
@@ -7,6 +7,7 @@
 
 #include <armnn/backends/ITensorHandleFactory.hpp>
 
+#include <cstddef>
 #include <memory>
 #include <vector>
 
@@ -41,6 +42,9 @@ public:
     /// Release memory required for inference
     void ReleaseMemory();
 
+    /// Bytes of memory currently acquired by the memory managers which keep track of it
+    size_t GetAcquiredBytes() const;
+
 private:
     std::vector<std::unique_ptr<ITensorHandleFactory>> m_Factories;
     std::vector<std::shared_ptr<IMemoryManager>> m_MemoryManagers;
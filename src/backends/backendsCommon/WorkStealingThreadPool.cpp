@@ -0,0 +1,139 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "WorkStealingThreadPool.hpp"
+
+#include <armnn/Logging.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Identifies the pool and queue of the worker running on the current thread, if any.
+thread_local const WorkStealingThreadPool* tl_CurrentPool = nullptr;
+thread_local unsigned int tl_CurrentWorkerIndex = 0;
+
+} // anonymous namespace
+
+WorkStealingThreadPool::WorkStealingThreadPool(unsigned int numThreads)
+    : m_NextQueue(0)
+    , m_NumQueuedTasks(0)
+    , m_Terminate(false)
+{
+    numThreads = std::max(numThreads, 1u);
+    m_Queues.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        m_Queues.push_back(std::make_unique<WorkerQueue>());
+    }
+
+    m_Threads.reserve(numThreads);
+    for (unsigned int i = 0; i < numThreads; ++i)
+    {
+        m_Threads.emplace_back(&WorkStealingThreadPool::ProcessTasks, this, i);
+    }
+}
+
+WorkStealingThreadPool::~WorkStealingThreadPool()
+{
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        m_Terminate = true;
+    }
+    m_TaskAvailable.notify_all();
+
+    for (auto& thread : m_Threads)
+    {
+        thread.join();
+    }
+}
+
+void WorkStealingThreadPool::Schedule(Task task)
+{
+    unsigned int queueIndex = (tl_CurrentPool == this)
+                              ? tl_CurrentWorkerIndex
+                              : m_NextQueue.fetch_add(1) % static_cast<unsigned int>(m_Queues.size());
+    {
+        WorkerQueue& queue = *m_Queues[queueIndex];
+        std::lock_guard<std::mutex> lockGuard(queue.m_Mutex);
+        queue.m_Tasks.push_back(std::move(task));
+    }
+    {
+        std::lock_guard<std::mutex> lockGuard(m_Mutex);
+        ++m_NumQueuedTasks;
+    }
+    m_TaskAvailable.notify_one();
+}
+
+bool WorkStealingThreadPool::TryTakeTask(unsigned int workerIndex, Task& task)
+{
+    const unsigned int numQueues = static_cast<unsigned int>(m_Queues.size());
+    for (unsigned int i = 0; i < numQueues; ++i)
+    {
+        const unsigned int queueIndex = (workerIndex + i) % numQueues;
+        WorkerQueue& queue = *m_Queues[queueIndex];
+        std::lock_guard<std::mutex> lockGuard(queue.m_Mutex);
+        if (queue.m_Tasks.empty())
+        {
+            continue;
+        }
+
+        if (queueIndex == workerIndex)
+        {
+            task = std::move(queue.m_Tasks.back());
+            queue.m_Tasks.pop_back();
+        }
+        else
+        {
+            task = std::move(queue.m_Tasks.front());
+            queue.m_Tasks.pop_front();
+        }
+        --m_NumQueuedTasks;
+        return true;
+    }
+    return false;
+}
+
+void WorkStealingThreadPool::ProcessTasks(unsigned int workerIndex)
+{
+    tl_CurrentPool = this;
+    tl_CurrentWorkerIndex = workerIndex;
+
+    while (true)
+    {
+        Task task;
+        if (!TryTakeTask(workerIndex, task))
+        {
+            std::unique_lock<std::mutex> lock(m_Mutex);
+            m_TaskAvailable.wait(lock, [this] { return m_Terminate || m_NumQueuedTasks > 0; });
+
+            // Tasks queued before termination are still run so that nobody waits forever on their results.
+            if (m_NumQueuedTasks == 0)
+            {
+                return;
+            }
+            continue;
+        }
+
+        try
+        {
+            task();
+        }
+        catch (const std::exception& e)
+        {
+            ARMNN_LOG(error) << "WorkStealingThreadPool: unhandled exception in task: " << e.what();
+        }
+        catch (...)
+        {
+            ARMNN_LOG(error) << "WorkStealingThreadPool: unhandled unknown exception in task";
+        }
+    }
+}
+
+} // namespace armnn
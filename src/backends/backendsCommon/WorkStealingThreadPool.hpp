@@ -0,0 +1,68 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace armnn
+{
+
+/// Pool of worker threads where each worker has its own task queue.
+/// Tasks scheduled by a worker go to the back of its own queue and are taken from there, which keeps the successors
+/// of a task on the thread that produced their inputs. Idle workers steal from the front of the other queues.
+class WorkStealingThreadPool
+{
+public:
+    using Task = std::function<void()>;
+
+    /// @param numThreads Number of worker threads. At least one thread is always created.
+    explicit WorkStealingThreadPool(unsigned int numThreads);
+
+    /// Runs the tasks which are still queued, then joins the workers.
+    ~WorkStealingThreadPool();
+
+    WorkStealingThreadPool(const WorkStealingThreadPool&) = delete;
+    WorkStealingThreadPool& operator=(const WorkStealingThreadPool&) = delete;
+
+    /// Queues a task. Never blocks.
+    void Schedule(Task task);
+
+    unsigned int GetNumThreads() const { return static_cast<unsigned int>(m_Threads.size()); }
+
+private:
+    struct WorkerQueue
+    {
+        std::mutex m_Mutex;
+        std::deque<Task> m_Tasks;
+    };
+
+    void ProcessTasks(unsigned int workerIndex);
+
+    /// Takes the most recent task of the worker's own queue or, failing that, the oldest task of another queue.
+    bool TryTakeTask(unsigned int workerIndex, Task& task);
+
+    std::vector<std::unique_ptr<WorkerQueue>> m_Queues;
+    std::vector<std::thread> m_Threads;
+
+    /// Queue receiving the next task scheduled from a thread outside the pool.
+    std::atomic<unsigned int> m_NextQueue;
+
+    /// Number of tasks sitting in the queues. Only incremented with m_Mutex held, so sleeping workers can't miss one.
+    std::atomic<unsigned int> m_NumQueuedTasks;
+
+    std::mutex m_Mutex;
+    std::condition_variable m_TaskAvailable;
+    bool m_Terminate;
+};
+
+} // namespace armnn
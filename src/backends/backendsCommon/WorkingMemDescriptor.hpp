@@ -0,0 +1,24 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <armnn/backends/ITensorHandle.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// The set of tensor handles a single workload reads from and writes to when it is executed against
+/// memory other than the handles it was created with (see IWorkload::ExecuteAsync).
+struct WorkingMemDescriptor
+{
+    std::vector<ITensorHandle*> m_Inputs;
+    std::vector<ITensorHandle*> m_Outputs;
+
+    ~WorkingMemDescriptor() = default;
+};
+
+} // namespace armnn
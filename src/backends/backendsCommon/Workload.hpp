@@ -6,12 +6,14 @@
 
 #include "WorkloadData.hpp"
 #include "WorkloadInfo.hpp"
+#include "WorkingMemDescriptor.hpp"
 
 #include <armnn/backends/IWorkload.hpp>
 #include <Profiling.hpp>
 #include <ProfilingService.hpp>
 
 #include <algorithm>
+#include <mutex>
 
 namespace armnn
 {
@@ -36,6 +38,34 @@ public:
         m_Data.Validate(info);
     }
 
+    // Default implementation for workloads which bind their tensor handles at construction: the handles are
+    // swapped in for the duration of a single Execute(), so concurrent callers are serialised per workload.
+    // Execute() sees the swapped handles, so its callers mustn't run it concurrently with this, which
+    // LoadedNetwork ensures. Workloads which can run against arbitrary handles without shared state should
+    // override this.
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override
+    {
+        std::lock_guard<std::mutex> lockGuard(m_AsyncWorkloadMutex);
+
+        std::vector<ITensorHandle*> inputs  = m_Data.m_Inputs;
+        std::vector<ITensorHandle*> outputs = m_Data.m_Outputs;
+
+        m_Data.m_Inputs  = workingMemDescriptor.m_Inputs;
+        m_Data.m_Outputs = workingMemDescriptor.m_Outputs;
+        try
+        {
+            Execute();
+        }
+        catch (...)
+        {
+            m_Data.m_Inputs  = std::move(inputs);
+            m_Data.m_Outputs = std::move(outputs);
+            throw;
+        }
+        m_Data.m_Inputs  = std::move(inputs);
+        m_Data.m_Outputs = std::move(outputs);
+    };
+
     void PostAllocationConfigure() override {}
 
     const QueueDescriptor& GetData() const { return m_Data; }
@@ -43,8 +73,11 @@ public:
     profiling::ProfilingGuid GetGuid() const final { return m_Guid; }
 
 protected:
-    const QueueDescriptor m_Data;
+    QueueDescriptor m_Data;
     const profiling::ProfilingGuid m_Guid;
+
+private:
+    std::mutex m_AsyncWorkloadMutex;
 };
 
 // TypedWorkload used
@@ -21,7 +21,8 @@ COMMON_SOURCES := \
     TensorHandleFactoryRegistry.cpp \
     WorkloadData.cpp \
     WorkloadFactory.cpp \
-    WorkloadUtils.cpp
+    WorkloadUtils.cpp \
+    WorkStealingThreadPool.cpp
 
 # COMMON_TEST_SOURCES contains the list of files to be included
 # in the Android unit test build (armnn-tests) and it is picked
@@ -127,12 +127,12 @@ BOOST_AUTO_TEST_CASE(BackendProfilingCounterRegisterMockBackendTest)
     // Check if the MockBackends 3 dummy counters {0, 1, 2-5 (four cores)} are registered
     armnn::BackendId mockId = armnn::MockBackendId();
     const armnn::profiling::ICounterMappings& counterMap = GetProfilingService(&runtime).GetCounterMappings();
-    BOOST_CHECK(counterMap.GetGlobalId(0, mockId) == 5);
-    BOOST_CHECK(counterMap.GetGlobalId(1, mockId) == 6);
-    BOOST_CHECK(counterMap.GetGlobalId(2, mockId) == 7);
-    BOOST_CHECK(counterMap.GetGlobalId(3, mockId) == 8);
-    BOOST_CHECK(counterMap.GetGlobalId(4, mockId) == 9);
-    BOOST_CHECK(counterMap.GetGlobalId(5, mockId) == 10);
+    BOOST_CHECK(counterMap.GetGlobalId(0, mockId) == 11);
+    BOOST_CHECK(counterMap.GetGlobalId(1, mockId) == 12);
+    BOOST_CHECK(counterMap.GetGlobalId(2, mockId) == 13);
+    BOOST_CHECK(counterMap.GetGlobalId(3, mockId) == 14);
+    BOOST_CHECK(counterMap.GetGlobalId(4, mockId) == 15);
+    BOOST_CHECK(counterMap.GetGlobalId(5, mockId) == 16);
     options.m_ProfilingOptions.m_EnableProfiling = false;
     GetProfilingService(&runtime).ResetExternalProfilingOptions(options.m_ProfilingOptions, true);
 }
@@ -5,6 +5,7 @@
 
 #include "RefBackend.hpp"
 #include "RefBackendId.hpp"
+#include "RefBackendContext.hpp"
 #include "RefWorkloadFactory.hpp"
 #include "RefLayerSupport.hpp"
 #include "RefTensorHandleFactory.hpp"
@@ -28,23 +29,23 @@ const BackendId& RefBackend::GetIdStatic()
 IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
     const IBackendInternal::IMemoryManagerSharedPtr& memoryManager) const
 {
-    return std::make_unique<RefWorkloadFactory>(PolymorphicPointerDowncast<RefMemoryManager>(memoryManager));
+    return CreateRefWorkloadFactory(PolymorphicPointerDowncast<RefMemoryManager>(memoryManager));
 }
 
 IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateWorkloadFactory(
     class TensorHandleFactoryRegistry& tensorHandleFactoryRegistry) const
 {
-    auto memoryManager = std::make_shared<RefMemoryManager>();
+    auto memoryManager = std::make_shared<RefMemoryManager>(m_MemoryAllocator);
 
     tensorHandleFactoryRegistry.RegisterMemoryManager(memoryManager);
     tensorHandleFactoryRegistry.RegisterFactory(std::make_unique<RefTensorHandleFactory>(memoryManager));
 
-    return std::make_unique<RefWorkloadFactory>(PolymorphicPointerDowncast<RefMemoryManager>(memoryManager));
+    return CreateRefWorkloadFactory(PolymorphicPointerDowncast<RefMemoryManager>(memoryManager));
 }
 
-IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRuntime::CreationOptions&) const
+IBackendInternal::IBackendContextPtr RefBackend::CreateBackendContext(const IRuntime::CreationOptions& options) const
 {
-    return IBackendContextPtr{};
+    return IBackendContextPtr{new RefBackendContext{options}};
 }
 
 IBackendInternal::IBackendProfilingContextPtr RefBackend::CreateBackendProfilingContext(
@@ -55,7 +56,7 @@ IBackendInternal::IBackendProfilingContextPtr RefBackend::CreateBackendProfiling
 
 IBackendInternal::IMemoryManagerUniquePtr RefBackend::CreateMemoryManager() const
 {
-    return std::make_unique<RefMemoryManager>();
+    return std::make_unique<RefMemoryManager>(m_MemoryAllocator);
 }
 
 IBackendInternal::Optimizations RefBackend::GetOptimizations() const
@@ -85,10 +86,24 @@ std::vector<ITensorHandleFactory::FactoryId> RefBackend::GetHandleFactoryPrefere
 
 void RefBackend::RegisterTensorHandleFactories(class TensorHandleFactoryRegistry& registry)
 {
-    auto memoryManager = std::make_shared<RefMemoryManager>();
+    auto memoryManager = std::make_shared<RefMemoryManager>(m_MemoryAllocator);
 
     registry.RegisterMemoryManager(memoryManager);
     registry.RegisterFactory(std::make_unique<RefTensorHandleFactory>(memoryManager));
 }
 
+void RefBackend::SetBackendContext(IBackendContext& context)
+{
+    const RefBackendContext* refContext = PolymorphicDowncast<RefBackendContext*>(&context);
+    m_ThreadPool = refContext->GetThreadPool();
+    m_MemoryAllocator = refContext->GetMemoryAllocator();
+}
+
+IBackendInternal::IWorkloadFactoryPtr RefBackend::CreateRefWorkloadFactory(
+    const std::shared_ptr<RefMemoryManager>& memoryManager) const
+{
+    return m_ThreadPool ? std::make_unique<RefWorkloadFactory>(memoryManager, m_ThreadPool)
+                        : std::make_unique<RefWorkloadFactory>(memoryManager);
+}
+
 } // namespace armnn
@@ -4,8 +4,13 @@
 //
 #pragma once
 
+#include "RefMemoryManager.hpp"
+#include "RefThreadPool.hpp"
+
 #include <armnn/backends/IBackendInternal.hpp>
 
+#include <memory>
+
 namespace armnn
 {
 
@@ -39,6 +44,20 @@ public:
     std::vector<ITensorHandleFactory::FactoryId> GetHandleFactoryPreferences() const override;
 
     void RegisterTensorHandleFactories(class TensorHandleFactoryRegistry& registry) override;
+
+    /// Makes the memory managers and workload factories created from then on use the resources of the
+    /// RefBackendContext.
+    void SetBackendContext(IBackendContext& context) override;
+
+private:
+    IWorkloadFactoryPtr CreateRefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager) const;
+
+    /// Thread pool of the runtime's RefBackendContext, or null if none was set, in which case each workload factory
+    /// creates its own single-threaded pool.
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
+
+    /// Allocator the memory managers are created with, the one of the runtime's RefBackendContext if it was set.
+    RefMemoryAllocator m_MemoryAllocator;
 };
 
 } // namespace armnn
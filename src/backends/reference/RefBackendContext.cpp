@@ -0,0 +1,109 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefBackendContext.hpp"
+#include "RefBackendId.hpp"
+
+#include <armnn/Logging.hpp>
+
+#include <cstddef>
+#include <string>
+
+namespace armnn
+{
+
+RefBackendContext::RefBackendContext(const IRuntime::CreationOptions& options)
+    : IBackendContext(options)
+{
+    unsigned int numThreads = 1;
+    size_t alignment = RefMemoryAllocator::s_DefaultAlignment;
+    RefMemoryAllocator::HugePages hugePages = RefMemoryAllocator::HugePages::None;
+    for (const BackendOptions& optionsGroup : options.m_BackendOptions)
+    {
+        if (optionsGroup.GetBackendId() != RefBackendId())
+        {
+            continue;
+        }
+
+        for (size_t i = 0; i < optionsGroup.GetOptionCount(); i++)
+        {
+            const BackendOptions::BackendOption option = optionsGroup.GetOption(i);
+            if (option.GetName() == "NumberOfThreads")
+            {
+                const BackendOptions::Var& value = option.GetValue();
+                if (value.IsInt() && value.AsInt() >= 0)
+                {
+                    numThreads = static_cast<unsigned int>(value.AsInt());
+                }
+                else
+                {
+                    ARMNN_LOG(warning) << "Invalid CpuRef NumberOfThreads option, it must be a non-negative integer";
+                }
+            }
+            else if (option.GetName() == "MemoryAlignment")
+            {
+                const BackendOptions::Var& value = option.GetValue();
+                const size_t optionAlignment =
+                    value.IsInt() && value.AsInt() > 0 ? static_cast<size_t>(value.AsInt()) : 0;
+                if (RefMemoryAllocator::IsValidAlignment(optionAlignment))
+                {
+                    alignment = optionAlignment;
+                }
+                else
+                {
+                    ARMNN_LOG(warning) << "Invalid CpuRef MemoryAlignment option, it must be a power of two no less "
+                                       << "than " << alignof(std::max_align_t);
+                }
+            }
+            else if (option.GetName() == "HugePages")
+            {
+                const BackendOptions::Var& value = option.GetValue();
+                const std::string mode = value.IsString() ? value.AsString() : "";
+                if (mode == "None")
+                {
+                    hugePages = RefMemoryAllocator::HugePages::None;
+                }
+                else if (mode == "Transparent")
+                {
+                    hugePages = RefMemoryAllocator::HugePages::Transparent;
+                }
+                else if (mode == "Explicit")
+                {
+                    hugePages = RefMemoryAllocator::HugePages::Explicit;
+                }
+                else
+                {
+                    ARMNN_LOG(warning) << "Invalid CpuRef HugePages option, it must be one of \"None\", "
+                                       << "\"Transparent\" or \"Explicit\"";
+                }
+            }
+        }
+    }
+
+    m_ThreadPool = std::make_shared<RefThreadPool>(numThreads);
+    m_MemoryAllocator = RefMemoryAllocator(alignment, hugePages);
+}
+
+bool RefBackendContext::BeforeLoadNetwork(NetworkId)
+{
+    return true;
+}
+
+bool RefBackendContext::AfterLoadNetwork(NetworkId)
+{
+    return true;
+}
+
+bool RefBackendContext::BeforeUnloadNetwork(NetworkId)
+{
+    return true;
+}
+
+bool RefBackendContext::AfterUnloadNetwork(NetworkId)
+{
+    return true;
+}
+
+} // namespace armnn
@@ -0,0 +1,47 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include "RefMemoryAllocator.hpp"
+#include "RefThreadPool.hpp"
+
+#include <armnn/backends/IBackendContext.hpp>
+
+#include <memory>
+
+namespace armnn
+{
+
+/// Holds the resources the CpuRef networks of a runtime share, set up from the "CpuRef" backend options of the
+/// runtime. Supported options:
+///     "NumberOfThreads" (int): number of threads the heavy CpuRef kernels split their work between,
+///                              see RefThreadPool. 1 when the option isn't given.
+///     "MemoryAlignment" (int): alignment of the memory of CpuRef tensors, a power of two no less than
+///                              alignof(std::max_align_t), see RefMemoryAllocator. 64 when the option isn't given.
+///     "HugePages" (string): "None", "Transparent" or "Explicit", whether large CpuRef tensors are backed by huge
+///                           pages, see RefMemoryAllocator::HugePages. "None" when the option isn't given.
+class RefBackendContext : public IBackendContext
+{
+public:
+    RefBackendContext(const IRuntime::CreationOptions& options);
+
+    bool BeforeLoadNetwork(NetworkId networkId) override;
+    bool AfterLoadNetwork(NetworkId networkId) override;
+
+    bool BeforeUnloadNetwork(NetworkId networkId) override;
+    bool AfterUnloadNetwork(NetworkId networkId) override;
+
+    ~RefBackendContext() override = default;
+
+    const std::shared_ptr<RefThreadPool>& GetThreadPool() const { return m_ThreadPool; }
+
+    const RefMemoryAllocator& GetMemoryAllocator() const { return m_MemoryAllocator; }
+
+private:
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
+    RefMemoryAllocator m_MemoryAllocator;
+};
+
+} // namespace armnn
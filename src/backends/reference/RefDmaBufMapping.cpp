@@ -0,0 +1,141 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefDmaBufMapping.hpp"
+
+#include <armnn/Logging.hpp>
+#include <armnn/utility/IgnoreUnused.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ARMNN_REF_DMA_BUF_MAPPING_ENABLED
+#endif
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/dma-buf.h>)
+#include <linux/dma-buf.h>
+#endif
+#endif
+
+#include <cerrno>
+#include <cstring>
+
+namespace armnn
+{
+
+std::unique_ptr<RefDmaBufMapping> RefDmaBufMapping::Create(int fd, size_t numBytes)
+{
+#if defined(ARMNN_REF_DMA_BUF_MAPPING_ENABLED)
+    struct stat status;
+    if (fstat(fd, &status) != 0)
+    {
+        ARMNN_LOG(warning) << "RefDmaBufMapping: invalid file descriptor " << fd << ": " << std::strerror(errno);
+        return nullptr;
+    }
+
+    // dma-bufs report their size through lseek() rather than fstat() on older kernels.
+    size_t bufferSize = static_cast<size_t>(status.st_size);
+    if (bufferSize == 0)
+    {
+        const off_t offset = lseek(fd, 0, SEEK_CUR);
+        const off_t end = lseek(fd, 0, SEEK_END);
+        if (offset >= 0 && end > 0)
+        {
+            bufferSize = static_cast<size_t>(end);
+            lseek(fd, offset, SEEK_SET);
+        }
+    }
+    if (bufferSize < numBytes || numBytes == 0)
+    {
+        ARMNN_LOG(warning) << "RefDmaBufMapping: the buffer of file descriptor " << fd << " has " << bufferSize
+                           << " bytes, " << numBytes << " are needed";
+        return nullptr;
+    }
+
+    void* data = mmap(nullptr, numBytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (data == MAP_FAILED)
+    {
+        ARMNN_LOG(warning) << "RefDmaBufMapping: failed to map file descriptor " << fd << ": " << std::strerror(errno);
+        return nullptr;
+    }
+
+    const int ownFd = fcntl(fd, F_DUPFD_CLOEXEC, 0);
+    if (ownFd < 0)
+    {
+        ARMNN_LOG(warning) << "RefDmaBufMapping: failed to duplicate file descriptor " << fd << ": "
+                           << std::strerror(errno);
+        munmap(data, numBytes);
+        return nullptr;
+    }
+    return std::unique_ptr<RefDmaBufMapping>(new RefDmaBufMapping(ownFd, data, numBytes));
+#else
+    ARMNN_LOG(warning) << "RefDmaBufMapping: file descriptors can't be mapped on this platform";
+    IgnoreUnused(fd, numBytes);
+    return nullptr;
+#endif
+}
+
+RefDmaBufMapping::RefDmaBufMapping(int fd, void* data, size_t numBytes)
+    : m_Fd(fd)
+    , m_Data(data)
+    , m_NumBytes(numBytes)
+{}
+
+RefDmaBufMapping::~RefDmaBufMapping()
+{
+#if defined(ARMNN_REF_DMA_BUF_MAPPING_ENABLED)
+    EndCpuAccess();
+    munmap(m_Data, m_NumBytes);
+    close(m_Fd);
+#endif
+}
+
+bool RefDmaBufMapping::IsMappingOf(int fd) const
+{
+#if defined(ARMNN_REF_DMA_BUF_MAPPING_ENABLED)
+    struct stat mappedStatus;
+    struct stat status;
+    return fstat(m_Fd, &mappedStatus) == 0 && fstat(fd, &status) == 0 &&
+           mappedStatus.st_dev == status.st_dev && mappedStatus.st_ino == status.st_ino;
+#else
+    IgnoreUnused(fd);
+    return false;
+#endif
+}
+
+void RefDmaBufMapping::BeginCpuAccess()
+{
+    if (!m_CpuAccess.exchange(true))
+    {
+        Sync(true);
+    }
+}
+
+void RefDmaBufMapping::EndCpuAccess()
+{
+    if (m_CpuAccess.exchange(false))
+    {
+        Sync(false);
+    }
+}
+
+void RefDmaBufMapping::Sync(bool start)
+{
+#if defined(DMA_BUF_IOCTL_SYNC)
+    dma_buf_sync sync = {};
+    sync.flags = (start ? DMA_BUF_SYNC_START : DMA_BUF_SYNC_END) | DMA_BUF_SYNC_RW;
+    // Other descriptors than dma-bufs reject the request, they need no synchronisation.
+    while (ioctl(m_Fd, DMA_BUF_IOCTL_SYNC, &sync) != 0 && (errno == EINTR || errno == EAGAIN))
+    {}
+#else
+    IgnoreUnused(start);
+#endif
+}
+
+} // namespace armnn
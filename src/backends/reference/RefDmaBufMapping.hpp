@@ -0,0 +1,53 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace armnn
+{
+
+/// A shared read-write mapping of the start of a dma-buf, or of any other mappable file descriptor such as a memfd,
+/// through which tensor handles import the buffer without copying it. The file descriptor stays owned by the caller,
+/// who may close it while the mapping exists.
+class RefDmaBufMapping
+{
+public:
+    /// Maps the first numBytes of the buffer fd refers to. Returns nullptr if the buffer is smaller than that or
+    /// can't be mapped, which is always the case on platforms without mmap.
+    static std::unique_ptr<RefDmaBufMapping> Create(int fd, size_t numBytes);
+
+    /// Ends the CPU access in progress and unmaps the buffer.
+    ~RefDmaBufMapping();
+
+    void* GetData() const { return m_Data; }
+
+    /// Returns true if fd refers to the mapped buffer, even if it is a different descriptor than the one mapped.
+    bool IsMappingOf(int fd) const;
+
+    /// Bracket the accesses of the CPU to the buffer, so that the CPU caches are kept coherent with the other devices
+    /// using it. Beginning an access already in progress does nothing, as does ending one that isn't. For descriptors
+    /// other than dma-bufs there is nothing to synchronise.
+    void BeginCpuAccess();
+    void EndCpuAccess();
+
+private:
+    RefDmaBufMapping(int fd, void* data, size_t numBytes);
+
+    RefDmaBufMapping(const RefDmaBufMapping&) = delete;
+    RefDmaBufMapping& operator=(const RefDmaBufMapping&) = delete;
+
+    void Sync(bool start);
+
+    /// Duplicate of the mapped descriptor, kept to synchronise and identify the buffer.
+    int m_Fd;
+    void* m_Data;
+    size_t m_NumBytes;
+    std::atomic<bool> m_CpuAccess{false};
+};
+
+} // namespace armnn
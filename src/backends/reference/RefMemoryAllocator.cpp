@@ -0,0 +1,119 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefMemoryAllocator.hpp"
+
+#include <armnn/Exceptions.hpp>
+#include <armnn/Logging.hpp>
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#endif
+
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+#include <string>
+
+namespace armnn
+{
+
+constexpr size_t RefMemoryAllocator::s_DefaultAlignment;
+constexpr size_t RefMemoryAllocator::s_HugePageSize;
+
+namespace
+{
+
+size_t RoundUp(size_t value, size_t multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+void* AllocateAligned(size_t numBytes, size_t alignment)
+{
+#if defined(_MSC_VER)
+    void* memory = _aligned_malloc(numBytes, alignment);
+#else
+    void* memory = nullptr;
+    if (posix_memalign(&memory, alignment, numBytes) != 0)
+    {
+        memory = nullptr;
+    }
+#endif
+    if (!memory)
+    {
+        throw std::bad_alloc();
+    }
+    return memory;
+}
+
+} // anonymous namespace
+
+void RefMemoryAllocator::Deleter::operator()(void* memory) const
+{
+#if defined(__linux__)
+    if (m_MappedSize > 0)
+    {
+        munmap(memory, m_MappedSize);
+        return;
+    }
+#endif
+#if defined(_MSC_VER)
+    _aligned_free(memory);
+#else
+    free(memory);
+#endif
+}
+
+RefMemoryAllocator::RefMemoryAllocator(size_t alignment, HugePages hugePages)
+    : m_Alignment(alignment),
+      m_HugePages(hugePages)
+{
+    if (!IsValidAlignment(alignment))
+    {
+        throw InvalidArgumentException("RefMemoryAllocator: alignment must be a power of two no less than " +
+                                       std::to_string(alignof(std::max_align_t)));
+    }
+}
+
+bool RefMemoryAllocator::IsValidAlignment(size_t alignment)
+{
+    return alignment >= alignof(std::max_align_t) && (alignment & (alignment - 1)) == 0;
+}
+
+RefMemoryAllocator::MemoryPtr RefMemoryAllocator::Allocate(size_t numBytes) const
+{
+    numBytes = std::max<size_t>(numBytes, 1);
+
+    // Smaller blocks would waste most of a huge page, so they always come from the heap.
+    if (m_HugePages == HugePages::None || numBytes < s_HugePageSize)
+    {
+        return MemoryPtr(AllocateAligned(RoundUp(numBytes, m_Alignment), m_Alignment));
+    }
+
+    const size_t hugePagesSize = RoundUp(numBytes, s_HugePageSize);
+#if defined(__linux__) && defined(MAP_HUGETLB)
+    if (m_HugePages == HugePages::Explicit)
+    {
+        void* memory = mmap(nullptr, hugePagesSize, PROT_READ | PROT_WRITE,
+                            MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (memory != MAP_FAILED)
+        {
+            return MemoryPtr(memory, Deleter(hugePagesSize));
+        }
+        ARMNN_LOG(debug) << "RefMemoryAllocator: no huge pages left for " << hugePagesSize
+                         << " bytes, using transparent huge pages instead";
+    }
+#endif
+
+    // Aligning the block to the huge page size lets the kernel back all of it with huge pages.
+    void* memory = AllocateAligned(hugePagesSize, s_HugePageSize);
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+    madvise(memory, hugePagesSize, MADV_HUGEPAGE);
+#endif
+    return MemoryPtr(memory);
+}
+
+} // namespace armnn
@@ -0,0 +1,68 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+
+namespace armnn
+{
+
+/// Allocates the memory of the CpuRef tensors, that is the arenas of RefMemoryManager and the unmanaged
+/// RefTensorHandles. Each RefBackendContext holds one with the settings of its runtime, which the memory managers of
+/// the runtime's networks copy, so that runtimes with different settings don't affect each other.
+class RefMemoryAllocator
+{
+public:
+    enum class HugePages
+    {
+        /// All memory comes from the heap.
+        None,
+        /// Blocks of at least s_HugePageSize bytes are aligned to it and advised to be backed by transparent huge
+        /// pages, where the platform supports them.
+        Transparent,
+        /// Blocks of at least s_HugePageSize bytes are mapped from the pool of huge pages reserved by the system,
+        /// falling back to Transparent when it has none left.
+        Explicit
+    };
+
+    /// Frees a block whichever way it was allocated.
+    class Deleter
+    {
+    public:
+        Deleter() : m_MappedSize(0) {}
+        explicit Deleter(size_t mappedSize) : m_MappedSize(mappedSize) {}
+
+        void operator()(void* memory) const;
+
+    private:
+        /// Size of the mapping holding the block, or 0 if it comes from the heap.
+        size_t m_MappedSize;
+    };
+
+    using MemoryPtr = std::unique_ptr<void, Deleter>;
+
+    static constexpr size_t s_DefaultAlignment = 64;
+    static constexpr size_t s_HugePageSize = 2 * 1024 * 1024;
+
+    /// The alignment of the blocks allocated, and of the tensors within RefMemoryManager arenas, must be a power of
+    /// two no less than alignof(std::max_align_t), otherwise InvalidArgumentException is thrown.
+    explicit RefMemoryAllocator(size_t alignment = s_DefaultAlignment, HugePages hugePages = HugePages::None);
+
+    size_t GetAlignment() const { return m_Alignment; }
+    HugePages GetHugePages() const { return m_HugePages; }
+
+    static bool IsValidAlignment(size_t alignment);
+
+    /// Returns a block of at least numBytes bytes, never null even if numBytes is 0. Throws std::bad_alloc on failure.
+    MemoryPtr Allocate(size_t numBytes) const;
+
+private:
+    size_t m_Alignment;
+    HugePages m_HugePages;
+};
+
+} // namespace armnn
@@ -4,98 +4,164 @@
 //
 #include "RefMemoryManager.hpp"
 
+#include <armnn/Logging.hpp>
 #include <armnn/utility/Assert.hpp>
 
 #include <algorithm>
+#include <limits>
 
 namespace armnn
 {
 
-RefMemoryManager::RefMemoryManager()
+RefMemoryManager::RefMemoryManager(const RefMemoryAllocator& allocator)
+    : m_Allocator(allocator),
+      m_NextUse(0),
+      m_IsPlanned(true),
+      m_PlannedSize(0),
+      m_Arena(nullptr)
 {}
 
 RefMemoryManager::~RefMemoryManager()
-{}
-
-RefMemoryManager::Pool* RefMemoryManager::Manage(unsigned int numBytes)
 {
-    if (!m_FreePools.empty())
-    {
-        Pool* res = m_FreePools.back();
-        m_FreePools.pop_back();
-        res->Reserve(numBytes);
-        return res;
-    }
-    else
+    if (m_Arena)
     {
-        m_Pools.push_front(Pool(numBytes));
-        return &m_Pools.front();
+        Release();
     }
 }
 
+RefMemoryManager::Pool* RefMemoryManager::Manage(unsigned int numBytes)
+{
+    m_Pools.emplace_front(numBytes, m_NextUse++);
+    m_IsPlanned = false;
+    return &m_Pools.front();
+}
+
 void RefMemoryManager::Allocate(RefMemoryManager::Pool* pool)
 {
     ARMNN_ASSERT(pool);
-    m_FreePools.push_back(pool);
+    pool->m_LastUse = m_NextUse++;
+    m_IsPlanned = false;
 }
 
 void* RefMemoryManager::GetPointer(RefMemoryManager::Pool* pool)
 {
-    return pool->GetPointer();
+    ARMNN_ASSERT_MSG(m_Arena, "RefMemoryManager::GetPointer() called when memory not acquired");
+    return static_cast<char*>(m_Arena.get()) + pool->m_Offset;
 }
 
 void RefMemoryManager::Acquire()
 {
-    for (Pool &pool: m_Pools)
+    ARMNN_ASSERT_MSG(!m_Arena, "RefMemoryManager::Acquire() called when memory already acquired");
+    if (m_Pools.empty())
     {
-         pool.Acquire();
+        return;
     }
-}
 
-void RefMemoryManager::Release()
-{
-    for (Pool &pool: m_Pools)
+    if (!m_IsPlanned)
     {
-         pool.Release();
+        Plan();
+        ARMNN_LOG(debug) << "RefMemoryManager: " << GetUnsharedSize() << " bytes of tensors planned into "
+                         << m_PlannedSize << " bytes";
     }
+    // The arena is never empty, so that acquired memory always has a distinct address.
+    m_Arena = m_Allocator.Allocate(std::max<size_t>(m_PlannedSize, 1));
 }
 
-RefMemoryManager::Pool::Pool(unsigned int numBytes)
-    : m_Size(numBytes),
-      m_Pointer(nullptr)
-{}
-
-RefMemoryManager::Pool::~Pool()
+void RefMemoryManager::Release()
 {
-    if (m_Pointer)
-    {
-        Release();
-    }
+    m_Arena.reset();
 }
 
-void* RefMemoryManager::Pool::GetPointer()
+size_t RefMemoryManager::GetAcquiredBytes() const
 {
-    ARMNN_ASSERT_MSG(m_Pointer, "RefMemoryManager::Pool::GetPointer() called when memory not acquired");
-    return m_Pointer;
+    return m_Arena ? std::max<size_t>(m_PlannedSize, 1) : 0;
 }
 
-void RefMemoryManager::Pool::Reserve(unsigned int numBytes)
+size_t RefMemoryManager::GetPlannedSize()
 {
-    ARMNN_ASSERT_MSG(!m_Pointer, "RefMemoryManager::Pool::Reserve() cannot be called after memory acquired");
-    m_Size = std::max(m_Size, numBytes);
+    if (!m_IsPlanned)
+    {
+        Plan();
+    }
+    return m_PlannedSize;
 }
 
-void RefMemoryManager::Pool::Acquire()
+size_t RefMemoryManager::GetUnsharedSize() const
 {
-    ARMNN_ASSERT_MSG(!m_Pointer, "RefMemoryManager::Pool::Acquire() called when memory already acquired");
-    m_Pointer = ::operator new(size_t(m_Size));
+    size_t size = 0;
+    for (const Pool& pool : m_Pools)
+    {
+        size += pool.m_Size;
+    }
+    return size;
 }
 
-void RefMemoryManager::Pool::Release()
+void RefMemoryManager::Plan()
 {
-    ARMNN_ASSERT_MSG(m_Pointer, "RefMemoryManager::Pool::Release() called when memory not acquired");
-    ::operator delete(m_Pointer);
-    m_Pointer = nullptr;
+    ARMNN_ASSERT_MSG(!m_Arena, "RefMemoryManager: tensors managed while memory acquired");
+
+    // Places the largest pools first, as they are the hardest to fit into the gaps between others.
+    std::vector<Pool*> pools;
+    for (Pool& pool : m_Pools)
+    {
+        pools.push_back(&pool);
+    }
+    std::stable_sort(pools.begin(), pools.end(), [](const Pool* lhs, const Pool* rhs)
+    {
+        return lhs->m_Size > rhs->m_Size || (lhs->m_Size == rhs->m_Size && lhs->m_FirstUse < rhs->m_FirstUse);
+    });
+
+    const size_t alignment = m_Allocator.GetAlignment();
+    m_PlannedSize = 0;
+    std::vector<const Pool*> placedPools;
+    std::vector<const Pool*> livePools;
+    for (Pool* pool : pools)
+    {
+        // Finds the pools already placed which are live at the same time, in order of offset.
+        livePools.clear();
+        for (const Pool* placedPool : placedPools)
+        {
+            if (placedPool->m_FirstUse <= pool->m_LastUse && pool->m_FirstUse <= placedPool->m_LastUse)
+            {
+                livePools.push_back(placedPool);
+            }
+        }
+        std::sort(livePools.begin(), livePools.end(), [](const Pool* lhs, const Pool* rhs)
+        {
+            return lhs->m_Offset < rhs->m_Offset;
+        });
+
+        // Takes the smallest gap between them the pool fits into, or else the end of the last one.
+        size_t bestOffset = std::numeric_limits<size_t>::max();
+        size_t bestGap    = std::numeric_limits<size_t>::max();
+        size_t gapStart   = 0;
+        for (const Pool* livePool : livePools)
+        {
+            if (livePool->m_Offset > gapStart)
+            {
+                const size_t gap = livePool->m_Offset - gapStart;
+                if (gap >= pool->m_Size && gap < bestGap)
+                {
+                    bestOffset = gapStart;
+                    bestGap    = gap;
+                }
+            }
+            const size_t liveEnd = livePool->m_Offset + livePool->m_Size;
+            gapStart = std::max(gapStart, (liveEnd + alignment - 1) / alignment * alignment);
+        }
+        pool->m_Offset = bestOffset != std::numeric_limits<size_t>::max() ? bestOffset : gapStart;
+
+        m_PlannedSize = std::max(m_PlannedSize, pool->m_Offset + pool->m_Size);
+        placedPools.push_back(pool);
+    }
+    m_IsPlanned = true;
 }
 
+RefMemoryManager::Pool::Pool(unsigned int numBytes, unsigned int firstUse)
+    : m_Size(numBytes),
+      m_FirstUse(firstUse),
+      m_LastUse(std::numeric_limits<unsigned int>::max()),
+      m_Offset(0)
+{}
+
 }
@@ -4,21 +4,32 @@
 //
 #pragma once
 
+#include "RefMemoryAllocator.hpp"
+
 #include <armnn/backends/IMemoryManager.hpp>
 
+#include <cstddef>
 #include <forward_list>
 #include <vector>
 
 namespace armnn
 {
 
-// An implementation of IMemoryManager to be used with RefTensorHandle
+// An implementation of IMemoryManager to be used with RefTensorHandle.
+//
+// Managed tensors are live from the call to Manage() which returns their pool until the call to Allocate() on it,
+// or until the end if it is never called. On Acquire(), the pools are placed at offsets of a single arena such that
+// no two pools live at the same time overlap, packing them greedily by decreasing size into the best fitting gap.
+// The arena comes from the RefMemoryAllocator the manager was created with, whose alignment the offsets of the pools
+// are multiples of.
 class RefMemoryManager : public IMemoryManager
 {
 public:
-    RefMemoryManager();
+    explicit RefMemoryManager(const RefMemoryAllocator& allocator = RefMemoryAllocator());
     virtual ~RefMemoryManager();
 
+    const RefMemoryAllocator& GetAllocator() const { return m_Allocator; }
+
     class Pool;
 
     Pool* Manage(unsigned int numBytes);
@@ -30,30 +41,49 @@ public:
     void Acquire() override;
     void Release() override;
 
+    /// Size of the arena while memory is acquired.
+    size_t GetAcquiredBytes() const override;
+
+    /// Size of the arena the managed tensors are packed into, planned on the next Acquire() if they have changed.
+    size_t GetPlannedSize();
+
+    /// Size the managed tensors would take without sharing any memory.
+    size_t GetUnsharedSize() const;
+
+    /// Region of the arena holding a managed tensor.
     class Pool
     {
     public:
-        Pool(unsigned int numBytes);
-        ~Pool();
+        Pool(unsigned int numBytes, unsigned int firstUse);
 
-        void Acquire();
-        void Release();
+    private:
+        friend class RefMemoryManager;
 
-        void* GetPointer();
+        unsigned int m_Size;
 
-        void Reserve(unsigned int numBytes);
+        /// Events, counted over the calls to Manage() and Allocate(), between which the tensor is live.
+        unsigned int m_FirstUse;
+        unsigned int m_LastUse;
 
-    private:
-        unsigned int m_Size;
-        void* m_Pointer;
+        size_t m_Offset;
     };
-    
+
 private:
     RefMemoryManager(const RefMemoryManager&) = delete; // Noncopyable
     RefMemoryManager& operator=(const RefMemoryManager&) = delete; // Noncopyable
 
+    /// Assigns the offset of each pool, as multiples of the alignment of the allocator, and sets m_PlannedSize.
+    void Plan();
+
+    const RefMemoryAllocator m_Allocator;
+
     std::forward_list<Pool> m_Pools;
-    std::vector<Pool*> m_FreePools;
+    unsigned int m_NextUse;
+
+    bool m_IsPlanned;
+    size_t m_PlannedSize;
+
+    RefMemoryAllocator::MemoryPtr m_Arena;
 };
 
 }
@@ -14,7 +14,9 @@ RefTensorHandle::RefTensorHandle(const TensorInfo &tensorInfo, std::shared_ptr<R
     m_UnmanagedMemory(nullptr),
     m_ImportFlags(static_cast<MemorySourceFlags>(MemorySource::Undefined)),
     m_Imported(false),
-    m_IsImportEnabled(false)
+    m_IsImportEnabled(false),
+    m_Parent(nullptr),
+    m_ParentOffset(0)
 {
 
 }
@@ -26,26 +28,33 @@ RefTensorHandle::RefTensorHandle(const TensorInfo& tensorInfo,
                                    m_UnmanagedMemory(nullptr),
                                    m_ImportFlags(importFlags),
                                    m_Imported(false),
-                                   m_IsImportEnabled(true)
+                                   m_IsImportEnabled(true),
+                                   m_Parent(nullptr),
+                                   m_ParentOffset(0)
 {
 
 }
 
-RefTensorHandle::~RefTensorHandle()
+RefTensorHandle::RefTensorHandle(const TensorInfo& tensorInfo, RefTensorHandle& parent, unsigned int parentOffset)
+    : m_TensorInfo(tensorInfo),
+      m_Pool(nullptr),
+      m_UnmanagedMemory(nullptr),
+      m_ImportFlags(static_cast<MemorySourceFlags>(MemorySource::Undefined)),
+      m_Imported(false),
+      m_IsImportEnabled(false),
+      m_Parent(&parent),
+      m_ParentOffset(parentOffset)
 {
-    if (!m_Pool)
-    {
-        // unmanaged
-        if (!m_Imported)
-        {
-            ::operator delete(m_UnmanagedMemory);
-        }
-    }
+    ARMNN_ASSERT(parentOffset + tensorInfo.GetNumBytes() <= parent.GetTensorInfo().GetNumBytes());
 }
 
+RefTensorHandle::~RefTensorHandle()
+{}
+
 void RefTensorHandle::Manage()
 {
-    if (!m_IsImportEnabled)
+    // Sub-tensors use the memory of their parent, which is managed instead.
+    if (!m_IsImportEnabled && !m_Parent)
     {
         ARMNN_ASSERT_MSG(!m_Pool, "RefTensorHandle::Manage() called twice");
         ARMNN_ASSERT_MSG(!m_UnmanagedMemory, "RefTensorHandle::Manage() called after Allocate()");
@@ -57,7 +66,7 @@ void RefTensorHandle::Manage()
 void RefTensorHandle::Allocate()
 {
     // If import is enabled, do not allocate the tensor
-    if (!m_IsImportEnabled)
+    if (!m_IsImportEnabled && !m_Parent)
     {
 
         if (!m_UnmanagedMemory)
@@ -65,7 +74,10 @@ void RefTensorHandle::Allocate()
             if (!m_Pool)
             {
                 // unmanaged
-                m_UnmanagedMemory = ::operator new(m_TensorInfo.GetNumBytes());
+                const size_t numBytes = m_TensorInfo.GetNumBytes();
+                m_AllocatedMemory = m_MemoryManager ? m_MemoryManager->GetAllocator().Allocate(numBytes)
+                                                    : RefMemoryAllocator().Allocate(numBytes);
+                m_UnmanagedMemory = m_AllocatedMemory.get();
             }
             else
             {
@@ -82,12 +94,38 @@ void RefTensorHandle::Allocate()
 
 const void* RefTensorHandle::Map(bool /*unused*/) const
 {
+    // Sub-tensors map their parent, so that the CPU access to an imported dma-buf it holds begins.
+    if (m_Parent)
+    {
+        return static_cast<const char*>(m_Parent->Map()) + m_ParentOffset;
+    }
+    if (m_DmaBufMapping)
+    {
+        m_DmaBufMapping->BeginCpuAccess();
+    }
     return GetPointer();
 }
 
+void RefTensorHandle::Unmap() const
+{
+    if (m_Parent)
+    {
+        m_Parent->Unmap();
+        return;
+    }
+    if (m_DmaBufMapping)
+    {
+        m_DmaBufMapping->EndCpuAccess();
+    }
+}
+
 void* RefTensorHandle::GetPointer() const
 {
-    if (m_UnmanagedMemory)
+    if (m_Parent)
+    {
+        return static_cast<char*>(m_Parent->GetPointer()) + m_ParentOffset;
+    }
+    else if (m_UnmanagedMemory)
     {
         return m_UnmanagedMemory;
     }
@@ -119,18 +157,18 @@ bool RefTensorHandle::Import(void* memory, MemorySource source)
 {
     if (m_ImportFlags & static_cast<MemorySourceFlags>(source))
     {
+        if (m_IsImportEnabled && source == MemorySource::DmaBuf)
+        {
+            return ImportDmaBuf(*static_cast<int*>(memory));
+        }
+
         if (m_IsImportEnabled && source == MemorySource::Malloc)
         {
             // Check memory alignment
             constexpr uintptr_t alignment = sizeof(size_t);
             if (reinterpret_cast<uintptr_t>(memory) % alignment)
             {
-                if (m_Imported)
-                {
-                    m_Imported = false;
-                    m_UnmanagedMemory = nullptr;
-                }
-
+                ReleaseImport();
                 return false;
             }
 
@@ -151,6 +189,7 @@ bool RefTensorHandle::Import(void* memory, MemorySource source)
             // m_UnmanagedMemory previously imported.
             if (m_Imported)
             {
+                m_DmaBufMapping.reset();
                 m_UnmanagedMemory = memory;
                 return true;
             }
@@ -160,4 +199,41 @@ bool RefTensorHandle::Import(void* memory, MemorySource source)
     return false;
 }
 
+bool RefTensorHandle::ImportDmaBuf(int fd)
+{
+    // m_UnmanagedMemory initially allocated with Allocate().
+    if (!m_Imported && m_UnmanagedMemory)
+    {
+        return false;
+    }
+
+    if (m_DmaBufMapping && m_DmaBufMapping->IsMappingOf(fd))
+    {
+        // The buffer is already mapped, a new inference is about to use it.
+        m_DmaBufMapping->EndCpuAccess();
+        return true;
+    }
+
+    std::unique_ptr<RefDmaBufMapping> mapping = RefDmaBufMapping::Create(fd, m_TensorInfo.GetNumBytes());
+    if (!mapping)
+    {
+        ReleaseImport();
+        return false;
+    }
+    m_DmaBufMapping = std::move(mapping);
+    m_UnmanagedMemory = m_DmaBufMapping->GetData();
+    m_Imported = true;
+    return true;
+}
+
+void RefTensorHandle::ReleaseImport()
+{
+    if (m_Imported)
+    {
+        m_Imported = false;
+        m_UnmanagedMemory = nullptr;
+        m_DmaBufMapping.reset();
+    }
+}
+
 }
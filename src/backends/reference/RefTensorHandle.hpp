@@ -6,6 +6,7 @@
 
 #include <backendsCommon/CpuTensorHandle.hpp>
 
+#include "RefDmaBufMapping.hpp"
 #include "RefMemoryManager.hpp"
 
 namespace armnn
@@ -19,6 +20,9 @@ public:
 
     RefTensorHandle(const TensorInfo& tensorInfo, MemorySourceFlags importFlags);
 
+    /// Creates a sub-tensor using the memory of the parent from the given byte offset, which must be contiguous.
+    RefTensorHandle(const TensorInfo& tensorInfo, RefTensorHandle& parent, unsigned int parentOffset);
+
     ~RefTensorHandle();
 
     virtual void Manage() override;
@@ -27,14 +31,15 @@ public:
 
     virtual ITensorHandle* GetParent() const override
     {
-        return nullptr;
+        return m_Parent;
     }
 
+    /// For imported dma-bufs, Map() begins an access of the CPU to the buffer and Unmap() ends it. Sub-tensors map
+    /// and unmap their parent.
     virtual const void* Map(bool /* blocking = true */) const override;
     using ITensorHandle::Map;
 
-    virtual void Unmap() const override
-    {}
+    virtual void Unmap() const override;
 
     TensorShape GetStrides() const override
     {
@@ -56,9 +61,15 @@ public:
         return m_ImportFlags;
     }
 
+    /// With MemorySource::DmaBuf, memory points to the int file descriptor of the buffer, which is mapped rather than
+    /// copied. The buffer stays mapped until the handle imports other memory or is destroyed, importing it again only
+    /// ends the CPU access of the previous inference.
     virtual bool Import(void* memory, MemorySource source) override;
 
 private:
+    bool ImportDmaBuf(int fd);
+    void ReleaseImport();
+
     // Only used for testing
     void CopyOutTo(void*) const override;
     void CopyInFrom(const void*) override;
@@ -73,9 +84,15 @@ private:
     std::shared_ptr<RefMemoryManager> m_MemoryManager;
     RefMemoryManager::Pool* m_Pool;
     mutable void* m_UnmanagedMemory;
+    /// Owns m_UnmanagedMemory when it was allocated rather than imported.
+    RefMemoryAllocator::MemoryPtr m_AllocatedMemory;
+    /// Mapping of the imported dma-buf m_UnmanagedMemory points to, if any.
+    std::unique_ptr<RefDmaBufMapping> m_DmaBufMapping;
     MemorySourceFlags m_ImportFlags;
     bool m_Imported;
     bool m_IsImportEnabled;
+    RefTensorHandle* m_Parent;
+    unsigned int m_ParentOffset;
 };
 
 }
@@ -6,13 +6,38 @@
 #include "RefTensorHandleFactory.hpp"
 #include "RefTensorHandle.hpp"
 
+#include "Layer.hpp"
+
 #include <armnn/utility/IgnoreUnused.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+
+#include <set>
 
 namespace armnn
 {
 
 using FactoryId = ITensorHandleFactory::FactoryId;
 
+namespace
+{
+
+// Layers whose workloads read each element of their inputs before writing the same element of their output,
+// and nothing else, so they can run with their output over one of their inputs.
+const std::set<LayerType> inPlaceComputationLayers {
+    LayerType::Activation,
+    LayerType::Addition,
+    LayerType::BatchNormalization,
+    LayerType::Division,
+    LayerType::ElementwiseUnary,
+    LayerType::Floor,
+    LayerType::Maximum,
+    LayerType::Minimum,
+    LayerType::Multiplication,
+    LayerType::Subtraction
+};
+
+} // anonymous namespace
+
 const FactoryId& RefTensorHandleFactory::GetIdStatic()
 {
     static const FactoryId s_Id(RefTensorHandleFactoryId());
@@ -23,8 +48,50 @@ std::unique_ptr<ITensorHandle> RefTensorHandleFactory::CreateSubTensorHandle(ITe
                                                                              TensorShape const& subTensorShape,
                                                                              unsigned int const* subTensorOrigin) const
 {
-    IgnoreUnused(parent, subTensorShape, subTensorOrigin);
-    return nullptr;
+    // Reference workloads only handle tensors without padding, so sub-tensors are only supported if they are
+    // contiguous in their parent: a single element wide on the dimensions before some dimension, and spanning
+    // the whole parent on the dimensions after it. This covers views along the outermost axis which isn't 1.
+    RefTensorHandle& refParent = *PolymorphicDowncast<RefTensorHandle*>(&parent);
+    const TensorInfo& parentInfo = refParent.GetTensorInfo();
+    const TensorShape& parentShape = parentInfo.GetShape();
+    const unsigned int numDimensions = subTensorShape.GetNumDimensions();
+    if (numDimensions != parentShape.GetNumDimensions())
+    {
+        return nullptr;
+    }
+
+    unsigned int firstDimension = 0;
+    while (firstDimension + 1 < numDimensions && subTensorShape[firstDimension] == 1)
+    {
+        ++firstDimension;
+    }
+
+    const TensorShape parentStrides = GetUnpaddedTensorStrides(parentInfo);
+    unsigned int offset = 0;
+    for (unsigned int i = 0; i < numDimensions; ++i)
+    {
+        if (subTensorOrigin[i] + subTensorShape[i] > parentShape[i] ||
+            (i > firstDimension && subTensorShape[i] != parentShape[i]))
+        {
+            return nullptr;
+        }
+        offset += subTensorOrigin[i] * parentStrides[i];
+    }
+
+    TensorInfo subTensorInfo(parentInfo);
+    subTensorInfo.SetShape(subTensorShape);
+    return std::make_unique<RefTensorHandle>(subTensorInfo, refParent, offset);
+}
+
+std::unique_ptr<ITensorHandle> RefTensorHandleFactory::CreateAliasTensorHandle(ITensorHandle& parent,
+                                                                               const TensorInfo& tensorInfo) const
+{
+    RefTensorHandle& refParent = *PolymorphicDowncast<RefTensorHandle*>(&parent);
+    if (tensorInfo.GetNumBytes() != refParent.GetTensorInfo().GetNumBytes())
+    {
+        return nullptr;
+    }
+    return std::make_unique<RefTensorHandle>(tensorInfo, refParent, 0);
 }
 
 std::unique_ptr<ITensorHandle> RefTensorHandleFactory::CreateTensorHandle(const TensorInfo& tensorInfo) const
@@ -74,7 +141,7 @@ const FactoryId& RefTensorHandleFactory::GetId() const
 
 bool RefTensorHandleFactory::SupportsSubTensors() const
 {
-    return false;
+    return true;
 }
 
 MemorySourceFlags RefTensorHandleFactory::GetExportFlags() const
@@ -87,4 +154,21 @@ MemorySourceFlags RefTensorHandleFactory::GetImportFlags() const
     return m_ImportFlags;
 }
 
+std::vector<Capability> RefTensorHandleFactory::GetCapabilities(const IConnectableLayer* layer,
+                                                                const IConnectableLayer* connectedLayer,
+                                                                CapabilityClass capabilityClass)
+{
+    IgnoreUnused(connectedLayer);
+    std::vector<Capability> capabilities;
+    if (capabilityClass == CapabilityClass::InPlaceComputation)
+    {
+        auto search = inPlaceComputationLayers.find((PolymorphicDowncast<const Layer*>(layer))->GetType());
+        if (search != inPlaceComputationLayers.end())
+        {
+            capabilities.push_back(Capability(CapabilityClass::InPlaceComputation, true));
+        }
+    }
+    return capabilities;
+}
+
 } // namespace armnn
\ No newline at end of file
@@ -20,14 +20,19 @@ class RefTensorHandleFactory : public ITensorHandleFactory
 public:
     RefTensorHandleFactory(std::shared_ptr<RefMemoryManager> mgr)
     : m_MemoryManager(mgr),
-      m_ImportFlags(static_cast<MemorySourceFlags>(MemorySource::Malloc)),
-      m_ExportFlags(static_cast<MemorySourceFlags>(MemorySource::Malloc))
+      m_ImportFlags(static_cast<MemorySourceFlags>(MemorySource::Malloc) |
+                    static_cast<MemorySourceFlags>(MemorySource::DmaBuf)),
+      m_ExportFlags(static_cast<MemorySourceFlags>(MemorySource::Malloc) |
+                    static_cast<MemorySourceFlags>(MemorySource::DmaBuf))
     {}
 
     std::unique_ptr<ITensorHandle> CreateSubTensorHandle(ITensorHandle& parent,
                                                          TensorShape const& subTensorShape,
                                                          unsigned int const* subTensorOrigin) const override;
 
+    std::unique_ptr<ITensorHandle> CreateAliasTensorHandle(ITensorHandle& parent,
+                                                           const TensorInfo& tensorInfo) const override;
+
     std::unique_ptr<ITensorHandle> CreateTensorHandle(const TensorInfo& tensorInfo) const override;
 
     std::unique_ptr<ITensorHandle> CreateTensorHandle(const TensorInfo& tensorInfo,
@@ -50,6 +55,10 @@ public:
 
     MemorySourceFlags GetImportFlags() const override;
 
+    std::vector<Capability> GetCapabilities(const IConnectableLayer* layer,
+                                            const IConnectableLayer* connectedLayer,
+                                            CapabilityClass capabilityClass) override;
+
 private:
     mutable std::shared_ptr<RefMemoryManager> m_MemoryManager;
     MemorySourceFlags m_ImportFlags;
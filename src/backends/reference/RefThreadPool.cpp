@@ -0,0 +1,112 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "RefThreadPool.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Number of elementary operations below which handing work over to another thread costs more than it saves.
+constexpr uint64_t g_MinRangeCost = 16384;
+
+} // anonymous namespace
+
+RefThreadPool::RefThreadPool(unsigned int numThreads)
+{
+    if (numThreads > 1)
+    {
+        m_Workers = std::make_unique<WorkStealingThreadPool>(numThreads - 1);
+    }
+}
+
+unsigned int RefThreadPool::GetNumberOfThreads() const
+{
+    return m_Workers ? m_Workers->GetNumThreads() + 1 : 1;
+}
+
+void RefThreadPool::ParallelFor(unsigned int count, unsigned int itemCost, const RangeFunction& function)
+{
+    const uint64_t totalCost = static_cast<uint64_t>(count) * std::max(itemCost, 1u);
+    const unsigned int numRanges = static_cast<unsigned int>(std::min<uint64_t>(
+        { totalCost / g_MinRangeCost, count, GetNumberOfThreads() }));
+    if (numRanges <= 1)
+    {
+        if (count > 0)
+        {
+            function(0, count);
+        }
+        return;
+    }
+
+    auto RangeBegin = [count, numRanges](unsigned int range)
+    {
+        return static_cast<unsigned int>(static_cast<uint64_t>(count) * range / numRanges);
+    };
+
+    std::mutex mutex;
+    std::condition_variable finished;
+    unsigned int numPending = numRanges - 1;
+    std::exception_ptr error;
+
+    auto RecordError = [&mutex, &error](std::exception_ptr rangeError)
+    {
+        std::lock_guard<std::mutex> lockGuard(mutex);
+        if (!error)
+        {
+            error = rangeError;
+        }
+    };
+
+    for (unsigned int range = 1; range < numRanges; ++range)
+    {
+        const unsigned int begin = RangeBegin(range);
+        const unsigned int end   = RangeBegin(range + 1);
+        m_Workers->Schedule([&, begin, end]()
+        {
+            try
+            {
+                function(begin, end);
+            }
+            catch (...)
+            {
+                RecordError(std::current_exception());
+            }
+
+            // Notifies with the mutex held, as the waiting thread destroys the condition variable once it wakes up.
+            std::lock_guard<std::mutex> lockGuard(mutex);
+            if (--numPending == 0)
+            {
+                finished.notify_one();
+            }
+        });
+    }
+
+    try
+    {
+        function(0, RangeBegin(1));
+    }
+    catch (...)
+    {
+        RecordError(std::current_exception());
+    }
+
+    std::unique_lock<std::mutex> lock(mutex);
+    finished.wait(lock, [&numPending] { return numPending == 0; });
+
+    if (error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+} // namespace armnn
@@ -0,0 +1,41 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <backendsCommon/WorkStealingThreadPool.hpp>
+
+#include <functional>
+#include <memory>
+
+namespace armnn
+{
+
+/// Worker threads shared by the CpuRef workloads of the networks a runtime loads, see RefBackendContext, which the
+/// heavy kernels use to compute disjoint parts of their output at the same time. Every part is computed exactly as it
+/// would be on a single thread, so the results don't depend on the number of threads.
+class RefThreadPool
+{
+public:
+    using RangeFunction = std::function<void(unsigned int begin, unsigned int end)>;
+
+    /// @param numThreads Number of threads kernels run on, the thread running the workload included.
+    ///                   With 0 or 1 every kernel runs on the thread running the workload only.
+    explicit RefThreadPool(unsigned int numThreads = 1);
+
+    unsigned int GetNumberOfThreads() const;
+
+    /// Splits [0, count) into contiguous ranges, at most one per thread, and calls function(begin, end) for each of
+    /// them. One of the ranges is processed on the calling thread. itemCost estimates the number of elementary
+    /// operations needed per item, so that items too cheap to be worth a thread aren't split between threads.
+    /// Returns once all the ranges are processed, rethrowing the first exception thrown by function.
+    void ParallelFor(unsigned int count, unsigned int itemCost, const RangeFunction& function);
+
+private:
+    /// Threads helping the calling thread, null when kernels run on a single thread.
+    std::unique_ptr<WorkStealingThreadPool> m_Workers;
+};
+
+} // namespace armnn
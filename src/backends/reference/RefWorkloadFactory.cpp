@@ -81,13 +81,20 @@ bool IsQAsymmU8(const WorkloadInfo& info)
     return IsDataType<DataType::QAsymmU8>(info);
 }
 
+RefWorkloadFactory::RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager,
+                                       std::shared_ptr<RefThreadPool> threadPool)
+    : m_MemoryManager(memoryManager),
+      m_ThreadPool(std::move(threadPool))
+{
+}
+
 RefWorkloadFactory::RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager)
-    : m_MemoryManager(memoryManager)
+    : RefWorkloadFactory(memoryManager, std::make_shared<RefThreadPool>())
 {
 }
 
 RefWorkloadFactory::RefWorkloadFactory()
-    : m_MemoryManager(new RefMemoryManager())
+    : RefWorkloadFactory(std::make_shared<RefMemoryManager>())
 {
 }
 
@@ -143,11 +150,11 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateAddition(const AdditionQueu
 {
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
-        return std::make_unique<RefAdditionWorkload<int32_t>>(descriptor, info);
+        return std::make_unique<RefAdditionWorkload<int32_t>>(descriptor, info, m_ThreadPool);
     }
     else
     {
-        return std::make_unique<RefAdditionWorkload<float>>(descriptor, info);
+        return std::make_unique<RefAdditionWorkload<float>>(descriptor, info, m_ThreadPool);
     }
 }
 
@@ -219,7 +226,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateConvertFp32ToFp16(
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateConvolution2d(const Convolution2dQueueDescriptor& descriptor,
                                                                    const WorkloadInfo& info) const
 {
-    return std::make_unique<RefConvolution2dWorkload>(descriptor, info);
+    return std::make_unique<RefConvolution2dWorkload>(descriptor, info, m_ThreadPool);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateDebug(const DebugQueueDescriptor& descriptor,
@@ -267,7 +274,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateDepthwiseConvolution2d(
     const DepthwiseConvolution2dQueueDescriptor& descriptor,
     const WorkloadInfo& info) const
 {
-    return std::make_unique<RefDepthwiseConvolution2dWorkload>(descriptor, info);
+    return std::make_unique<RefDepthwiseConvolution2dWorkload>(descriptor, info, m_ThreadPool);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateDequantize(const DequantizeQueueDescriptor& descriptor,
@@ -288,11 +295,11 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateDivision(const DivisionQueu
 {
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
-        return std::make_unique<RefDivisionWorkload<int32_t>>(descriptor, info);
+        return std::make_unique<RefDivisionWorkload<int32_t>>(descriptor, info, m_ThreadPool);
     }
     else
     {
-        return std::make_unique<RefDivisionWorkload<float>>(descriptor, info);
+        return std::make_unique<RefDivisionWorkload<float>>(descriptor, info, m_ThreadPool);
     }
 }
 
@@ -341,7 +348,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateFullyConnected(
     const FullyConnectedQueueDescriptor& descriptor,
     const WorkloadInfo& info) const
 {
-    return std::make_unique<RefFullyConnectedWorkload>(descriptor, info);
+    return std::make_unique<RefFullyConnectedWorkload>(descriptor, info, m_ThreadPool);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateGather(const GatherQueueDescriptor& descriptor,
@@ -410,11 +417,11 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateMaximum(const MaximumQueueD
 {
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
-        return std::make_unique<RefMaximumWorkload<int32_t>>(descriptor, info);
+        return std::make_unique<RefMaximumWorkload<int32_t>>(descriptor, info, m_ThreadPool);
     }
     else
     {
-        return std::make_unique<RefMaximumWorkload<float>>(descriptor, info);
+        return std::make_unique<RefMaximumWorkload<float>>(descriptor, info, m_ThreadPool);
     }
 }
 
@@ -455,11 +462,11 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateMinimum(const MinimumQueueD
 {
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
-        return std::make_unique<RefMinimumWorkload<int32_t>>(descriptor, info);
+        return std::make_unique<RefMinimumWorkload<int32_t>>(descriptor, info, m_ThreadPool);
     }
     else
     {
-        return std::make_unique<RefMinimumWorkload<float>>(descriptor, info);
+        return std::make_unique<RefMinimumWorkload<float>>(descriptor, info, m_ThreadPool);
     }
 }
 
@@ -468,11 +475,11 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateMultiplication(const Multip
 {
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
-        return std::make_unique<RefMultiplicationWorkload<int32_t>>(descriptor, info);
+        return std::make_unique<RefMultiplicationWorkload<int32_t>>(descriptor, info, m_ThreadPool);
     }
     else
     {
-        return std::make_unique<RefMultiplicationWorkload<float>>(descriptor, info);
+        return std::make_unique<RefMultiplicationWorkload<float>>(descriptor, info, m_ThreadPool);
     }
 }
 
@@ -529,7 +536,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePermute(const PermuteQueueD
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePooling2d(const Pooling2dQueueDescriptor& descriptor,
                                                                const WorkloadInfo& info) const
 {
-    return std::make_unique<RefPooling2dWorkload>(descriptor, info);
+    return std::make_unique<RefPooling2dWorkload>(descriptor, info, m_ThreadPool);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreatePreCompiled(const PreCompiledQueueDescriptor& /*descriptor*/,
@@ -605,7 +612,7 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateSlice(const SliceQueueDescr
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateSoftmax(const SoftmaxQueueDescriptor& descriptor,
                                                              const WorkloadInfo& info) const
 {
-    return std::make_unique<RefSoftmaxWorkload>(descriptor, info);
+    return std::make_unique<RefSoftmaxWorkload>(descriptor, info, m_ThreadPool);
 }
 
 std::unique_ptr<IWorkload> RefWorkloadFactory::CreateSpaceToBatchNd(const SpaceToBatchNdQueueDescriptor& descriptor,
@@ -643,11 +650,11 @@ std::unique_ptr<IWorkload> RefWorkloadFactory::CreateSubtraction(const Subtracti
 {
     if (info.m_InputTensorInfos[0].GetDataType() == armnn::DataType::Signed32)
     {
-        return std::make_unique<RefSubtractionWorkload<int32_t>>(descriptor, info);
+        return std::make_unique<RefSubtractionWorkload<int32_t>>(descriptor, info, m_ThreadPool);
     }
     else
     {
-        return std::make_unique<RefSubtractionWorkload<float>>(descriptor, info);
+        return std::make_unique<RefSubtractionWorkload<float>>(descriptor, info, m_ThreadPool);
     }
 }
 
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "RefMemoryManager.hpp"
+#include "RefThreadPool.hpp"
 
 #include <armnn/Optional.hpp>
 #include <backendsCommon/WorkloadFactory.hpp>
@@ -30,6 +31,10 @@ constexpr bool IsOperationQueueDescriptor(const PermuteQueueDescriptor&) { retur
 class RefWorkloadFactory : public IWorkloadFactory
 {
 public:
+    /// The workloads split their work between the threads of threadPool, which the factory creates with a single
+    /// thread if not given.
+    RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager,
+                       std::shared_ptr<RefThreadPool> threadPool);
     explicit RefWorkloadFactory(const std::shared_ptr<RefMemoryManager>& memoryManager);
     RefWorkloadFactory();
 
@@ -264,6 +269,7 @@ private:
     std::unique_ptr<IWorkload> MakeWorkload(const QueueDescriptorType& descriptor, const WorkloadInfo& info) const;
 
     mutable std::shared_ptr<RefMemoryManager> m_MemoryManager;
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 } // namespace armnn
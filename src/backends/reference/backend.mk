@@ -15,12 +15,16 @@ ifeq ($(ARMNN_REF_ENABLED),1)
 
 BACKEND_SOURCES := \
         RefBackend.cpp \
+        RefBackendContext.cpp \
+        RefDmaBufMapping.cpp \
         RefLayerSupport.cpp \
+        RefMemoryAllocator.cpp \
         RefMemoryManager.cpp \
         RefTensorHandle.cpp \
         RefWorkloadFactory.cpp \
         RefRegistryInitializer.cpp \
         RefTensorHandleFactory.cpp \
+        RefThreadPool.cpp \
         workloads/Activation.cpp \
         workloads/ArgMinMax.cpp \
         workloads/BatchNormImpl.cpp \
@@ -35,6 +39,7 @@ BACKEND_SOURCES := \
         workloads/Fill.cpp \
         workloads/FullyConnected.cpp \
         workloads/Gather.cpp \
+        workloads/GemmConvolution.cpp \
         workloads/InstanceNorm.cpp \
         workloads/LogSoftmax.cpp \
         workloads/LstmUtils.cpp \
@@ -125,6 +130,7 @@ BACKEND_TEST_SOURCES := \
         test/RefCreateWorkloadTests.cpp \
         test/RefDetectionPostProcessTests.cpp \
         test/RefEndToEndTests.cpp \
+        test/RefGemmConvolutionTests.cpp \
         test/RefJsonPrinterTests.cpp \
         test/RefLayerSupportTests.cpp \
         test/RefLayerTests.cpp \
@@ -29,6 +29,11 @@
 #include <boost/test/unit_test.hpp>
 #include <boost/test/execution_monitor.hpp>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 BOOST_AUTO_TEST_SUITE(RefEndToEnd)
 
 std::vector<armnn::BackendId> defaultBackends = {armnn::Compute::CpuRef};
@@ -1330,6 +1335,124 @@ BOOST_AUTO_TEST_CASE(RefStridedSliceInvalidSliceEndToEndTest)
     StridedSliceInvalidSliceEndToEndTest(defaultBackends);
 }
 
+#if defined(MFD_CLOEXEC)
+BOOST_AUTO_TEST_CASE(RefImportAndExportDmaBufTest)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    INetworkPtr net(INetwork::Create());
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::Square;
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* activation = net->AddActivationLayer(descriptor);
+    IConnectableLayer* output = net->AddOutputLayer(0);
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 1, 4 }, DataType::Float32));
+    activation->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 1, 4 }, DataType::Float32));
+
+    NetworkId netId;
+    std::string ignoredErrorMessage;
+    INetworkProperties networkProperties(true, true, 0, 0, MemorySource::DmaBuf, MemorySource::DmaBuf);
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*net, defaultBackends, runtime->GetDeviceSpec()),
+                                    ignoredErrorMessage, networkProperties) == Status::Success);
+
+    // The tensors bound to the network hold file descriptors, memfds stand in for the dma-bufs of other devices.
+    const std::vector<float> inputData{ 1.0f, 2.0f, 3.0f, 4.0f };
+    int inputFd = memfd_create("RefImportAndExportDmaBufInput", MFD_CLOEXEC);
+    int outputFd = memfd_create("RefImportAndExportDmaBufOutput", MFD_CLOEXEC);
+    BOOST_TEST_REQUIRE(inputFd >= 0);
+    BOOST_TEST_REQUIRE(outputFd >= 0);
+    BOOST_TEST_REQUIRE(write(inputFd, inputData.data(), 4 * sizeof(float)) == 4 * sizeof(float));
+    BOOST_TEST_REQUIRE(ftruncate(outputFd, 4 * sizeof(float)) == 0);
+
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), &inputFd) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), &outputFd) } };
+
+    runtime->GetProfiler(netId)->EnableProfiling(true);
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+    // Neither the input nor the output was copied.
+    std::stringstream ss;
+    ProfilerManager::GetInstance().GetProfiler()->Print(ss);
+    BOOST_TEST(ss.str().find("CopyMemGeneric") == std::string::npos);
+
+    std::vector<float> outputData(4);
+    BOOST_TEST(pread(outputFd, outputData.data(), 4 * sizeof(float), 0) == 4 * sizeof(float));
+    BOOST_TEST(outputData == std::vector<float>({ 1.0f, 4.0f, 9.0f, 16.0f }), boost::test_tools::per_element());
+
+    // Importing the same buffers again picks up the new input.
+    const std::vector<float> newInputData{ 5.0f, 6.0f, 7.0f, 8.0f };
+    BOOST_TEST_REQUIRE(pwrite(inputFd, newInputData.data(), 4 * sizeof(float), 0) == 4 * sizeof(float));
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(pread(outputFd, outputData.data(), 4 * sizeof(float), 0) == 4 * sizeof(float));
+    BOOST_TEST(outputData == std::vector<float>({ 25.0f, 36.0f, 49.0f, 64.0f }), boost::test_tools::per_element());
+
+    // Execute() copies the tensors rather than importing them, which file descriptors don't allow.
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+    BOOST_CHECK_THROW(runtime->Execute(*workingMemHandle, inputTensors, outputTensors), MemoryImportException);
+
+    close(inputFd);
+    close(outputFd);
+}
+
+BOOST_AUTO_TEST_CASE(RefExportDmaBufWithSeveralOutputSlotConnectionsTest)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    // The output of the activation also feeds a second output, so it can't be exported and would have to be copied.
+    INetworkPtr net(INetwork::Create());
+    ActivationDescriptor descriptor;
+    descriptor.m_Function = ActivationFunction::Square;
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* activation = net->AddActivationLayer(descriptor);
+    IConnectableLayer* output0 = net->AddOutputLayer(0);
+    IConnectableLayer* output1 = net->AddOutputLayer(1);
+    input->GetOutputSlot(0).Connect(activation->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output0->GetInputSlot(0));
+    activation->GetOutputSlot(0).Connect(output1->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 1, 4 }, DataType::Float32));
+    activation->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 1, 1, 4 }, DataType::Float32));
+
+    NetworkId netId;
+    std::string ignoredErrorMessage;
+    INetworkProperties networkProperties(true, true, 0, 0, MemorySource::DmaBuf, MemorySource::DmaBuf);
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*net, defaultBackends, runtime->GetDeviceSpec()),
+                                    ignoredErrorMessage, networkProperties) == Status::Success);
+
+    const std::vector<float> inputData{ 1.0f, 2.0f, 3.0f, 4.0f };
+    int inputFd = memfd_create("RefExportDmaBufInput", MFD_CLOEXEC);
+    int outputFds[] = { memfd_create("RefExportDmaBufOutput0", MFD_CLOEXEC),
+                        memfd_create("RefExportDmaBufOutput1", MFD_CLOEXEC) };
+    BOOST_TEST_REQUIRE(inputFd >= 0);
+    BOOST_TEST_REQUIRE(outputFds[0] >= 0);
+    BOOST_TEST_REQUIRE(outputFds[1] >= 0);
+    BOOST_TEST_REQUIRE(write(inputFd, inputData.data(), 4 * sizeof(float)) == 4 * sizeof(float));
+    BOOST_TEST_REQUIRE(ftruncate(outputFds[0], 4 * sizeof(float)) == 0);
+    BOOST_TEST_REQUIRE(ftruncate(outputFds[1], 4 * sizeof(float)) == 0);
+
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), &inputFd) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), &outputFds[0]) },
+                                 { 1, Tensor(runtime->GetOutputTensorInfo(netId, 1), &outputFds[1]) } };
+    const std::vector<int> originalOutputFds(std::begin(outputFds), std::end(outputFds));
+    BOOST_CHECK_THROW(runtime->EnqueueWorkload(netId, inputTensors, outputTensors), MemoryExportException);
+
+    // Nothing was written over the file descriptors.
+    BOOST_TEST(std::vector<int>(std::begin(outputFds), std::end(outputFds)) == originalOutputFds,
+               boost::test_tools::per_element());
+
+    close(inputFd);
+    close(outputFds[0]);
+    close(outputFds[1]);
+}
+#endif
+
 #endif
 
 BOOST_AUTO_TEST_SUITE_END()
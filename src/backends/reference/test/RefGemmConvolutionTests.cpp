@@ -0,0 +1,165 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include <reference/workloads/ConvImpl.hpp>
+#include <reference/workloads/GemmConvolution.hpp>
+
+#include <armnn/Types.hpp>
+
+#include <boost/test/unit_test.hpp>
+
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace
+{
+
+struct ConvolutionParams
+{
+    unsigned int m_Batches;
+    unsigned int m_InputChannels;
+    unsigned int m_InputHeight;
+    unsigned int m_InputWidth;
+    unsigned int m_OutputChannels;
+    unsigned int m_FilterHeight;
+    unsigned int m_FilterWidth;
+    unsigned int m_Padding;
+    unsigned int m_Stride;
+    unsigned int m_Dilation;
+    bool m_BiasEnabled;
+};
+
+armnn::TensorShape MakeShape(armnn::DataLayout dataLayout,
+                             unsigned int batches,
+                             unsigned int channels,
+                             unsigned int height,
+                             unsigned int width)
+{
+    return dataLayout == armnn::DataLayout::NHWC ? armnn::TensorShape({ batches, height, width, channels })
+                                                 : armnn::TensorShape({ batches, channels, height, width });
+}
+
+// Checks that GemmConvolve() computes the same convolution as Convolve(), over the whole output and over a range of
+// pixels starting and ending in the middle of a block.
+void CompareWithConvolve(const ConvolutionParams& params, armnn::DataLayout dataLayout)
+{
+    using namespace armnn;
+
+    const unsigned int effectiveFilterHeight = (params.m_FilterHeight - 1) * params.m_Dilation + 1;
+    const unsigned int effectiveFilterWidth  = (params.m_FilterWidth - 1) * params.m_Dilation + 1;
+    const unsigned int outputHeight =
+        (params.m_InputHeight + 2 * params.m_Padding - effectiveFilterHeight) / params.m_Stride + 1;
+    const unsigned int outputWidth  =
+        (params.m_InputWidth + 2 * params.m_Padding - effectiveFilterWidth) / params.m_Stride + 1;
+
+    const TensorInfo inputInfo(MakeShape(dataLayout, params.m_Batches, params.m_InputChannels,
+                                         params.m_InputHeight, params.m_InputWidth), DataType::Float32);
+    const TensorInfo outputInfo(MakeShape(dataLayout, params.m_Batches, params.m_OutputChannels,
+                                          outputHeight, outputWidth), DataType::Float32);
+    const TensorInfo filterInfo(MakeShape(dataLayout, params.m_OutputChannels, params.m_InputChannels,
+                                          params.m_FilterHeight, params.m_FilterWidth), DataType::Float32);
+    const TensorInfo biasInfo({ params.m_OutputChannels }, DataType::Float32);
+
+    std::mt19937 generator(0);
+    std::uniform_real_distribution<float> distribution(-1.0f, 1.0f);
+    auto makeData = [&](const TensorInfo& info)
+    {
+        std::vector<float> data(info.GetNumElements());
+        for (float& value : data)
+        {
+            value = distribution(generator);
+        }
+        return data;
+    };
+    const std::vector<float> input  = makeData(inputInfo);
+    const std::vector<float> filter = makeData(filterInfo);
+    const std::vector<float> bias   = makeData(biasInfo);
+
+    BOOST_TEST(IsGemmConvolutionSupported(inputInfo, filterInfo, outputInfo,
+                                          params.m_BiasEnabled ? &biasInfo : nullptr));
+
+    std::vector<float> expected(outputInfo.GetNumElements());
+    {
+        std::unique_ptr<Decoder<float>> inputDecoder  = MakeDecoder<float>(inputInfo, input.data());
+        std::unique_ptr<Decoder<float>> filterDecoder = MakeDecoder<float>(filterInfo, filter.data());
+        std::unique_ptr<Decoder<float>> biasDecoder   = MakeDecoder<float>(biasInfo, bias.data());
+        std::unique_ptr<Encoder<float>> outputEncoder = MakeEncoder<float>(outputInfo, expected.data());
+        Convolve(inputInfo.GetShape(), *inputDecoder, outputInfo.GetShape(), *outputEncoder, filterInfo.GetShape(),
+                 *filterDecoder, params.m_BiasEnabled, biasDecoder.get(), dataLayout, params.m_Padding,
+                 params.m_Padding, params.m_Stride, params.m_Stride, params.m_Dilation, params.m_Dilation, false,
+                 0, params.m_Batches * params.m_OutputChannels * outputHeight);
+    }
+
+    const std::vector<float> packedFilter = PackGemmConvolutionFilter(filterInfo.GetShape(), filter.data(),
+                                                                      dataLayout);
+    const unsigned int numPixels = params.m_Batches * outputHeight * outputWidth;
+
+    std::vector<float> output(outputInfo.GetNumElements(), 0.0f);
+    GemmConvolve(inputInfo.GetShape(), input.data(), outputInfo.GetShape(), output.data(), filterInfo.GetShape(),
+                 packedFilter.data(), params.m_BiasEnabled ? bias.data() : nullptr, dataLayout, params.m_Padding,
+                 params.m_Padding, params.m_Stride, params.m_Stride, params.m_Dilation, params.m_Dilation,
+                 0, numPixels);
+    // The sums are accumulated in a different order, and some cancel out, so the tolerance is absolute.
+    for (unsigned int i = 0; i < output.size(); ++i)
+    {
+        BOOST_TEST(std::abs(output[i] - expected[i]) <= 1e-4f);
+    }
+
+    // Only the pixels of the range are written.
+    const unsigned int firstPixel = numPixels / 3;
+    const unsigned int lastPixel  = numPixels - numPixels / 5;
+    std::vector<float> partialOutput(outputInfo.GetNumElements(), 0.0f);
+    GemmConvolve(inputInfo.GetShape(), input.data(), outputInfo.GetShape(), partialOutput.data(),
+                 filterInfo.GetShape(), packedFilter.data(), params.m_BiasEnabled ? bias.data() : nullptr, dataLayout,
+                 params.m_Padding, params.m_Padding, params.m_Stride, params.m_Stride, params.m_Dilation,
+                 params.m_Dilation, firstPixel, lastPixel);
+    for (unsigned int pixel = 0; pixel < numPixels; ++pixel)
+    {
+        const bool inRange = pixel >= firstPixel && pixel < lastPixel;
+        for (unsigned int channel = 0; channel < params.m_OutputChannels; ++channel)
+        {
+            const unsigned int planeSize = outputHeight * outputWidth;
+            const unsigned int index = dataLayout == DataLayout::NHWC ?
+                pixel * params.m_OutputChannels + channel :
+                ((pixel / planeSize) * params.m_OutputChannels + channel) * planeSize + pixel % planeSize;
+            BOOST_TEST(partialOutput[index] == (inRange ? output[index] : 0.0f));
+        }
+    }
+}
+
+void CompareWithConvolve(const ConvolutionParams& params)
+{
+    CompareWithConvolve(params, armnn::DataLayout::NCHW);
+    CompareWithConvolve(params, armnn::DataLayout::NHWC);
+}
+
+} // anonymous namespace
+
+BOOST_AUTO_TEST_SUITE(RefGemmConvolution)
+
+BOOST_AUTO_TEST_CASE(GemmConvolutionPointwise)
+{
+    CompareWithConvolve({ 1, 16, 5, 7, 24, 1, 1, 0, 1, 1, true });
+}
+
+BOOST_AUTO_TEST_CASE(GemmConvolutionPaddingAndStride)
+{
+    // Output channels and pixels which aren't multiples of the tile.
+    CompareWithConvolve({ 2, 3, 11, 9, 5, 3, 3, 1, 2, 1, true });
+}
+
+BOOST_AUTO_TEST_CASE(GemmConvolutionDilation)
+{
+    CompareWithConvolve({ 1, 4, 10, 12, 9, 3, 2, 2, 1, 2, false });
+}
+
+BOOST_AUTO_TEST_CASE(GemmConvolutionManyElements)
+{
+    // More filter elements and pixels than fit in a block, with partial blocks of both.
+    CompareWithConvolve({ 2, 37, 13, 11, 17, 3, 3, 1, 1, 1, true });
+}
+
+BOOST_AUTO_TEST_SUITE_END()
@@ -5,8 +5,14 @@
 
 #include <reference/RefMemoryManager.hpp>
 
+#include <armnn/Exceptions.hpp>
+
 #include <boost/test/unit_test.hpp>
 
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
 BOOST_AUTO_TEST_SUITE(RefMemoryManagerTests)
 using namespace armnn;
 using Pool = RefMemoryManager::Pool;
@@ -48,4 +54,108 @@ BOOST_AUTO_TEST_CASE(ManageTwoThings)
     memoryManager.Release();
 }
 
+BOOST_AUTO_TEST_CASE(PlanReusesMemoryOfDeadTensors)
+{
+    RefMemoryManager memoryManager;
+
+    // A chain a -> b -> c -> d, where each tensor dies once the next one has been computed from it.
+    Pool* a = memoryManager.Manage(100);
+    Pool* b = memoryManager.Manage(40);
+    memoryManager.Allocate(a);
+    Pool* c = memoryManager.Manage(60);
+    memoryManager.Allocate(b);
+    Pool* d = memoryManager.Manage(100);
+    memoryManager.Allocate(c);
+    memoryManager.Allocate(d);
+
+    BOOST_TEST(memoryManager.GetUnsharedSize() == 300);
+    // d reuses the memory of a, which is never live at the same time.
+    BOOST_TEST(memoryManager.GetPlannedSize() < memoryManager.GetUnsharedSize());
+
+    memoryManager.Acquire();
+
+    auto begin = [&](Pool* pool) { return static_cast<char*>(memoryManager.GetPointer(pool)); };
+    auto overlap = [&](Pool* lhs, unsigned int lhsSize, Pool* rhs, unsigned int rhsSize)
+    {
+        return begin(lhs) < begin(rhs) + rhsSize && begin(rhs) < begin(lhs) + lhsSize;
+    };
+    // Tensors live at the same time never overlap.
+    BOOST_TEST(!overlap(a, 100, b, 40));
+    BOOST_TEST(!overlap(b, 40, c, 60));
+    BOOST_TEST(!overlap(c, 60, d, 100));
+    BOOST_TEST(begin(a) == begin(d));
+
+    memoryManager.Release();
+}
+
+BOOST_AUTO_TEST_CASE(PlanKeepsLiveTensorsApart)
+{
+    RefMemoryManager memoryManager;
+
+    std::vector<Pool*> pools;
+    for (unsigned int i = 1; i <= 8; ++i)
+    {
+        pools.push_back(memoryManager.Manage(i * 10));
+    }
+
+    // Nothing dies, so nothing can share memory.
+    BOOST_TEST(memoryManager.GetPlannedSize() >= memoryManager.GetUnsharedSize());
+
+    memoryManager.Acquire();
+    for (unsigned int i = 0; i < pools.size(); ++i)
+    {
+        for (unsigned int j = i + 1; j < pools.size(); ++j)
+        {
+            char* lhs = static_cast<char*>(memoryManager.GetPointer(pools[i]));
+            char* rhs = static_cast<char*>(memoryManager.GetPointer(pools[j]));
+            BOOST_TEST((lhs + (i + 1) * 10 <= rhs || rhs + (j + 1) * 10 <= lhs));
+        }
+    }
+    memoryManager.Release();
+}
+
+BOOST_AUTO_TEST_CASE(PoolsAreAligned)
+{
+    for (size_t alignment : { RefMemoryAllocator::s_DefaultAlignment, size_t(256) })
+    {
+        RefMemoryManager memoryManager{ RefMemoryAllocator(alignment) };
+        BOOST_TEST(memoryManager.GetAllocator().GetAlignment() == alignment);
+
+        std::vector<Pool*> pools;
+        for (unsigned int i = 1; i <= 4; ++i)
+        {
+            pools.push_back(memoryManager.Manage(i * 3));
+        }
+
+        memoryManager.Acquire();
+        for (Pool* pool : pools)
+        {
+            BOOST_TEST(reinterpret_cast<uintptr_t>(memoryManager.GetPointer(pool)) % alignment == 0);
+        }
+        memoryManager.Release();
+    }
+
+    BOOST_CHECK_THROW(RefMemoryAllocator(48), InvalidArgumentException);
+    BOOST_CHECK_THROW(RefMemoryAllocator(1), InvalidArgumentException);
+}
+
+BOOST_AUTO_TEST_CASE(HugePagesArena)
+{
+    const unsigned int numBytes = 3 * RefMemoryAllocator::s_HugePageSize / 2;
+
+    // Explicit huge pages fall back to transparent ones when the system has none reserved.
+    for (auto hugePages : { RefMemoryAllocator::HugePages::Transparent, RefMemoryAllocator::HugePages::Explicit })
+    {
+        RefMemoryManager memoryManager{ RefMemoryAllocator(RefMemoryAllocator::s_DefaultAlignment, hugePages) };
+        Pool* pool = memoryManager.Manage(numBytes);
+        memoryManager.Acquire();
+
+        void* memory = memoryManager.GetPointer(pool);
+        BOOST_TEST(reinterpret_cast<uintptr_t>(memory) % RefMemoryAllocator::s_HugePageSize == 0);
+        std::memset(memory, 1, numBytes);
+
+        memoryManager.Release();
+    }
+}
+
 BOOST_AUTO_TEST_SUITE_END()
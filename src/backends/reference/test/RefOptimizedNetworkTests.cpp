@@ -5,7 +5,9 @@
 
 #include <Graph.hpp>
 #include <Network.hpp>
+#include <Profiling.hpp>
 
+#include <reference/RefBackend.hpp>
 #include <reference/RefWorkloadFactory.hpp>
 
 #include <boost/test/unit_test.hpp>
@@ -193,4 +195,277 @@ BOOST_AUTO_TEST_CASE(DebugTestOnCpuRef)
     BOOST_TEST(GraphHasNamedLayer(graph, "OutputLayer"));
 }
 
+BOOST_AUTO_TEST_CASE(CpuRefInPlaceComputation)
+{
+    using namespace armnn;
+
+    const TensorInfo info({ 2, 3 }, DataType::Float32);
+
+    //    in0
+    //     |
+    //    re     in1
+    //     |      |
+    //    ab      |
+    //      \    /
+    //       add
+    //        |
+    //       fl
+    //        |
+    //       ot
+    INetworkPtr net(INetwork::Create());
+    ActivationDescriptor reluDesc;
+    reluDesc.m_Function = ActivationFunction::ReLu;
+    ActivationDescriptor absDesc;
+    absDesc.m_Function = ActivationFunction::Abs;
+
+    IConnectableLayer* input0   = net->AddInputLayer(0, "in0");
+    IConnectableLayer* input1   = net->AddInputLayer(1, "in1");
+    IConnectableLayer* relu     = net->AddActivationLayer(reluDesc, "re");
+    IConnectableLayer* abs      = net->AddActivationLayer(absDesc, "ab");
+    IConnectableLayer* addition = net->AddAdditionLayer("add");
+    IConnectableLayer* floor    = net->AddFloorLayer("fl");
+    IConnectableLayer* output   = net->AddOutputLayer(0, "ot");
+
+    input0->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(abs->GetInputSlot(0));
+    abs->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    input1->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(floor->GetInputSlot(0));
+    floor->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    for (IConnectableLayer* layer : { input0, input1, relu, abs, addition, floor })
+    {
+        layer->GetOutputSlot(0).SetTensorInfo(info);
+    }
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    // The layers after the first one compute their output over their input from the previous layer, as nothing
+    // else reads it, but the network inputs are left alone.
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+    Graph& graph = static_cast<OptimizedNetwork*>(optNet.get())->GetGraph();
+
+    TensorHandleFactoryRegistry registry;
+    RefBackend().RegisterTensorHandleFactories(registry);
+    RefWorkloadFactory workloadFactory;
+    std::map<std::string, ITensorHandle*> handles;
+    for (auto&& layer : graph.TopologicalSort())
+    {
+        layer->CreateTensorHandles(registry, workloadFactory);
+        if (layer->GetNumOutputSlots() > 0)
+        {
+            handles[layer->GetNameStr()] = layer->GetOutputHandler(0).GetData();
+        }
+    }
+    BOOST_TEST(!handles["in0"]->GetParent());
+    BOOST_TEST(!handles["re"]->GetParent());
+    BOOST_TEST(handles["ab"]->GetParent() == handles["re"]);
+    BOOST_TEST(handles["add"]->GetParent() == handles["ab"]);
+    BOOST_TEST(handles["fl"]->GetParent() == handles["add"]);
+
+    // Running in place gives the same results.
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*net, backends, runtime->GetDeviceSpec())) == Status::Success);
+
+    const std::vector<float> inputData0 = { -1.5f, 2.25f, -0.5f, 3.0f, 0.75f, -4.0f };
+    const std::vector<float> inputData1 = {  0.5f, -1.0f,  2.5f, 0.0f, 1.5f,   3.0f };
+    std::vector<float> outputData(6);
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData0.data()) },
+                               { 1, ConstTensor(runtime->GetInputTensorInfo(netId, 1), inputData1.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        BOOST_TEST(outputData == std::vector<float>({ 0.0f, 1.0f, 2.0f, 3.0f, 2.0f, 3.0f }),
+                   boost::test_tools::per_element());
+    }
+}
+
+BOOST_AUTO_TEST_CASE(CpuRefConcatAndSplitterSubTensors)
+{
+    using namespace armnn;
+
+    const TensorInfo info({ 2, 3 }, DataType::Float32);
+    const TensorInfo viewInfo({ 1, 3 }, DataType::Float32);
+
+    //        in
+    //        |
+    //        sp
+    //       /  \
+    //     re    ab
+    //       \  /
+    //        cc
+    //        |
+    //        ot
+    INetworkPtr net(INetwork::Create());
+    ViewsDescriptor splitterDesc(2, 2);
+    for (unsigned int i = 0; i < 2; ++i)
+    {
+        splitterDesc.SetViewOriginCoord(i, 0, i);
+        splitterDesc.SetViewSize(i, 0, 1);
+        splitterDesc.SetViewSize(i, 1, 3);
+    }
+    const std::vector<TensorShape> viewShapes = { viewInfo.GetShape(), viewInfo.GetShape() };
+    OriginsDescriptor concatDesc = CreateDescriptorForConcatenation(viewShapes.begin(), viewShapes.end(), 0);
+    ActivationDescriptor reluDesc;
+    reluDesc.m_Function = ActivationFunction::ReLu;
+    ActivationDescriptor absDesc;
+    absDesc.m_Function = ActivationFunction::Abs;
+
+    IConnectableLayer* input    = net->AddInputLayer(0, "in");
+    IConnectableLayer* splitter = net->AddSplitterLayer(splitterDesc, "sp");
+    IConnectableLayer* relu     = net->AddActivationLayer(reluDesc, "re");
+    IConnectableLayer* abs      = net->AddActivationLayer(absDesc, "ab");
+    IConnectableLayer* concat   = net->AddConcatLayer(concatDesc, "cc");
+    IConnectableLayer* output   = net->AddOutputLayer(0, "ot");
+
+    input->GetOutputSlot(0).Connect(splitter->GetInputSlot(0));
+    splitter->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    splitter->GetOutputSlot(1).Connect(abs->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(concat->GetInputSlot(0));
+    abs->GetOutputSlot(0).Connect(concat->GetInputSlot(1));
+    concat->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(info);
+    splitter->GetOutputSlot(0).SetTensorInfo(viewInfo);
+    splitter->GetOutputSlot(1).SetTensorInfo(viewInfo);
+    relu->GetOutputSlot(0).SetTensorInfo(viewInfo);
+    abs->GetOutputSlot(0).SetTensorInfo(viewInfo);
+    concat->GetOutputSlot(0).SetTensorInfo(info);
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    // The splitter outputs are views of its input and the activations write straight into the concat output.
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+    Graph& graph = static_cast<OptimizedNetwork*>(optNet.get())->GetGraph();
+
+    TensorHandleFactoryRegistry registry;
+    RefBackend().RegisterTensorHandleFactories(registry);
+    RefWorkloadFactory workloadFactory;
+    for (auto&& layer : graph.TopologicalSort())
+    {
+        layer->CreateTensorHandles(registry, workloadFactory);
+    }
+    auto GetHandle = [&graph](const std::string& name, unsigned int slotIndex)
+    {
+        for (auto&& layer : graph)
+        {
+            if (layer->GetNameStr() == name)
+            {
+                return layer->GetOutputHandler(slotIndex).GetData();
+            }
+        }
+        return static_cast<ITensorHandle*>(nullptr);
+    };
+    BOOST_TEST(GetHandle("sp", 0)->GetParent() == GetHandle("in", 0));
+    BOOST_TEST(GetHandle("sp", 1)->GetParent() == GetHandle("in", 0));
+    BOOST_TEST(GetHandle("re", 0)->GetParent() == GetHandle("cc", 0));
+    BOOST_TEST(GetHandle("ab", 0)->GetParent() == GetHandle("cc", 0));
+
+    // Both with the network's own tensors and with a working memory handle, where the tensors don't share memory.
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*net, backends, runtime->GetDeviceSpec())) == Status::Success);
+
+    const std::vector<float> inputData = { -1.5f, 2.25f, -0.5f, 3.0f, -0.75f, -4.0f };
+    const std::vector<float> expectedOutput = { 0.0f, 2.25f, 0.0f, 3.0f, 0.75f, 4.0f };
+    std::vector<float> outputData(6);
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+
+    std::fill(outputData.begin(), outputData.end(), 0.0f);
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+    BOOST_TEST(runtime->Execute(*workingMemHandle, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(CpuRefReshapeAliasesInput)
+{
+    using namespace armnn;
+
+    //    in
+    //     |
+    //    re
+    //     |
+    //    rs
+    //     |
+    //    ab
+    //     |
+    //    ot
+    INetworkPtr net(INetwork::Create());
+    ActivationDescriptor reluDesc;
+    reluDesc.m_Function = ActivationFunction::ReLu;
+    ActivationDescriptor absDesc;
+    absDesc.m_Function = ActivationFunction::Abs;
+    ReshapeDescriptor reshapeDesc(TensorShape({ 1, 6 }));
+
+    IConnectableLayer* input   = net->AddInputLayer(0, "in");
+    IConnectableLayer* relu    = net->AddActivationLayer(reluDesc, "re");
+    IConnectableLayer* reshape = net->AddReshapeLayer(reshapeDesc, "rs");
+    IConnectableLayer* abs     = net->AddActivationLayer(absDesc, "ab");
+    IConnectableLayer* output  = net->AddOutputLayer(0, "ot");
+
+    input->GetOutputSlot(0).Connect(relu->GetInputSlot(0));
+    relu->GetOutputSlot(0).Connect(reshape->GetInputSlot(0));
+    reshape->GetOutputSlot(0).Connect(abs->GetInputSlot(0));
+    abs->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 3 }, DataType::Float32));
+    relu->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 2, 3 }, DataType::Float32));
+    reshape->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 6 }, DataType::Float32));
+    abs->GetOutputSlot(0).SetTensorInfo(TensorInfo({ 1, 6 }, DataType::Float32));
+
+    IRuntime::CreationOptions options;
+    IRuntimePtr runtime(IRuntime::Create(options));
+    std::vector<BackendId> backends = { Compute::CpuRef };
+
+    // The reshape is an alias of its input. The layer after it must not compute over that memory in place, as it
+    // may be read by others.
+    IOptimizedNetworkPtr optNet = Optimize(*net, backends, runtime->GetDeviceSpec());
+    Graph& graph = static_cast<OptimizedNetwork*>(optNet.get())->GetGraph();
+
+    TensorHandleFactoryRegistry registry;
+    RefBackend().RegisterTensorHandleFactories(registry);
+    RefWorkloadFactory workloadFactory;
+    std::map<std::string, Layer*> layers;
+    for (auto&& layer : graph.TopologicalSort())
+    {
+        layer->CreateTensorHandles(registry, workloadFactory);
+        layers[layer->GetNameStr()] = layer;
+    }
+    BOOST_TEST(layers["rs"]->IsAliasingInput());
+    BOOST_TEST(layers["rs"]->GetOutputHandler(0).GetData()->GetParent() == layers["re"]->GetOutputHandler(0).GetData());
+    BOOST_TEST(!layers["ab"]->IsAliasingInput());
+    BOOST_TEST(!layers["ab"]->GetOutputHandler(0).GetData()->GetParent());
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*net, backends, runtime->GetDeviceSpec())) == Status::Success);
+
+    const std::vector<float> inputData = { -1.0f, 2.0f, -3.0f, 4.0f, -5.0f, 6.0f };
+    const std::vector<float> expectedOutput = { 0.0f, 2.0f, 0.0f, 4.0f, 0.0f, 6.0f };
+    std::vector<float> outputData(6);
+    InputTensors inputTensors{ { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) } };
+    OutputTensors outputTensors{ { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) } };
+
+    // No workload runs for the reshape.
+    runtime->GetProfiler(netId)->EnableProfiling(true);
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+
+    std::stringstream ss;
+    ProfilerManager::GetInstance().GetProfiler()->Print(ss);
+    const std::string dump = ss.str();
+    BOOST_TEST(dump.find("Activation") != std::string::npos);
+    BOOST_TEST(dump.find("Reshape") == std::string::npos);
+
+    std::fill(outputData.begin(), outputData.end(), 0.0f);
+    std::unique_ptr<IWorkingMemHandle> workingMemHandle = runtime->CreateWorkingMemHandle(netId);
+    BOOST_TEST(runtime->Execute(*workingMemHandle, inputTensors, outputTensors) == Status::Success);
+    BOOST_TEST(outputData == expectedOutput, boost::test_tools::per_element());
+}
+
 BOOST_AUTO_TEST_SUITE_END()
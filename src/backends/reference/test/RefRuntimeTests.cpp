@@ -9,8 +9,180 @@
 
 #include <backendsCommon/test/RuntimeTestImpl.hpp>
 
+#include <reference/RefBackend.hpp>
+#include <reference/RefBackendContext.hpp>
+#include <reference/RefMemoryAllocator.hpp>
+#include <reference/RefThreadPool.hpp>
+
+#include <armnn/INetwork.hpp>
+#include <armnn/utility/PolymorphicDowncast.hpp>
+
 #include <boost/test/unit_test.hpp>
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <stdexcept>
+
+namespace
+{
+
+// Input [1,48,48,8] -> Convolution2d -> DepthwiseConvolution2d -> Pooling2d -> Addition with a broadcast [1,1,1,16]
+// second input -> FullyConnected [1,10] -> Softmax -> Output
+armnn::INetworkPtr CreateHeavyKernelsNetwork(std::vector<float>& convWeights,
+                                             std::vector<float>& depthwiseWeights,
+                                             std::vector<float>& fcWeights,
+                                             std::vector<float>& biases)
+{
+    using namespace armnn;
+
+    const TensorInfo inputInfo({ 1, 48, 48, 8 }, DataType::Float32);
+    const TensorInfo featuresInfo({ 1, 48, 48, 16 }, DataType::Float32);
+    const TensorInfo offsetInfo({ 1, 1, 1, 16 }, DataType::Float32);
+    const TensorInfo fcOutputInfo({ 1, 10 }, DataType::Float32);
+
+    const TensorInfo convWeightsInfo({ 16, 3, 3, 8 }, DataType::Float32);
+    const TensorInfo depthwiseWeightsInfo({ 1, 16, 3, 3 }, DataType::Float32);
+    const TensorInfo fcWeightsInfo({ featuresInfo.GetNumElements(), 10 }, DataType::Float32);
+    const TensorInfo biasInfo({ 16 }, DataType::Float32);
+
+    auto Fill = [](std::vector<float>& values, unsigned int size, unsigned int seed)
+    {
+        values.resize(size);
+        for (unsigned int i = 0; i < size; ++i)
+        {
+            values[i] = static_cast<float>((i * 7 + seed) % 13) * 0.01f - 0.06f;
+        }
+    };
+    Fill(convWeights, convWeightsInfo.GetNumElements(), 1);
+    Fill(depthwiseWeights, depthwiseWeightsInfo.GetNumElements(), 2);
+    Fill(fcWeights, fcWeightsInfo.GetNumElements(), 3);
+    Fill(biases, biasInfo.GetNumElements(), 4);
+
+    INetworkPtr net(INetwork::Create());
+
+    IConnectableLayer* input  = net->AddInputLayer(0, "input");
+    IConnectableLayer* offset = net->AddInputLayer(1, "offset");
+
+    Convolution2dDescriptor convDesc;
+    convDesc.m_PadLeft     = 1;
+    convDesc.m_PadRight    = 1;
+    convDesc.m_PadTop      = 1;
+    convDesc.m_PadBottom   = 1;
+    convDesc.m_StrideX     = 1;
+    convDesc.m_StrideY     = 1;
+    convDesc.m_BiasEnabled = true;
+    convDesc.m_DataLayout  = DataLayout::NHWC;
+    IConnectableLayer* conv = net->AddConvolution2dLayer(convDesc,
+                                                         ConstTensor(convWeightsInfo, convWeights),
+                                                         Optional<ConstTensor>(ConstTensor(biasInfo, biases)),
+                                                         "conv");
+
+    DepthwiseConvolution2dDescriptor depthwiseDesc;
+    depthwiseDesc.m_PadLeft     = 1;
+    depthwiseDesc.m_PadRight    = 1;
+    depthwiseDesc.m_PadTop      = 1;
+    depthwiseDesc.m_PadBottom   = 1;
+    depthwiseDesc.m_StrideX     = 1;
+    depthwiseDesc.m_StrideY     = 1;
+    depthwiseDesc.m_BiasEnabled = false;
+    depthwiseDesc.m_DataLayout  = DataLayout::NHWC;
+    IConnectableLayer* depthwise =
+        net->AddDepthwiseConvolution2dLayer(depthwiseDesc,
+                                            ConstTensor(depthwiseWeightsInfo, depthwiseWeights),
+                                            EmptyOptional(),
+                                            "depthwise");
+
+    Pooling2dDescriptor poolDesc;
+    poolDesc.m_PoolType      = PoolingAlgorithm::Average;
+    poolDesc.m_PoolWidth     = 3;
+    poolDesc.m_PoolHeight    = 3;
+    poolDesc.m_StrideX       = 1;
+    poolDesc.m_StrideY       = 1;
+    poolDesc.m_PadLeft       = 1;
+    poolDesc.m_PadRight      = 1;
+    poolDesc.m_PadTop        = 1;
+    poolDesc.m_PadBottom     = 1;
+    poolDesc.m_PaddingMethod = PaddingMethod::Exclude;
+    poolDesc.m_DataLayout    = DataLayout::NHWC;
+    IConnectableLayer* pool = net->AddPooling2dLayer(poolDesc, "pool");
+
+    IConnectableLayer* addition = net->AddAdditionLayer("addition");
+
+    FullyConnectedDescriptor fcDesc;
+    fcDesc.m_BiasEnabled = false;
+    IConnectableLayer* fc = net->AddFullyConnectedLayer(fcDesc,
+                                                        ConstTensor(fcWeightsInfo, fcWeights),
+                                                        EmptyOptional(),
+                                                        "fc");
+
+    IConnectableLayer* softmax = net->AddSoftmaxLayer(SoftmaxDescriptor(), "softmax");
+    IConnectableLayer* output  = net->AddOutputLayer(0, "output");
+
+    input->GetOutputSlot(0).Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot(0).Connect(depthwise->GetInputSlot(0));
+    depthwise->GetOutputSlot(0).Connect(pool->GetInputSlot(0));
+    pool->GetOutputSlot(0).Connect(addition->GetInputSlot(0));
+    offset->GetOutputSlot(0).Connect(addition->GetInputSlot(1));
+    addition->GetOutputSlot(0).Connect(fc->GetInputSlot(0));
+    fc->GetOutputSlot(0).Connect(softmax->GetInputSlot(0));
+    softmax->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    offset->GetOutputSlot(0).SetTensorInfo(offsetInfo);
+    conv->GetOutputSlot(0).SetTensorInfo(featuresInfo);
+    depthwise->GetOutputSlot(0).SetTensorInfo(featuresInfo);
+    pool->GetOutputSlot(0).SetTensorInfo(featuresInfo);
+    addition->GetOutputSlot(0).SetTensorInfo(featuresInfo);
+    fc->GetOutputSlot(0).SetTensorInfo(fcOutputInfo);
+    softmax->GetOutputSlot(0).SetTensorInfo(fcOutputInfo);
+
+    return net;
+}
+
+std::vector<float> RunHeavyKernelsNetwork(int numberOfThreads)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    options.m_BackendOptions.emplace_back(BackendOptions{ "CpuRef", {{ "NumberOfThreads", numberOfThreads }} });
+    IRuntimePtr runtime(IRuntime::Create(options));
+
+    std::vector<float> convWeights, depthwiseWeights, fcWeights, biases;
+    INetworkPtr net = CreateHeavyKernelsNetwork(convWeights, depthwiseWeights, fcWeights, biases);
+
+    NetworkId netId;
+    BOOST_TEST(runtime->LoadNetwork(netId, Optimize(*net, { Compute::CpuRef }, runtime->GetDeviceSpec()))
+               == Status::Success);
+
+    std::vector<float> inputData(runtime->GetInputTensorInfo(netId, 0).GetNumElements());
+    for (unsigned int i = 0; i < inputData.size(); ++i)
+    {
+        inputData[i] = static_cast<float>(i % 17) * 0.125f - 1.0f;
+    }
+    std::vector<float> offsetData(runtime->GetInputTensorInfo(netId, 1).GetNumElements());
+    for (unsigned int i = 0; i < offsetData.size(); ++i)
+    {
+        offsetData[i] = static_cast<float>(i) * 0.25f;
+    }
+    std::vector<float> outputData(runtime->GetOutputTensorInfo(netId, 0).GetNumElements());
+
+    InputTensors inputTensors
+    {
+        { 0, ConstTensor(runtime->GetInputTensorInfo(netId, 0), inputData.data()) },
+        { 1, ConstTensor(runtime->GetInputTensorInfo(netId, 1), offsetData.data()) }
+    };
+    OutputTensors outputTensors
+    {
+        { 0, Tensor(runtime->GetOutputTensorInfo(netId, 0), outputData.data()) }
+    };
+    BOOST_TEST(runtime->EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+
+    return outputData;
+}
+
+} // anonymous namespace
+
 BOOST_AUTO_TEST_SUITE(RefRuntime)
 
 #ifdef ARMNN_LEAK_CHECKING_ENABLED
@@ -43,4 +215,164 @@ BOOST_AUTO_TEST_CASE(RuntimeMemoryLeaksCpuRef)
 }
 #endif
 
+BOOST_AUTO_TEST_CASE(RefThreadPoolParallelFor)
+{
+    armnn::RefThreadPool threadPool(4);
+    BOOST_TEST(threadPool.GetNumberOfThreads() == 4);
+
+    // Every item is visited exactly once
+    std::vector<std::atomic<unsigned int>> visits(1000);
+    threadPool.ParallelFor(1000, 1000, [&visits](unsigned int begin, unsigned int end)
+    {
+        for (unsigned int i = begin; i < end; ++i)
+        {
+            ++visits[i];
+        }
+    });
+    for (auto& visit : visits)
+    {
+        BOOST_TEST(visit == 1);
+    }
+
+    // Exceptions thrown on any thread reach the caller
+    BOOST_CHECK_THROW(threadPool.ParallelFor(1000, 1000, [](unsigned int begin, unsigned int)
+                      {
+                          if (begin > 0)
+                          {
+                              throw std::runtime_error("range failed");
+                          }
+                      }),
+                      std::runtime_error);
+
+    BOOST_TEST(armnn::RefThreadPool().GetNumberOfThreads() == 1);
+}
+
+BOOST_AUTO_TEST_CASE(RefNumberOfThreadsBackendOption)
+{
+    using namespace armnn;
+
+    // Each runtime has its own pool, sized by its own options.
+    IRuntime::CreationOptions multiThreadOptions;
+    multiThreadOptions.m_BackendOptions.emplace_back(BackendOptions{ "CpuRef", {{ "NumberOfThreads", 4 }} });
+    RefBackendContext multiThreadContext(multiThreadOptions);
+    RefBackendContext defaultContext{ IRuntime::CreationOptions() };
+    BOOST_TEST(multiThreadContext.GetThreadPool()->GetNumberOfThreads() == 4);
+    BOOST_TEST(defaultContext.GetThreadPool()->GetNumberOfThreads() == 1);
+
+    const std::vector<float> singleThreadOutput = RunHeavyKernelsNetwork(1);
+    const std::vector<float> multiThreadOutput = RunHeavyKernelsNetwork(4);
+
+    // Results don't depend on how the work is split between threads
+    BOOST_TEST(multiThreadOutput == singleThreadOutput, boost::test_tools::per_element());
+}
+
+BOOST_AUTO_TEST_CASE(RefMemoryBackendOptions)
+{
+    using namespace armnn;
+
+    IRuntime::CreationOptions options;
+    options.m_BackendOptions.emplace_back(BackendOptions{ "CpuRef", {{ "MemoryAlignment", 128 },
+                                                                     { "HugePages", "Transparent" }} });
+    RefBackendContext context(options);
+    BOOST_TEST(context.GetMemoryAllocator().GetAlignment() == 128);
+    BOOST_TEST((context.GetMemoryAllocator().GetHugePages() == RefMemoryAllocator::HugePages::Transparent));
+
+    // Invalid values are ignored, and the settings of one context don't affect another.
+    IRuntime::CreationOptions invalidOptions;
+    invalidOptions.m_BackendOptions.emplace_back(BackendOptions{ "CpuRef", {{ "MemoryAlignment", 96 },
+                                                                            { "HugePages", "Sometimes" }} });
+    RefBackendContext invalidContext(invalidOptions);
+    BOOST_TEST(invalidContext.GetMemoryAllocator().GetAlignment() == RefMemoryAllocator::s_DefaultAlignment);
+    BOOST_TEST((invalidContext.GetMemoryAllocator().GetHugePages() == RefMemoryAllocator::HugePages::None));
+    BOOST_TEST(context.GetMemoryAllocator().GetAlignment() == 128);
+
+    // The memory managers of a backend use the allocator of its context.
+    RefBackend backend;
+    BOOST_TEST(PolymorphicDowncast<RefMemoryManager*>(backend.CreateMemoryManager().get())
+                   ->GetAllocator().GetAlignment() == RefMemoryAllocator::s_DefaultAlignment);
+    backend.SetBackendContext(context);
+    BOOST_TEST(PolymorphicDowncast<RefMemoryManager*>(backend.CreateMemoryManager().get())
+                   ->GetAllocator().GetAlignment() == 128);
+}
+
+BOOST_AUTO_TEST_CASE(RefPackedConvolutionWeightsAreShared)
+{
+    using namespace armnn;
+
+    // 5 output channels don't fill the last panel of 8 the weights are packed into, so the packed weights are larger.
+    const TensorInfo inputInfo({ 1, 6, 6, 2 }, DataType::Float32);
+    const TensorInfo outputInfo({ 1, 4, 4, 5 }, DataType::Float32);
+    const TensorInfo weightsInfo({ 5, 3, 3, 2 }, DataType::Float32);
+    const unsigned int packedWeightsBytes = 8 * 3 * 3 * 2 * sizeof(float);
+
+    std::vector<float> weightsData(weightsInfo.GetNumElements());
+    for (unsigned int i = 0; i < weightsData.size(); ++i)
+    {
+        weightsData[i] = static_cast<float>(i % 7) * 0.25f - 0.75f;
+    }
+
+    INetworkPtr net(INetwork::Create());
+    Convolution2dDescriptor convDesc;
+    convDesc.m_StrideX    = 1;
+    convDesc.m_StrideY    = 1;
+    convDesc.m_DataLayout = DataLayout::NHWC;
+    IConnectableLayer* input  = net->AddInputLayer(0, "input");
+    IConnectableLayer* conv   = net->AddConvolution2dLayer(convDesc, ConstTensor(weightsInfo, weightsData),
+                                                           EmptyOptional(), "conv");
+    IConnectableLayer* output = net->AddOutputLayer(0, "output");
+    input->GetOutputSlot(0).Connect(conv->GetInputSlot(0));
+    conv->GetOutputSlot(0).Connect(output->GetInputSlot(0));
+    input->GetOutputSlot(0).SetTensorInfo(inputInfo);
+    conv->GetOutputSlot(0).SetTensorInfo(outputInfo);
+
+    IRuntime::CreationOptions options;
+    armnn::Runtime runtime(options);
+    const ConstantTensorStore& constantTensorStore = GetConstantTensorStore(&runtime);
+
+    // The workloads only hold the packed weights, which identical filters share.
+    std::vector<NetworkId> netIds(2);
+    for (NetworkId& netId : netIds)
+    {
+        BOOST_TEST(runtime.LoadNetwork(netId, Optimize(*net, { Compute::CpuRef }, runtime.GetDeviceSpec())) ==
+                   Status::Success);
+        BOOST_TEST(runtime.GetMemoryUsage(netId).m_ConstantBytes == packedWeightsBytes);
+    }
+    BOOST_TEST(constantTensorStore.GetNumTensors() == 1);
+    BOOST_TEST(constantTensorStore.GetNumBytes() == packedWeightsBytes);
+
+    std::vector<float> inputData(inputInfo.GetNumElements());
+    for (unsigned int i = 0; i < inputData.size(); ++i)
+    {
+        inputData[i] = static_cast<float>(i % 5) - 2.0f;
+    }
+    InputTensors inputTensors{ { 0, ConstTensor(inputInfo, inputData.data()) } };
+    auto Run = [&](NetworkId netId)
+    {
+        std::vector<float> outputData(outputInfo.GetNumElements());
+        OutputTensors outputTensors{ { 0, Tensor(outputInfo, outputData.data()) } };
+        BOOST_TEST(runtime.EnqueueWorkload(netId, inputTensors, outputTensors) == Status::Success);
+        return outputData;
+    };
+    const std::vector<float> originalOutput = Run(netIds[0]);
+    BOOST_CHECK(Run(netIds[1]) == originalOutput);
+
+    // Updated weights are packed again, into memory of their own.
+    std::vector<float> negatedWeightsData(weightsData.size());
+    std::transform(weightsData.begin(), weightsData.end(), negatedWeightsData.begin(), std::negate<float>());
+    BOOST_TEST(runtime.UpdateLayerWeights(netIds[0], "conv", ConstTensor(weightsInfo, negatedWeightsData),
+                                          EmptyOptional()) == Status::Success);
+    const std::vector<float> negatedOutput = Run(netIds[0]);
+    for (unsigned int i = 0; i < negatedOutput.size(); ++i)
+    {
+        BOOST_TEST(negatedOutput[i] == -originalOutput[i]);
+    }
+    BOOST_CHECK(Run(netIds[1]) == originalOutput);
+
+    BOOST_CHECK_THROW(runtime.UpdateLayerWeights(netIds[0], "conv",
+                                                 ConstTensor(TensorInfo({ 5, 3, 3, 1 }, DataType::Float32),
+                                                             negatedWeightsData),
+                                                 EmptyOptional()),
+                      InvalidArgumentException);
+}
+
 BOOST_AUTO_TEST_SUITE_END()
\ No newline at end of file
@@ -5,8 +5,15 @@
 #include <reference/RefTensorHandle.hpp>
 #include <reference/RefTensorHandleFactory.hpp>
 
+#include <armnn/Descriptors.hpp>
+
 #include <boost/test/unit_test.hpp>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 BOOST_AUTO_TEST_SUITE(RefTensorHandleTests)
 using namespace armnn;
 
@@ -158,6 +165,84 @@ BOOST_AUTO_TEST_CASE(RefTensorHandleGetCapabilities)
     BOOST_CHECK(capabilities.empty());
 }
 
+BOOST_AUTO_TEST_CASE(RefTensorHandleGetInPlaceCapabilities)
+{
+    std::shared_ptr<RefMemoryManager> memoryManager = std::make_shared<RefMemoryManager>();
+    RefTensorHandleFactory handleFactory(memoryManager);
+
+    INetworkPtr net(INetwork::Create());
+    IConnectableLayer* input = net->AddInputLayer(0);
+    IConnectableLayer* activation = net->AddActivationLayer(ActivationDescriptor());
+    IConnectableLayer* softmax = net->AddSoftmaxLayer(SoftmaxDescriptor());
+
+    std::vector<Capability> capabilities = handleFactory.GetCapabilities(activation,
+                                                                         input,
+                                                                         CapabilityClass::InPlaceComputation);
+    BOOST_TEST(capabilities.size() == 1);
+    BOOST_TEST(capabilities[0].m_Value);
+
+    // Softmax reads the whole of a row before writing it.
+    capabilities = handleFactory.GetCapabilities(softmax, input, CapabilityClass::InPlaceComputation);
+    BOOST_CHECK(capabilities.empty());
+}
+
+BOOST_AUTO_TEST_CASE(RefTensorHandleSubTensors)
+{
+    std::shared_ptr<RefMemoryManager> memoryManager = std::make_shared<RefMemoryManager>();
+    RefTensorHandleFactory handleFactory(memoryManager);
+    TensorInfo info({ 2, 3 }, DataType::Float32);
+
+    auto parent = handleFactory.CreateTensorHandle(info);
+    const unsigned int origin[] = { 0, 0 };
+    auto subTensor = handleFactory.CreateSubTensorHandle(*parent, info.GetShape(), origin);
+    BOOST_REQUIRE(subTensor);
+    BOOST_CHECK(subTensor->GetParent() == parent.get());
+
+    // The sub-tensor only uses the memory of its parent, which is the one managed.
+    parent->Manage();
+    parent->Allocate();
+    memoryManager->Acquire();
+    BOOST_CHECK(subTensor->Map() == parent->Map());
+    memoryManager->Release();
+
+    // Sub-tensors contiguous in their parent start at the offset of their origin.
+    const unsigned int rowOrigin[] = { 1, 0 };
+    auto rowSubTensor = handleFactory.CreateSubTensorHandle(*parent, TensorShape({ 1, 3 }), rowOrigin);
+    BOOST_REQUIRE(rowSubTensor);
+    memoryManager->Acquire();
+    BOOST_CHECK(rowSubTensor->Map() == static_cast<const float*>(parent->Map()) + 3);
+    memoryManager->Release();
+
+    // Sub-tensors which aren't contiguous in their parent aren't supported.
+    const unsigned int columnOrigin[] = { 0, 1 };
+    BOOST_CHECK(!handleFactory.CreateSubTensorHandle(*parent, TensorShape({ 2, 1 }), columnOrigin));
+}
+
+BOOST_AUTO_TEST_CASE(RefTensorHandleSubTensorAlongChannels)
+{
+    std::shared_ptr<RefMemoryManager> memoryManager = std::make_shared<RefMemoryManager>();
+    RefTensorHandleFactory handleFactory(memoryManager);
+    TensorInfo info({ 1, 4, 2, 2 }, DataType::Float32);
+
+    auto parent = handleFactory.CreateTensorHandle(info);
+    parent->Manage();
+    parent->Allocate();
+
+    // Concatenating along the channels of a single batch gives contiguous views of the output.
+    const unsigned int origin[] = { 0, 2, 0, 0 };
+    auto subTensor = handleFactory.CreateSubTensorHandle(*parent, TensorShape({ 1, 2, 2, 2 }), origin);
+    BOOST_REQUIRE(subTensor);
+    BOOST_TEST(subTensor->GetShape() == TensorShape({ 1, 2, 2, 2 }));
+
+    memoryManager->Acquire();
+    BOOST_CHECK(subTensor->Map() == static_cast<const float*>(parent->Map()) + 8);
+    memoryManager->Release();
+
+    // Views along the width are not contiguous.
+    const unsigned int widthOrigin[] = { 0, 0, 0, 1 };
+    BOOST_CHECK(!handleFactory.CreateSubTensorHandle(*parent, TensorShape({ 1, 4, 2, 1 }), widthOrigin));
+}
+
 #if !defined(__ANDROID__)
 // Only run these tests on non Android platforms
 BOOST_AUTO_TEST_CASE(CheckSourceType)
@@ -212,4 +297,54 @@ BOOST_AUTO_TEST_CASE(MisalignedPointer)
 
 #endif
 
+#if defined(__linux__) && defined(MFD_CLOEXEC)
+BOOST_AUTO_TEST_CASE(ImportDmaBuf)
+{
+    TensorInfo info({ 4 }, DataType::Float32);
+    RefTensorHandle handle(info, static_cast<unsigned int>(MemorySource::DmaBuf));
+
+    const float data[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    int fd = memfd_create("ImportDmaBuf", MFD_CLOEXEC);
+    BOOST_TEST_REQUIRE(fd >= 0);
+    BOOST_TEST_REQUIRE(write(fd, data, sizeof(data)) == static_cast<ssize_t>(sizeof(data)));
+
+    // The buffer is mapped rather than copied, and stays mapped once the descriptor is closed
+    BOOST_CHECK(handle.Import(&fd, MemorySource::DmaBuf));
+    close(fd);
+    float* buffer = static_cast<float*>(handle.Map());
+    BOOST_CHECK(buffer[0] == 1.0f);
+    BOOST_CHECK(buffer[3] == 4.0f);
+    buffer[3] = 5.0f;
+    handle.Unmap();
+
+    // Importing a buffer too small for the tensor fails
+    int smallFd = memfd_create("ImportDmaBufSmall", MFD_CLOEXEC);
+    BOOST_TEST_REQUIRE(smallFd >= 0);
+    BOOST_TEST_REQUIRE(ftruncate(smallFd, sizeof(float)) == 0);
+    BOOST_CHECK(!handle.Import(&smallFd, MemorySource::DmaBuf));
+    BOOST_CHECK_THROW(handle.Map(), armnn::NullPointerException);
+    close(smallFd);
+
+    // Writes through the tensor handle reach the buffer
+    int outputFd = memfd_create("ImportDmaBufOutput", MFD_CLOEXEC);
+    BOOST_TEST_REQUIRE(outputFd >= 0);
+    BOOST_TEST_REQUIRE(ftruncate(outputFd, sizeof(data)) == 0);
+    BOOST_CHECK(handle.Import(&outputFd, MemorySource::DmaBuf));
+    BOOST_CHECK(handle.Import(&outputFd, MemorySource::DmaBuf));
+    static_cast<float*>(handle.Map())[2] = 6.0f;
+    handle.Unmap();
+    float outputData[4] = {};
+    BOOST_CHECK(pread(outputFd, outputData, sizeof(outputData), 0) == static_cast<ssize_t>(sizeof(outputData)));
+    BOOST_CHECK(outputData[2] == 6.0f);
+
+    // Sub-tensors access the buffer through their parent
+    RefTensorHandle subTensor(TensorInfo({ 2 }, DataType::Float32), handle, 2 * sizeof(float));
+    static_cast<float*>(subTensor.Map())[1] = 7.0f;
+    subTensor.Unmap();
+    BOOST_CHECK(pread(outputFd, outputData, sizeof(outputData), 0) == static_cast<ssize_t>(sizeof(outputData)));
+    BOOST_CHECK(outputData[3] == 7.0f);
+    close(outputFd);
+}
+#endif
+
 BOOST_AUTO_TEST_SUITE_END()
@@ -3,6 +3,8 @@
 // SPDX-License-Identifier: MIT
 //
 
+#pragma once
+
 #include "BaseIterator.hpp"
 #include <armnn/Tensor.hpp>
 
@@ -58,6 +60,48 @@ struct BroadcastLoop
         outData -= outDataMovement;
     }
 
+    /// Applies operationFunc to the output rows [firstRow, lastRow), where a row is a run over the innermost dimension
+    /// of the output, in memory order. The iterators must be at the start of their tensors and are left there.
+    template <typename Func, typename DecoderOp, typename EncoderOp>
+    void UnrollRows(Func operationFunc,
+                    unsigned int firstRow,
+                    unsigned int lastRow,
+                    DecoderOp& inData0,
+                    DecoderOp& inData1,
+                    EncoderOp& outData)
+    {
+        const unsigned int innermostDimension = GetNumDimensions() > 0 ? GetNumDimensions() - 1 : 0;
+
+        for (unsigned int row = firstRow; row < lastRow; row++)
+        {
+            unsigned int inData0Movement = 0;
+            unsigned int inData1Movement = 0;
+            unsigned int outDataMovement = 0;
+
+            unsigned int remainder = row;
+            for (unsigned int dimension = innermostDimension; dimension-- > 0;)
+            {
+                const unsigned int index = remainder % m_DimData[dimension].m_DimSize;
+                remainder /= m_DimData[dimension].m_DimSize;
+
+                inData0Movement += index * m_DimData[dimension].m_Stride1;
+                inData1Movement += index * m_DimData[dimension].m_Stride2;
+                outDataMovement += index * m_DimData[dimension].m_StrideOut;
+            }
+
+            inData0 += inData0Movement;
+            inData1 += inData1Movement;
+            outData += outDataMovement;
+
+            Unroll(operationFunc, innermostDimension, inData0, inData1, outData);
+
+            // move iterator back to the start
+            inData0 -= inData0Movement;
+            inData1 -= inData1Movement;
+            outData -= outDataMovement;
+        }
+    }
+
     template <typename Func, typename DecoderOp, typename EncoderOp>
     void Unroll(Func operationFunc,
                 unsigned int dimension,
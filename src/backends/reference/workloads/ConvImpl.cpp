@@ -68,12 +68,13 @@ int32_t QuantizedMultiplierSmallerThanOne::RoundingDivideByPOT(int32_t x, int ex
     return (x >> exponent) + (remainder > threshold ? 1 : 0);
 }
 
+template<typename DecoderType, typename EncoderType>
 void Convolve(const TensorShape& rInputShape,
-              Decoder<float>& rInputDecoder,
+              DecoderType& rInputDecoder,
               const TensorShape& rOutputShape,
-              Encoder<float>& rOutputEncoder,
+              EncoderType& rOutputEncoder,
               const TensorShape& rFilterShape,
-              Decoder<float>& rFilterDecoder,
+              DecoderType& rFilterDecoder,
               bool biasEnabled,
               Decoder<float>* pBiasDecoder,
               DataLayout dataLayout,
@@ -83,7 +84,9 @@ void Convolve(const TensorShape& rInputShape,
               unsigned int yStride,
               unsigned int xDilation,
               unsigned int yDilation,
-              bool depthwise)
+              bool depthwise,
+              unsigned int firstRow,
+              unsigned int lastRow)
 {
     if (biasEnabled && !pBiasDecoder)
     {
@@ -99,7 +102,6 @@ void Convolve(const TensorShape& rInputShape,
     unsigned int inputChannels   = depthwise ? rFilterShape[1] : rFilterShape[channelsIndex];
     unsigned int outputChannels  = depthwise ? inputChannels * depthMultiplier : rFilterShape[0];
 
-    unsigned int batchSize    = rOutputShape[0];
     unsigned int outputHeight = rOutputShape[heightIndex];
     unsigned int outputWidth  = rOutputShape[widthIndex];
     unsigned int inputHeight  = rInputShape[heightIndex];
@@ -108,121 +110,127 @@ void Convolve(const TensorShape& rInputShape,
     unsigned int filterHeight = depthwise ? rFilterShape[2] : rFilterShape[heightIndex];
     unsigned int filterWidth  = depthwise ? rFilterShape[3] : rFilterShape[widthIndex];
 
-    for (unsigned int batchIdx = 0; batchIdx < batchSize; batchIdx++)
+    for (unsigned int row = firstRow; row < lastRow; row++)
     {
-        for (unsigned int cOutput = 0; cOutput < outputChannels; cOutput++)
+        const unsigned int batchIdx = row / (outputChannels * outputHeight);
+        const unsigned int cOutput  = (row / outputHeight) % outputChannels;
+        const unsigned int yOutput  = row % outputHeight;
+
+        for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
         {
-            for (unsigned int yOutput = 0; yOutput < outputHeight; yOutput++)
+            // This loop goes over each output element.
+            float sum =  0.0f;
+
+            // For depthwise, each output channel corresponds to exactly one input channel.
+            // For normal, must loop over each input channel.
+            for (unsigned int cInput = 0; cInput < (depthwise ? 1 : inputChannels); cInput++)
             {
-                for (unsigned int xOutput = 0; xOutput < outputWidth; xOutput++)
+                unsigned int depthwiseMultiplierIdx = 0;
+                if (depthwise)
                 {
-                    // This loop goes over each output element.
-                    float sum =  0.0f;
+                    cInput = cOutput / depthMultiplier;
+                    depthwiseMultiplierIdx = cOutput % depthMultiplier;
+                }
 
-                    // For depthwise, each output channel corresponds to exactly one input channel.
-                    // For normal, must loop over each input channel.
-                    for (unsigned int cInput = 0; cInput < (depthwise ? 1 : inputChannels); cInput++)
+                for (unsigned int yFilter = 0; yFilter < filterHeight; yFilter++)
+                {
+                    for (unsigned int xFilter = 0; xFilter < filterWidth; xFilter++)
                     {
-                        unsigned int depthwiseMultiplierIdx = 0;
+                        // This loop goes over each input element for each output element.
+                        unsigned int filterIndex = 0;
+
+                        // Since dimensionality of kernel depends on depthwiseness, so does index.
                         if (depthwise)
                         {
-                            cInput = cOutput / depthMultiplier;
-                            depthwiseMultiplierIdx = cOutput % depthMultiplier;
+                            filterIndex = depthwiseMultiplierIdx * filterWidth * filterHeight * inputChannels +
+                                          cInput * filterWidth * filterHeight +
+                                          yFilter * filterWidth +
+                                          xFilter;
                         }
-
-                        for (unsigned int yFilter = 0; yFilter < filterHeight; yFilter++)
+                        else
                         {
-                            for (unsigned int xFilter = 0; xFilter < filterWidth; xFilter++)
+                            // Keep this implementation, as using DataLayoutIndexed::GetIndex causes great
+                            // performance regression.
+                            if (dataLayout == DataLayout::NHWC)
+                            {
+                                filterIndex = cOutput * filterHeight * filterWidth * inputChannels +
+                                              yFilter * filterWidth * inputChannels +
+                                              xFilter * inputChannels +
+                                              cInput;
+                            }
+                            else
                             {
-                                // This loop goes over each input element for each output element.
-                                unsigned int filterIndex = 0;
-
-                                // Since dimensionality of kernel depends on depthwiseness, so does index.
-                                if (depthwise)
-                                {
-                                    filterIndex = depthwiseMultiplierIdx * filterWidth * filterHeight * inputChannels +
-                                                  cInput * filterWidth * filterHeight +
-                                                  yFilter * filterWidth +
-                                                  xFilter;
-                                }
-                                else
-                                {
-                                    // Keep this implementation, as using DataLayoutIndexed::GetIndex causes great
-                                    // performance regression.
-                                    if (dataLayout == DataLayout::NHWC)
-                                    {
-                                        filterIndex = cOutput * filterHeight * filterWidth * inputChannels +
-                                                      yFilter * filterWidth * inputChannels +
-                                                      xFilter * inputChannels +
-                                                      cInput;
-                                    }
-                                    else
-                                    {
-                                        filterIndex = cOutput * filterWidth * filterHeight * inputChannels +
-                                                      cInput  * filterWidth * filterHeight +
-                                                      yFilter * filterWidth +
-                                                      xFilter;
-                                    }
-                                }
-
-                                rFilterDecoder.SetIndex(filterIndex, cOutput);
-                                float filterValue = rFilterDecoder.Get();
-
-                                unsigned int yInput = yOutput * yStride + yFilter * yDilation;
-                                unsigned int xInput = xOutput * xStride + xFilter * xDilation;
-
-                                float inputValue;
-
-                                // Check if we're in the padding.
-                                if (yInput < paddingTop || yInput >= inputHeight + paddingTop ||
-                                    xInput < paddingLeft || xInput >= inputWidth + paddingLeft )
-                                {
-                                    inputValue = 0.0f;
-                                }
-                                else
-                                {
-                                    unsigned int inputIndex = 0;
-
-                                    // Keep this implementation, as using DataLayoutIndexed::GetIndex causes great
-                                    // performance regression.
-                                    if (dataLayout == DataLayout::NHWC)
-                                    {
-                                        inputIndex = batchIdx * inputHeight * inputWidth  * inputChannels +
-                                                     (yInput - paddingTop) * inputWidth * inputChannels +
-                                                     (xInput - paddingLeft) * inputChannels +
-                                                     cInput;
-                                    }
-                                    else
-                                    {
-                                        inputIndex = batchIdx * inputWidth * inputHeight * inputChannels +
-                                                     inputWidth * inputHeight * cInput +
-                                                     inputWidth * (yInput - paddingTop) +
-                                                     xInput - paddingLeft;
-                                    }
-
-                                    rInputDecoder[inputIndex];
-                                    inputValue = rInputDecoder.Get();
-                                }
-
-                                sum += filterValue * inputValue;
+                                filterIndex = cOutput * filterWidth * filterHeight * inputChannels +
+                                              cInput  * filterWidth * filterHeight +
+                                              yFilter * filterWidth +
+                                              xFilter;
                             }
                         }
-                    }
 
-                    if (biasEnabled)
-                    {
-                        (*pBiasDecoder).SetIndex(cOutput, cOutput);
-                        sum += pBiasDecoder->Get();
-                    }
+                        rFilterDecoder.SetIndex(filterIndex, cOutput);
+                        float filterValue = rFilterDecoder.Get();
+
+                        unsigned int yInput = yOutput * yStride + yFilter * yDilation;
+                        unsigned int xInput = xOutput * xStride + xFilter * xDilation;
 
-                    unsigned int outIdx = dataLayoutIndexed.GetIndex(rOutputShape, batchIdx, cOutput, yOutput, xOutput);
+                        float inputValue;
+
+                        // Check if we're in the padding.
+                        if (yInput < paddingTop || yInput >= inputHeight + paddingTop ||
+                            xInput < paddingLeft || xInput >= inputWidth + paddingLeft )
+                        {
+                            inputValue = 0.0f;
+                        }
+                        else
+                        {
+                            unsigned int inputIndex = 0;
 
-                    rOutputEncoder[outIdx];
-                    rOutputEncoder.Set(sum);
+                            // Keep this implementation, as using DataLayoutIndexed::GetIndex causes great
+                            // performance regression.
+                            if (dataLayout == DataLayout::NHWC)
+                            {
+                                inputIndex = batchIdx * inputHeight * inputWidth  * inputChannels +
+                                             (yInput - paddingTop) * inputWidth * inputChannels +
+                                             (xInput - paddingLeft) * inputChannels +
+                                             cInput;
+                            }
+                            else
+                            {
+                                inputIndex = batchIdx * inputWidth * inputHeight * inputChannels +
+                                             inputWidth * inputHeight * cInput +
+                                             inputWidth * (yInput - paddingTop) +
+                                             xInput - paddingLeft;
+                            }
+
+                            rInputDecoder[inputIndex];
+                            inputValue = rInputDecoder.Get();
+                        }
+
+                        sum += filterValue * inputValue;
+                    }
                 }
             }
+
+            if (biasEnabled)
+            {
+                (*pBiasDecoder).SetIndex(cOutput, cOutput);
+                sum += pBiasDecoder->Get();
+            }
+
+            unsigned int outIdx = dataLayoutIndexed.GetIndex(rOutputShape, batchIdx, cOutput, yOutput, xOutput);
+
+            rOutputEncoder[outIdx];
+            rOutputEncoder.Set(sum);
         }
     }
 }
 
+#define INSTANTIATE_CONVOLVE(DecoderType, EncoderType)                                                     \
+    template void Convolve(const TensorShape&, DecoderType&, const TensorShape&, EncoderType&,             \
+                           const TensorShape&, DecoderType&, bool, Decoder<float>*, DataLayout,            \
+                           unsigned int, unsigned int, unsigned int, unsigned int, unsigned int,           \
+                           unsigned int, bool, unsigned int, unsigned int);
+
+ARMNN_REF_FOR_EACH_ITERATOR_TYPE(INSTANTIATE_CONVOLVE)
+
 } // namespace armnn
@@ -9,6 +9,7 @@
 #include "TensorBufferArrayView.hpp"
 #include "BaseIterator.hpp"
 #include "Decoders.hpp"
+#include "DirectIterators.hpp"
 #include "Encoders.hpp"
 
 #include <armnn/Tensor.hpp>
@@ -47,12 +48,17 @@ private:
     int32_t m_RightShift;
 };
 
+/// Computes the output rows [firstRow, lastRow), where a row holds the outputs of one batch, output channel and output
+/// y coordinate, numbered batch by batch, then channel by channel. Rows don't depend on each other, so disjoint ranges
+/// can be computed concurrently as long as each range has its own decoders and encoder.
+/// Instantiated for the iterators of DirectIterators.hpp and for Decoder<float> and Encoder<float>.
+template<typename DecoderType, typename EncoderType>
 void Convolve(const TensorShape& rInputShape,
-              Decoder<float>& rInputDecoder,
+              DecoderType& rInputDecoder,
               const TensorShape& rOutputShape,
-              Encoder<float>& rOutputEncoder,
+              EncoderType& rOutputEncoder,
               const TensorShape& rFilterShape,
-              Decoder<float>& rFilterDecoder,
+              DecoderType& rFilterDecoder,
               bool biasEnabled,
               Decoder<float>* pBiasDecoder,
               DataLayout dataLayout,
@@ -62,5 +68,7 @@ void Convolve(const TensorShape& rInputShape,
               unsigned int yStride,
               unsigned int xDilation,
               unsigned int yDilation,
-              bool depthwise = false);
+              bool depthwise,
+              unsigned int firstRow,
+              unsigned int lastRow);
 } //namespace armnn
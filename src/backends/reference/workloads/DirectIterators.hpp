@@ -0,0 +1,275 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include "Decoders.hpp"
+#include "Encoders.hpp"
+
+#include <armnn/Tensor.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace armnn
+{
+
+/// Non-virtual counterparts of Decoder<float> and Encoder<float> for the data types the reference kernels see most:
+/// Float32, Float16, and 8-bit integers quantized per tensor. Their accesses inline down to a load or a store and
+/// a conversion, so kernels which take their decoders and encoders as template parameters run without any indirect
+/// call per element for these tensors. See VisitDirectIterators().
+template<typename T>
+class DirectIterator
+{
+public:
+    explicit DirectIterator(T* data)
+        : m_Iterator(data), m_Start(data)
+    {}
+
+    DirectIterator& operator++()
+    {
+        ++m_Iterator;
+        return *this;
+    }
+
+    DirectIterator& operator+=(const unsigned int increment)
+    {
+        m_Iterator += increment;
+        return *this;
+    }
+
+    DirectIterator& operator-=(const unsigned int increment)
+    {
+        m_Iterator -= increment;
+        return *this;
+    }
+
+    DirectIterator& operator[](const unsigned int index)
+    {
+        m_Iterator = m_Start + index;
+        return *this;
+    }
+
+    DirectIterator& SetIndex(unsigned int index, unsigned int axisIndex = 0)
+    {
+        IgnoreUnused(axisIndex);
+        m_Iterator = m_Start + index;
+        return *this;
+    }
+
+protected:
+    T* m_Iterator;
+    T* m_Start;
+};
+
+/// Conversions between float and the element types of the direct iterators, matching those of the Decoder<float>
+/// and Encoder<float> of the same data types. The quantization parameters are ignored by the floating point types.
+template<typename T>
+struct DirectConversion
+{
+    static float Decode(T value, float scale, int32_t offset)
+    {
+        return static_cast<float>(static_cast<int32_t>(value) - offset) * scale;
+    }
+
+    static T Encode(float value, float scale, int32_t offset)
+    {
+        constexpr float min = static_cast<float>(std::numeric_limits<T>::lowest());
+        constexpr float max = static_cast<float>(std::numeric_limits<T>::max());
+        return static_cast<T>(std::min(std::max(std::round(value / scale) + static_cast<float>(offset), min), max));
+    }
+};
+
+template<>
+struct DirectConversion<float>
+{
+    static float Decode(float value, float, int32_t) { return value; }
+    static float Encode(float value, float, int32_t) { return value; }
+};
+
+template<>
+struct DirectConversion<Half>
+{
+    static float Decode(Half value, float, int32_t) { return static_cast<float>(value); }
+    static Half Encode(float value, float, int32_t) { return Half(value); }
+};
+
+template<typename T>
+class DirectDecoder : public DirectIterator<const T>
+{
+public:
+    DirectDecoder(const TensorInfo& info, const void* data)
+        : DirectIterator<const T>(static_cast<const T*>(data))
+        , m_Scale(info.GetQuantizationScale())
+        , m_Offset(info.GetQuantizationOffset())
+    {}
+
+    float Get() const
+    {
+        return DirectConversion<T>::Decode(*this->m_Iterator, m_Scale, m_Offset);
+    }
+
+private:
+    const float m_Scale;
+    const int32_t m_Offset;
+};
+
+template<typename T>
+class DirectEncoder : public DirectIterator<T>
+{
+public:
+    DirectEncoder(const TensorInfo& info, void* data)
+        : DirectIterator<T>(static_cast<T*>(data))
+        , m_Scale(info.GetQuantizationScale())
+        , m_Offset(info.GetQuantizationOffset())
+    {}
+
+    void Set(float value)
+    {
+        *this->m_Iterator = DirectConversion<T>::Encode(value, m_Scale, m_Offset);
+    }
+
+    float Get() const
+    {
+        return DirectConversion<T>::Decode(*this->m_Iterator, m_Scale, m_Offset);
+    }
+
+private:
+    const float m_Scale;
+    const int32_t m_Offset;
+};
+
+/// Expands INSTANTIATE(DecoderType, EncoderType) for the virtual iterators and for the direct iterators of each
+/// element type, to instantiate the kernels VisitDirectIterators() calls.
+#define ARMNN_REF_FOR_EACH_ITERATOR_TYPE(INSTANTIATE)               \
+    INSTANTIATE(Decoder<float>, Encoder<float>)                     \
+    INSTANTIATE(DirectDecoder<float>, DirectEncoder<float>)         \
+    INSTANTIATE(DirectDecoder<Half>, DirectEncoder<Half>)           \
+    INSTANTIATE(DirectDecoder<uint8_t>, DirectEncoder<uint8_t>)     \
+    INSTANTIATE(DirectDecoder<int8_t>, DirectEncoder<int8_t>)
+
+namespace
+{
+
+/// Element type of the direct iterators of a tensor, if it has them.
+enum class DirectType
+{
+    None,
+    Float32,
+    Float16,
+    UInt8,
+    Int8
+};
+
+inline DirectType GetDirectType(const TensorInfo& info)
+{
+    if (info.HasPerAxisQuantization())
+    {
+        return DirectType::None;
+    }
+    switch (info.GetDataType())
+    {
+        case DataType::Float32:
+            return DirectType::Float32;
+        case DataType::Float16:
+            return DirectType::Float16;
+        case DataType::QAsymmU8:
+            return DirectType::UInt8;
+        case DataType::QAsymmS8:
+        case DataType::QSymmS8:
+            return DirectType::Int8;
+        default:
+            return DirectType::None;
+    }
+}
+
+template<typename T, typename Func>
+void VisitDirectIteratorsOf(const TensorInfo& inputInfo, const void* inputData,
+                            const TensorInfo& outputInfo, void* outputData, Func&& func)
+{
+    DirectDecoder<T> input(inputInfo, inputData);
+    DirectEncoder<T> output(outputInfo, outputData);
+    func(input, output);
+}
+
+template<typename T, typename Func>
+void VisitDirectIteratorsOf(const TensorInfo& inputInfo0, const void* inputData0,
+                            const TensorInfo& inputInfo1, const void* inputData1,
+                            const TensorInfo& outputInfo, void* outputData, Func&& func)
+{
+    DirectDecoder<T> input0(inputInfo0, inputData0);
+    DirectDecoder<T> input1(inputInfo1, inputData1);
+    DirectEncoder<T> output(outputInfo, outputData);
+    func(input0, input1, output);
+}
+
+} // anonymous namespace
+
+/// Calls func(inputDecoder, outputEncoder) with direct iterators if both tensors have the same element type among
+/// those of the direct iterators, and with a Decoder<float> and an Encoder<float> otherwise.
+template<typename Func>
+void VisitDirectIterators(const TensorInfo& inputInfo, const void* inputData,
+                          const TensorInfo& outputInfo, void* outputData, Func&& func)
+{
+    const DirectType directType = GetDirectType(inputInfo);
+    if (directType == GetDirectType(outputInfo))
+    {
+        switch (directType)
+        {
+            case DirectType::Float32:
+                return VisitDirectIteratorsOf<float>(inputInfo, inputData, outputInfo, outputData, func);
+            case DirectType::Float16:
+                return VisitDirectIteratorsOf<Half>(inputInfo, inputData, outputInfo, outputData, func);
+            case DirectType::UInt8:
+                return VisitDirectIteratorsOf<uint8_t>(inputInfo, inputData, outputInfo, outputData, func);
+            case DirectType::Int8:
+                return VisitDirectIteratorsOf<int8_t>(inputInfo, inputData, outputInfo, outputData, func);
+            default:
+                break;
+        }
+    }
+
+    std::unique_ptr<Decoder<float>> input = MakeDecoder<float>(inputInfo, inputData);
+    std::unique_ptr<Encoder<float>> output = MakeEncoder<float>(outputInfo, outputData);
+    func(*input, *output);
+}
+
+/// Calls func(inputDecoder0, inputDecoder1, outputEncoder) as above, the three tensors having to share the element
+/// type for the direct iterators to be used.
+template<typename Func>
+void VisitDirectIterators(const TensorInfo& inputInfo0, const void* inputData0,
+                          const TensorInfo& inputInfo1, const void* inputData1,
+                          const TensorInfo& outputInfo, void* outputData, Func&& func)
+{
+    const DirectType directType = GetDirectType(inputInfo0);
+    if (directType == GetDirectType(inputInfo1) && directType == GetDirectType(outputInfo))
+    {
+        switch (directType)
+        {
+            case DirectType::Float32:
+                return VisitDirectIteratorsOf<float>(inputInfo0, inputData0, inputInfo1, inputData1,
+                                                     outputInfo, outputData, func);
+            case DirectType::Float16:
+                return VisitDirectIteratorsOf<Half>(inputInfo0, inputData0, inputInfo1, inputData1,
+                                                    outputInfo, outputData, func);
+            case DirectType::UInt8:
+                return VisitDirectIteratorsOf<uint8_t>(inputInfo0, inputData0, inputInfo1, inputData1,
+                                                       outputInfo, outputData, func);
+            case DirectType::Int8:
+                return VisitDirectIteratorsOf<int8_t>(inputInfo0, inputData0, inputInfo1, inputData1,
+                                                      outputInfo, outputData, func);
+            default:
+                break;
+        }
+    }
+
+    std::unique_ptr<Decoder<float>> input0 = MakeDecoder<float>(inputInfo0, inputData0);
+    std::unique_ptr<Decoder<float>> input1 = MakeDecoder<float>(inputInfo1, inputData1);
+    std::unique_ptr<Encoder<float>> output = MakeEncoder<float>(outputInfo, outputData);
+    func(*input0, *input1, *output);
+}
+
+} // namespace armnn
@@ -6,6 +6,7 @@
 #pragma once
 
 #include "BaseIterator.hpp"
+#include "Broadcast.hpp"
 #include <armnn/Tensor.hpp>
 
 namespace armnn
@@ -23,6 +24,24 @@ struct ElementwiseBinaryFunction
                               Decoder<InType>& inData0,
                               Decoder<InType>& inData1,
                               Encoder<OutType>& outData);
+
+    /// Computes the output rows [firstRow, lastRow) only, a row being a run over the innermost dimension of outShape.
+    /// Rows don't depend on each other, so disjoint ranges can be computed concurrently as long as each range has its
+    /// own decoders and encoder. Takes the iterators as template parameters so that the direct iterators of
+    /// DirectIterators.hpp can be used in place of Decoder<InType> and Encoder<OutType>.
+    template <typename DecoderOp, typename EncoderOp>
+    ElementwiseBinaryFunction(const TensorShape& inShape0,
+                              const TensorShape& inShape1,
+                              const TensorShape& outShape,
+                              DecoderOp& inData0,
+                              DecoderOp& inData1,
+                              EncoderOp& outData,
+                              unsigned int firstRow,
+                              unsigned int lastRow)
+    {
+        BroadcastLoop(inShape0, inShape1, outShape).UnrollRows(Functor(), firstRow, lastRow,
+                                                               inData0, inData1, outData);
+    }
 };
 
 template <typename Functor>
@@ -7,56 +7,70 @@
 
 #include "RefWorkloadUtils.hpp"
 
+#include <armnn/utility/IgnoreUnused.hpp>
+
 namespace armnn
 {
 
+template<typename DecoderType, typename EncoderType>
 void FullyConnected(const TensorShape& rInputShape,
-                    Decoder<float>& rInputDecoder,
+                    DecoderType& rInputDecoder,
                     const TensorShape& rOutputShape,
-                    Encoder<float>& rOutputEncoder,
-                    Decoder<float>& rWeightDecoder,
+                    EncoderType& rOutputEncoder,
+                    DecoderType& rWeightDecoder,
                     Decoder<float>& rBiasDecoder,
                     const bool biasEnabled,
                     const unsigned int K,
-                    const bool transposeWeights)
+                    const bool transposeWeights,
+                    const unsigned int firstOutput,
+                    const unsigned int lastOutput)
 {
+    IgnoreUnused(rInputShape);
+
     // Perform FullyConnected implementation
     unsigned int outputSize = rOutputShape[1];
 
-    for (unsigned int n = 0; n < rInputShape[0]; n++)
+    for (unsigned int outputIdx = firstOutput; outputIdx < lastOutput; outputIdx++)
     {
-        for (unsigned int channelOutput = 0; channelOutput < outputSize; channelOutput++)
-        {
-            float outval = 0.f;
+        const unsigned int n             = outputIdx / outputSize;
+        const unsigned int channelOutput = outputIdx % outputSize;
 
-            for (unsigned int channelInput = 0; channelInput < K; channelInput++)
+        float outval = 0.f;
+
+        for (unsigned int channelInput = 0; channelInput < K; channelInput++)
+        {
+            float weight;
+            if (transposeWeights)
             {
-                float weight;
-                if (transposeWeights)
-                {
-                    rWeightDecoder[channelOutput * K + channelInput];
-                    weight = rWeightDecoder.Get();
-                }
-                else
-                {
-                    rWeightDecoder[channelInput * outputSize + channelOutput];
-                    weight = rWeightDecoder.Get();
-                }
-
-                rInputDecoder[n * K + channelInput];
-                outval += weight * rInputDecoder.Get();
+                rWeightDecoder[channelOutput * K + channelInput];
+                weight = rWeightDecoder.Get();
             }
-
-            if (biasEnabled)
+            else
             {
-                rBiasDecoder[channelOutput];
-                outval += rBiasDecoder.Get();
+                rWeightDecoder[channelInput * outputSize + channelOutput];
+                weight = rWeightDecoder.Get();
             }
 
-            rOutputEncoder[n * outputSize + channelOutput];
-            rOutputEncoder.Set(outval);
+            rInputDecoder[n * K + channelInput];
+            outval += weight * rInputDecoder.Get();
         }
+
+        if (biasEnabled)
+        {
+            rBiasDecoder[channelOutput];
+            outval += rBiasDecoder.Get();
+        }
+
+        rOutputEncoder[n * outputSize + channelOutput];
+        rOutputEncoder.Set(outval);
     }
 }
 
+#define INSTANTIATE_FULLY_CONNECTED(DecoderType, EncoderType)                                              \
+    template void FullyConnected(const TensorShape&, DecoderType&, const TensorShape&, EncoderType&,       \
+                                 DecoderType&, Decoder<float>&, const bool, const unsigned int,            \
+                                 const bool, const unsigned int, const unsigned int);
+
+ARMNN_REF_FOR_EACH_ITERATOR_TYPE(INSTANTIATE_FULLY_CONNECTED)
+
 } //namespace armnn
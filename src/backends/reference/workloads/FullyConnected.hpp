@@ -7,6 +7,7 @@
 
 #include "BaseIterator.hpp"
 #include "Decoders.hpp"
+#include "DirectIterators.hpp"
 #include "Encoders.hpp"
 #include <armnn/Tensor.hpp>
 #include <backendsCommon/WorkloadData.hpp>
@@ -15,14 +16,20 @@ namespace armnn
 {
 
 /// Performs a matrix multiplication and optionally adds a bias.
+/// Computes the outputs [firstOutput, lastOutput), numbered batch by batch. Outputs don't depend on each other, so
+/// disjoint ranges can be computed concurrently as long as each range has its own decoders and encoder.
+/// Instantiated for the iterators of DirectIterators.hpp and for Decoder<float> and Encoder<float>.
+template<typename DecoderType, typename EncoderType>
 void FullyConnected(const TensorShape& rInputShape,
-                    Decoder<float>& rInputDecoder,
+                    DecoderType& rInputDecoder,
                     const TensorShape& rOutputShape,
-                    Encoder<float>& rOutputEncoder,
-                    Decoder<float>& rWeightDecoder,
+                    EncoderType& rOutputEncoder,
+                    DecoderType& rWeightDecoder,
                     Decoder<float>& rBiasDecoder,
                     bool biasEnabled,
                     unsigned int K,
-                    bool transposeWeights);
+                    bool transposeWeights,
+                    unsigned int firstOutput,
+                    unsigned int lastOutput);
 
 } //namespace armnn
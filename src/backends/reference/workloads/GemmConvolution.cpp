@@ -0,0 +1,299 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#include "GemmConvolution.hpp"
+
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
+#include <algorithm>
+
+namespace armnn
+{
+
+namespace
+{
+
+// Rows and columns of the output tile the microkernel accumulates in registers.
+constexpr unsigned int g_TileRows    = 4;
+constexpr unsigned int g_TileColumns = 8;
+
+// Pixels and filter elements per block, so that a block of the expanded input (64 KiB) stays in the L2 cache while a
+// panel of the packed filter (8 KiB) stays in the L1 cache.
+constexpr unsigned int g_BlockPixels   = 64;
+constexpr unsigned int g_BlockElements = 256;
+
+unsigned int RoundUp(unsigned int value, unsigned int multiple)
+{
+    return (value + multiple - 1) / multiple * multiple;
+}
+
+/// Dimensions of a convolution seen as a matrix multiplication: the expanded input has a row per output pixel and
+/// a column per filter element, ordered by filter y, filter x and input channel; the filter has a row per filter
+/// element and a column per output channel.
+struct GemmConvolutionShape
+{
+    GemmConvolutionShape(const TensorShape& inputShape,
+                         const TensorShape& outputShape,
+                         const TensorShape& filterShape,
+                         DataLayout dataLayout)
+    {
+        const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+        const unsigned int channelsIndex = dataLayoutIndexed.GetChannelsIndex();
+        const unsigned int heightIndex   = dataLayoutIndexed.GetHeightIndex();
+        const unsigned int widthIndex    = dataLayoutIndexed.GetWidthIndex();
+
+        m_InputChannels  = filterShape[channelsIndex];
+        m_OutputChannels = filterShape[0];
+        m_FilterHeight   = filterShape[heightIndex];
+        m_FilterWidth    = filterShape[widthIndex];
+        m_InputHeight    = inputShape[heightIndex];
+        m_InputWidth     = inputShape[widthIndex];
+        m_OutputHeight   = outputShape[heightIndex];
+        m_OutputWidth    = outputShape[widthIndex];
+        m_NumElements    = m_FilterHeight * m_FilterWidth * m_InputChannels;
+
+        // Distances between consecutive channels, rows and columns of the input.
+        const bool nhwc = dataLayout == DataLayout::NHWC;
+        m_InputBatchStride   = m_InputChannels * m_InputHeight * m_InputWidth;
+        m_InputChannelStride = nhwc ? 1 : m_InputHeight * m_InputWidth;
+        m_InputRowStride     = nhwc ? m_InputWidth * m_InputChannels : m_InputWidth;
+        m_InputColumnStride  = nhwc ? m_InputChannels : 1;
+    }
+
+    unsigned int m_InputChannels;
+    unsigned int m_OutputChannels;
+    unsigned int m_FilterHeight;
+    unsigned int m_FilterWidth;
+    unsigned int m_InputHeight;
+    unsigned int m_InputWidth;
+    unsigned int m_OutputHeight;
+    unsigned int m_OutputWidth;
+    unsigned int m_NumElements;
+
+    unsigned int m_InputBatchStride;
+    unsigned int m_InputChannelStride;
+    unsigned int m_InputRowStride;
+    unsigned int m_InputColumnStride;
+};
+
+/// Expands the filter elements [firstElement, firstElement + numElements) of the input patches of the numPixels
+/// pixels from firstPixel into panels of g_TileRows pixels, element by element. The padding and the rows of the
+/// last panel past numPixels are zeros.
+void PackInputBlock(const GemmConvolutionShape& shape,
+                    const float* inputData,
+                    unsigned int firstPixel,
+                    unsigned int numPixels,
+                    unsigned int firstElement,
+                    unsigned int numElements,
+                    unsigned int paddingTop,
+                    unsigned int paddingLeft,
+                    unsigned int xStride,
+                    unsigned int yStride,
+                    unsigned int xDilation,
+                    unsigned int yDilation,
+                    float* packedInput)
+{
+    const unsigned int numPanels = RoundUp(numPixels, g_TileRows) / g_TileRows;
+    std::fill(packedInput, packedInput + numPanels * numElements * g_TileRows, 0.0f);
+
+    for (unsigned int pixel = 0; pixel < numPixels; ++pixel)
+    {
+        const unsigned int outputIndex = firstPixel + pixel;
+        const unsigned int xOutput     = outputIndex % shape.m_OutputWidth;
+        const unsigned int yOutput     = (outputIndex / shape.m_OutputWidth) % shape.m_OutputHeight;
+        const unsigned int batch       = outputIndex / (shape.m_OutputWidth * shape.m_OutputHeight);
+
+        const float* batchData = inputData + batch * shape.m_InputBatchStride;
+        float* panel = packedInput + (pixel / g_TileRows) * numElements * g_TileRows + pixel % g_TileRows;
+
+        unsigned int channel = firstElement % shape.m_InputChannels;
+        unsigned int xFilter = (firstElement / shape.m_InputChannels) % shape.m_FilterWidth;
+        unsigned int yFilter = firstElement / (shape.m_InputChannels * shape.m_FilterWidth);
+
+        for (unsigned int element = 0; element < numElements; ++element)
+        {
+            // Unsigned arithmetic wraps the positions in the top and left padding past the input as well.
+            const unsigned int yInput = yOutput * yStride + yFilter * yDilation - paddingTop;
+            const unsigned int xInput = xOutput * xStride + xFilter * xDilation - paddingLeft;
+            if (yInput < shape.m_InputHeight && xInput < shape.m_InputWidth)
+            {
+                panel[element * g_TileRows] = batchData[yInput * shape.m_InputRowStride +
+                                                        xInput * shape.m_InputColumnStride +
+                                                        channel * shape.m_InputChannelStride];
+            }
+
+            if (++channel == shape.m_InputChannels)
+            {
+                channel = 0;
+                if (++xFilter == shape.m_FilterWidth)
+                {
+                    xFilter = 0;
+                    ++yFilter;
+                }
+            }
+        }
+    }
+}
+
+/// Adds the product of a panel of the expanded input by a panel of the packed filter, over numElements filter
+/// elements, to a g_TileRows by g_TileColumns tile of result, whose rows are resultStride apart. The tile is held in
+/// registers for the whole product, the inner loop over its columns being left to the compiler to vectorise.
+void MultiplyPanels(const float* inputPanel,
+                    const float* filterPanel,
+                    unsigned int numElements,
+                    float* result,
+                    unsigned int resultStride)
+{
+    float tile[g_TileRows][g_TileColumns];
+    for (unsigned int row = 0; row < g_TileRows; ++row)
+    {
+        for (unsigned int column = 0; column < g_TileColumns; ++column)
+        {
+            tile[row][column] = result[row * resultStride + column];
+        }
+    }
+
+    for (unsigned int element = 0; element < numElements; ++element)
+    {
+        const float* input  = inputPanel + element * g_TileRows;
+        const float* filter = filterPanel + element * g_TileColumns;
+        for (unsigned int row = 0; row < g_TileRows; ++row)
+        {
+            for (unsigned int column = 0; column < g_TileColumns; ++column)
+            {
+                tile[row][column] += input[row] * filter[column];
+            }
+        }
+    }
+
+    for (unsigned int row = 0; row < g_TileRows; ++row)
+    {
+        for (unsigned int column = 0; column < g_TileColumns; ++column)
+        {
+            result[row * resultStride + column] = tile[row][column];
+        }
+    }
+}
+
+} // anonymous namespace
+
+bool IsGemmConvolutionSupported(const TensorInfo& inputInfo,
+                                const TensorInfo& filterInfo,
+                                const TensorInfo& outputInfo,
+                                const TensorInfo* biasInfo)
+{
+    return inputInfo.GetDataType() == DataType::Float32 &&
+           filterInfo.GetDataType() == DataType::Float32 &&
+           outputInfo.GetDataType() == DataType::Float32 &&
+           (biasInfo == nullptr || biasInfo->GetDataType() == DataType::Float32);
+}
+
+std::vector<float> PackGemmConvolutionFilter(const TensorShape& filterShape,
+                                             const float* filterData,
+                                             DataLayout dataLayout)
+{
+    const armnnUtils::DataLayoutIndexed dataLayoutIndexed(dataLayout);
+    const unsigned int inputChannels  = filterShape[dataLayoutIndexed.GetChannelsIndex()];
+    const unsigned int outputChannels = filterShape[0];
+    const unsigned int filterHeight   = filterShape[dataLayoutIndexed.GetHeightIndex()];
+    const unsigned int filterWidth    = filterShape[dataLayoutIndexed.GetWidthIndex()];
+    const unsigned int numElements    = filterHeight * filterWidth * inputChannels;
+
+    // Panels of g_TileColumns output channels, element by element, the columns of the last panel past the output
+    // channels being zeros.
+    std::vector<float> packedFilter(RoundUp(outputChannels, g_TileColumns) * numElements, 0.0f);
+    for (unsigned int cOutput = 0; cOutput < outputChannels; ++cOutput)
+    {
+        float* panel = packedFilter.data() + (cOutput / g_TileColumns) * numElements * g_TileColumns +
+                       cOutput % g_TileColumns;
+
+        unsigned int element = 0;
+        for (unsigned int yFilter = 0; yFilter < filterHeight; ++yFilter)
+        {
+            for (unsigned int xFilter = 0; xFilter < filterWidth; ++xFilter)
+            {
+                for (unsigned int cInput = 0; cInput < inputChannels; ++cInput, ++element)
+                {
+                    const unsigned int filterIndex = dataLayout == DataLayout::NHWC ?
+                        ((cOutput * filterHeight + yFilter) * filterWidth + xFilter) * inputChannels + cInput :
+                        ((cOutput * inputChannels + cInput) * filterHeight + yFilter) * filterWidth + xFilter;
+                    panel[element * g_TileColumns] = filterData[filterIndex];
+                }
+            }
+        }
+    }
+    return packedFilter;
+}
+
+void GemmConvolve(const TensorShape& inputShape,
+                  const float* inputData,
+                  const TensorShape& outputShape,
+                  float* outputData,
+                  const TensorShape& filterShape,
+                  const float* packedFilter,
+                  const float* biasData,
+                  DataLayout dataLayout,
+                  unsigned int paddingTop,
+                  unsigned int paddingLeft,
+                  unsigned int xStride,
+                  unsigned int yStride,
+                  unsigned int xDilation,
+                  unsigned int yDilation,
+                  unsigned int firstPixel,
+                  unsigned int lastPixel)
+{
+    const GemmConvolutionShape shape(inputShape, outputShape, filterShape, dataLayout);
+    const unsigned int numFilterPanels = RoundUp(shape.m_OutputChannels, g_TileColumns) / g_TileColumns;
+    const unsigned int resultStride    = numFilterPanels * g_TileColumns;
+    const unsigned int outputPlaneSize = shape.m_OutputHeight * shape.m_OutputWidth;
+
+    std::vector<float> packedInput(g_BlockPixels * std::min(g_BlockElements, shape.m_NumElements));
+    std::vector<float> result(g_BlockPixels * resultStride);
+
+    for (unsigned int blockPixel = firstPixel; blockPixel < lastPixel; blockPixel += g_BlockPixels)
+    {
+        const unsigned int numPixels      = std::min(g_BlockPixels, lastPixel - blockPixel);
+        const unsigned int numInputPanels = RoundUp(numPixels, g_TileRows) / g_TileRows;
+        std::fill(result.begin(), result.end(), 0.0f);
+
+        for (unsigned int blockElement = 0; blockElement < shape.m_NumElements; blockElement += g_BlockElements)
+        {
+            const unsigned int numElements = std::min(g_BlockElements, shape.m_NumElements - blockElement);
+            PackInputBlock(shape, inputData, blockPixel, numPixels, blockElement, numElements,
+                           paddingTop, paddingLeft, xStride, yStride, xDilation, yDilation, packedInput.data());
+
+            for (unsigned int filterPanel = 0; filterPanel < numFilterPanels; ++filterPanel)
+            {
+                const float* filter = packedFilter +
+                                      (filterPanel * shape.m_NumElements + blockElement) * g_TileColumns;
+                for (unsigned int inputPanel = 0; inputPanel < numInputPanels; ++inputPanel)
+                {
+                    MultiplyPanels(packedInput.data() + inputPanel * numElements * g_TileRows,
+                                   filter,
+                                   numElements,
+                                   result.data() + inputPanel * g_TileRows * resultStride + filterPanel * g_TileColumns,
+                                   resultStride);
+                }
+            }
+        }
+
+        for (unsigned int pixel = 0; pixel < numPixels; ++pixel)
+        {
+            const unsigned int outputIndex = blockPixel + pixel;
+            const float* pixelResult = result.data() + pixel * resultStride;
+            for (unsigned int cOutput = 0; cOutput < shape.m_OutputChannels; ++cOutput)
+            {
+                const float bias = biasData ? biasData[cOutput] : 0.0f;
+                const unsigned int outIdx = dataLayout == DataLayout::NHWC ?
+                    outputIndex * shape.m_OutputChannels + cOutput :
+                    ((outputIndex / outputPlaneSize) * shape.m_OutputChannels + cOutput) * outputPlaneSize +
+                    outputIndex % outputPlaneSize;
+                outputData[outIdx] = pixelResult[cOutput] + bias;
+            }
+        }
+    }
+}
+
+} // namespace armnn
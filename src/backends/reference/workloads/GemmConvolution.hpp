@@ -0,0 +1,51 @@
+//
+// Copyright © 2020 Arm Ltd and Contributors. All rights reserved.
+// SPDX-License-Identifier: MIT
+//
+
+#pragma once
+
+#include <armnn/Tensor.hpp>
+#include <armnn/Types.hpp>
+
+#include <vector>
+
+namespace armnn
+{
+
+/// Returns true if GemmConvolve() can compute a convolution with these tensors, which it can when they are all
+/// Float32. biasInfo is null if the convolution has no bias.
+bool IsGemmConvolutionSupported(const TensorInfo& inputInfo,
+                                const TensorInfo& filterInfo,
+                                const TensorInfo& outputInfo,
+                                const TensorInfo* biasInfo);
+
+/// Rearranges a Convolution2d filter, laid out for dataLayout, into the panels GemmConvolve() multiplies the input
+/// by. The filter is packed once per workload, and again when its weights are updated.
+std::vector<float> PackGemmConvolutionFilter(const TensorShape& filterShape,
+                                             const float* filterData,
+                                             DataLayout dataLayout);
+
+/// Computes a Convolution2d as a matrix multiplication of the input, expanded patch by patch (im2col), by the packed
+/// filter. The multiplication is blocked to keep its operands in the caches and accumulates into registers over
+/// tiles of the output. Computes the output pixels [firstPixel, lastPixel) only, a pixel being all the output channels
+/// at one batch, y and x position, in that order. Pixels don't depend on each other, so disjoint ranges can be
+/// computed concurrently. biasData is null if the convolution has no bias.
+void GemmConvolve(const TensorShape& inputShape,
+                  const float* inputData,
+                  const TensorShape& outputShape,
+                  float* outputData,
+                  const TensorShape& filterShape,
+                  const float* packedFilter,
+                  const float* biasData,
+                  DataLayout dataLayout,
+                  unsigned int paddingTop,
+                  unsigned int paddingLeft,
+                  unsigned int xStride,
+                  unsigned int yStride,
+                  unsigned int xDilation,
+                  unsigned int yDilation,
+                  unsigned int firstPixel,
+                  unsigned int lastPixel);
+
+} // namespace armnn
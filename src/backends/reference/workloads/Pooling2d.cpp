@@ -144,14 +144,15 @@ void Pooling2d(Decoder<float>& rInputDecoder,
                Encoder<float>& rOutputEncoder,
                const TensorInfo& inputInfo,
                const TensorInfo& outputInfo,
-               const Pooling2dDescriptor& params)
+               const Pooling2dDescriptor& params,
+               unsigned int firstRow,
+               unsigned int lastRow)
 {
     const DataLayoutIndexed dataLayout(params.m_DataLayout);
     auto channelsIndex = dataLayout.GetChannelsIndex();
     auto heightIndex = dataLayout.GetHeightIndex();
     auto widthIndex = dataLayout.GetWidthIndex();
 
-    const int batchSize    = boost::numeric_cast<int>(outputInfo.GetShape()[0]);
     const int channels     = boost::numeric_cast<int>(outputInfo.GetShape()[channelsIndex]);
     const int heightOutput = boost::numeric_cast<int>(outputInfo.GetShape()[heightIndex]);
     const int widthOutput  = boost::numeric_cast<int>(outputInfo.GetShape()[widthIndex]);
@@ -182,92 +183,90 @@ void Pooling2d(Decoder<float>& rInputDecoder,
         throw armnn::InvalidArgumentException("Unsupported padding type");
     }
 
-    for (int n = 0; n < batchSize; n++)
+    for (int row = boost::numeric_cast<int>(firstRow); row < boost::numeric_cast<int>(lastRow); row++)
     {
-        for (int c = 0; c < channels; c++)
-        {
-            for (int yOutput = 0; yOutput < heightOutput; yOutput++)
-            {
-                //  Calculate values independent of the x axis
-                int hstart = (yOutput * strideY) - padTop;
-                int hend = hstart + poolHeight;
-                // Clamp the pooling region inside the valid input area (which includes the padding).
-                // This is necessary because the final pooling in a row may overlap beyond the padding.
-                hend = std::min(hend, heightInput + padBottom);
+        const int n       = row / (channels * heightOutput);
+        const int c       = (row / heightOutput) % channels;
+        const int yOutput = row % heightOutput;
 
-                int height = hend - hstart;
-                bool hclamped = ClampRange(hstart, hend, heightInput);
+        //  Calculate values independent of the x axis
+        int hstart = (yOutput * strideY) - padTop;
+        int hend = hstart + poolHeight;
+        // Clamp the pooling region inside the valid input area (which includes the padding).
+        // This is necessary because the final pooling in a row may overlap beyond the padding.
+        hend = std::min(hend, heightInput + padBottom);
 
-                for (int xOutput = 0; xOutput < widthOutput; xOutput++)
-                {
-                    int wstart = (xOutput * strideX) - padLeft;
-                    int wend = wstart + poolWidth;
-
-                    // Clamp the pooling region inside the valid input area (which includes the padding).
-                    // This is necessary because the final pooling in a row may overlap beyond the padding.
-                    wend = std::min(wend, widthInput + padRight);
-
-                    float result = defaultInitializer;
-                    float poolAreaSize = boost::numeric_cast<float>(height * (wend - wstart));
-
-                    // Special case: when the pooling kernel is over a padding region and the padding
-                    //               size is larger or equal to the kernel and the kernel only covers
-                    //               padding and no real values, then we initialize the result as zero
-                    //               by convention. This is because we need to choose a value here and
-                    //               all values we have are padding, which we ignore.
-                    if (OnPaddingOnly(hstart, hend, heightInput) ||
-                        OnPaddingOnly(wstart, wend, widthInput))
-                    {
-                        result = 0.0f;
-
-                        unsigned int outputIndex = dataLayout.GetIndex(outputShape,
-                                                                       boost::numeric_cast<unsigned int>(n),
-                                                                       boost::numeric_cast<unsigned int>(c),
-                                                                       boost::numeric_cast<unsigned int>(yOutput),
-                                                                       boost::numeric_cast<unsigned int>(xOutput));
-                        rOutputEncoder[outputIndex];
-                        rOutputEncoder.Set(result);
-                        continue;
-                    }
+        int height = hend - hstart;
+        bool hclamped = ClampRange(hstart, hend, heightInput);
 
-                    bool clamped = hclamped |= ClampRange(wstart, wend, widthInput);
+        for (int xOutput = 0; xOutput < widthOutput; xOutput++)
+        {
+            int wstart = (xOutput * strideX) - padLeft;
+            int wend = wstart + poolWidth;
+
+            // Clamp the pooling region inside the valid input area (which includes the padding).
+            // This is necessary because the final pooling in a row may overlap beyond the padding.
+            wend = std::min(wend, widthInput + padRight);
+
+            float result = defaultInitializer;
+            float poolAreaSize = boost::numeric_cast<float>(height * (wend - wstart));
+
+            // Special case: when the pooling kernel is over a padding region and the padding
+            //               size is larger or equal to the kernel and the kernel only covers
+            //               padding and no real values, then we initialize the result as zero
+            //               by convention. This is because we need to choose a value here and
+            //               all values we have are padding, which we ignore.
+            if (OnPaddingOnly(hstart, hend, heightInput) ||
+                OnPaddingOnly(wstart, wend, widthInput))
+            {
+                result = 0.0f;
+
+                unsigned int outputIndex = dataLayout.GetIndex(outputShape,
+                                                               boost::numeric_cast<unsigned int>(n),
+                                                               boost::numeric_cast<unsigned int>(c),
+                                                               boost::numeric_cast<unsigned int>(yOutput),
+                                                               boost::numeric_cast<unsigned int>(xOutput));
+                rOutputEncoder[outputIndex];
+                rOutputEncoder.Set(result);
+                continue;
+            }
 
-                    if (clamped && params.m_PaddingMethod == PaddingMethod::Exclude)
-                    {
-                        // When we exclude the padding, it means we calculate with a smaller
-                        // kernel size, so I changed the divisor here.
-                        poolAreaSize = boost::numeric_cast<float>((hend - hstart) * (wend - wstart));
-                    }
+            bool clamped = hclamped |= ClampRange(wstart, wend, widthInput);
 
-                    for (auto yInput = hstart; yInput < hend; yInput++)
-                    {
-                        for (auto xInput = wstart; xInput < wend; xInput++)
-                        {
-                            unsigned int inputIndex = dataLayout.GetIndex(inputShape,
-                                                                          boost::numeric_cast<unsigned int>(n),
-                                                                          boost::numeric_cast<unsigned int>(c),
-                                                                          boost::numeric_cast<unsigned int>(yInput),
-                                                                          boost::numeric_cast<unsigned int>(xInput));
-
-                            rInputDecoder[inputIndex];
-                            float inval = rInputDecoder.Get();
-
-                            accumulate(result, inval);
-                        }
-                    }
+            if (clamped && params.m_PaddingMethod == PaddingMethod::Exclude)
+            {
+                // When we exclude the padding, it means we calculate with a smaller
+                // kernel size, so I changed the divisor here.
+                poolAreaSize = boost::numeric_cast<float>((hend - hstart) * (wend - wstart));
+            }
 
-                    execute(result, poolAreaSize);
+            for (auto yInput = hstart; yInput < hend; yInput++)
+            {
+                for (auto xInput = wstart; xInput < wend; xInput++)
+                {
+                    unsigned int inputIndex = dataLayout.GetIndex(inputShape,
+                                                                  boost::numeric_cast<unsigned int>(n),
+                                                                  boost::numeric_cast<unsigned int>(c),
+                                                                  boost::numeric_cast<unsigned int>(yInput),
+                                                                  boost::numeric_cast<unsigned int>(xInput));
 
-                    unsigned int outputIndex = dataLayout.GetIndex(outputShape,
-                                                                   boost::numeric_cast<unsigned int>(n),
-                                                                   boost::numeric_cast<unsigned int>(c),
-                                                                   boost::numeric_cast<unsigned int>(yOutput),
-                                                                   boost::numeric_cast<unsigned int>(xOutput));
+                    rInputDecoder[inputIndex];
+                    float inval = rInputDecoder.Get();
 
-                    rOutputEncoder[outputIndex];
-                    rOutputEncoder.Set(result);
+                    accumulate(result, inval);
                 }
             }
+
+            execute(result, poolAreaSize);
+
+            unsigned int outputIndex = dataLayout.GetIndex(outputShape,
+                                                           boost::numeric_cast<unsigned int>(n),
+                                                           boost::numeric_cast<unsigned int>(c),
+                                                           boost::numeric_cast<unsigned int>(yOutput),
+                                                           boost::numeric_cast<unsigned int>(xOutput));
+
+            rOutputEncoder[outputIndex];
+            rOutputEncoder.Set(result);
         }
     }
 }
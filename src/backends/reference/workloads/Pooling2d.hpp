@@ -13,9 +13,14 @@
 namespace armnn
 {
 /// Computes the Pooling2d operation.
+/// Computes the output rows [firstRow, lastRow), where a row holds the outputs of one batch, channel and output
+/// y coordinate, numbered batch by batch, then channel by channel. Rows don't depend on each other, so disjoint ranges
+/// can be computed concurrently as long as each range has its own decoder and encoder.
 void Pooling2d(Decoder<float>& rInputDecoder,
                Encoder<float>& rOutputEncoder,
                const TensorInfo& inputInfo,
                const TensorInfo& outputInfo,
-               const Pooling2dDescriptor& params);
+               const Pooling2dDescriptor& params,
+               unsigned int firstRow,
+               unsigned int lastRow);
 } //namespace armnn
@@ -42,4 +42,13 @@ void RefBatchNormalizationWorkload::Execute() const
     BatchNormImpl(m_Data, *meanDecoder, *varianceDecoder, *betaDecoder, *gammaDecoder, *inputDecoder, *outputEncoder);
 }
 
+void RefBatchNormalizationWorkload::ShareConstantTensors(
+    const std::function<void(ScopedCpuTensorHandle&)>& shareTensor)
+{
+    shareTensor(*m_Mean);
+    shareTensor(*m_Variance);
+    shareTensor(*m_Beta);
+    shareTensor(*m_Gamma);
+}
+
 } // namespace armnn
@@ -18,6 +18,8 @@ public:
                                            const WorkloadInfo& info);
     virtual void Execute() const override;
 
+    void ShareConstantTensors(const std::function<void(ScopedCpuTensorHandle&)>& shareTensor) override;
+
 private:
     std::unique_ptr<ScopedCpuTensorHandle> m_Mean;
     std::unique_ptr<ScopedCpuTensorHandle> m_Variance;
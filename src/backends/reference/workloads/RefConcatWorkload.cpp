@@ -9,12 +9,24 @@
 
 #include "Profiling.hpp"
 
+#include <algorithm>
+
 namespace armnn
 {
 
 void RefConcatWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConcatWorkload_Execute");
+
+    // When the inputs are sub-tensors of the output (see ConcatLayer::CreateTensors()), the layers producing them
+    // have already written them in place.
+    const ITensorHandle* output = m_Data.m_Outputs[0];
+    if (std::all_of(m_Data.m_Inputs.begin(), m_Data.m_Inputs.end(),
+                    [output](const ITensorHandle* input) { return input->GetParent() == output; }))
+    {
+        return;
+    }
+
     Concatenate(m_Data);
 }
 
@@ -38,4 +38,16 @@ void RefConstantWorkload::Execute() const
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConstantWorkload_Execute");
 }
 
+void RefConstantWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConstantWorkload_Execute_WorkingMemDescriptor");
+
+    // The output handle is not the one filled in PostAllocationConfigure(), so the constant is copied every time.
+    const TensorInfo& outputInfo = GetTensorInfo(workingMemDescriptor.m_Outputs[0]);
+    ARMNN_ASSERT(m_Data.m_LayerOutput->GetTensorInfo().GetNumBytes() == outputInfo.GetNumBytes());
+
+    memcpy(GetOutputTensorData<void>(0, workingMemDescriptor), m_Data.m_LayerOutput->GetConstTensor<void>(),
+        outputInfo.GetNumBytes());
+}
+
 } //namespace armnn
@@ -21,6 +21,7 @@ public:
 
     void PostAllocationConfigure() override;
     virtual void Execute() const override;
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
 };
 
 } //namespace armnn
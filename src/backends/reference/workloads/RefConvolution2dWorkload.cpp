@@ -6,52 +6,159 @@
 #include "RefConvolution2dWorkload.hpp"
 
 #include "ConvImpl.hpp"
+#include "GemmConvolution.hpp"
 #include "RefWorkloadUtils.hpp"
 
 #include "Profiling.hpp"
 
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
 namespace armnn
 {
 RefConvolution2dWorkload::RefConvolution2dWorkload(
-        const Convolution2dQueueDescriptor& descriptor, const WorkloadInfo& info)
-        : BaseWorkload<Convolution2dQueueDescriptor>(descriptor, info)
+        const Convolution2dQueueDescriptor& descriptor, const WorkloadInfo& info,
+        std::shared_ptr<RefThreadPool> threadPool)
+        : BaseWorkload<Convolution2dQueueDescriptor>(descriptor, info),
+          m_IsWeightPacked(false),
+          m_WeightInfo(descriptor.m_Weight->GetTensorInfo()),
+          m_FilterShape(m_WeightInfo.GetShape()),
+          m_ThreadPool(std::move(threadPool))
 {
-    m_Weight = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight));
-    const TensorInfo& rFilterInfo = m_Weight->GetTensorInfo();
-
-    m_FilterShape = rFilterInfo.GetShape();
-    m_FilterDecoder = MakeDecoder<float>(rFilterInfo, m_Weight.get()->Map(true));
-
     if (descriptor.m_Parameters.m_BiasEnabled)
     {
         m_Bias = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias));
-        const TensorInfo& biasInfo = m_Bias->GetTensorInfo();
-        m_BiasDecoder = MakeDecoder<float>(biasInfo, m_Bias->Map(true));
+    }
+
+    // Workloads created without weight data keep the generic path, the GEMM path needing the weights packed.
+    if (descriptor.m_Weight->GetConstTensor<void>() != nullptr &&
+        IsGemmConvolutionSupported(info.m_InputTensorInfos[0], m_WeightInfo, info.m_OutputTensorInfos[0],
+                                   m_Bias ? &m_Bias->GetTensorInfo() : nullptr))
+    {
+        std::vector<float> packedWeight;
+        m_Weight = std::make_unique<ScopedCpuTensorHandle>(
+            PackWeight(ConstTensor(m_WeightInfo, descriptor.m_Weight->GetConstTensor<void>()), packedWeight));
+        m_IsWeightPacked = true;
+    }
+    else
+    {
+        m_Weight = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight));
     }
 }
 
-void RefConvolution2dWorkload::PostAllocationConfigure()
+ConstTensor RefConvolution2dWorkload::PackWeight(const ConstTensor& weight, std::vector<float>& packedWeight) const
 {
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    m_InputShape = inputInfo.GetShape();
-    m_InputDecoder = MakeDecoder<float>(inputInfo);
+    packedWeight = PackGemmConvolutionFilter(m_FilterShape, static_cast<const float*>(weight.GetMemoryArea()),
+                                             m_Data.m_Parameters.m_DataLayout);
+    const TensorInfo packedInfo({ static_cast<unsigned int>(packedWeight.size()) }, DataType::Float32);
+    return ConstTensor(packedInfo, packedWeight.data());
+}
 
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    m_OutputShape = outputInfo.GetShape();
-    m_OutputEncoder = MakeEncoder<float>(outputInfo);
+void RefConvolution2dWorkload::PostAllocationConfigure()
+{
+    m_InputShape = GetTensorInfo(m_Data.m_Inputs[0]).GetShape();
+    m_OutputShape = GetTensorInfo(m_Data.m_Outputs[0]).GetShape();
 }
 
 void RefConvolution2dWorkload::Execute() const {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConvolution2dWorkload_Execute");
 
-    m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
-    m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
+    Compute(m_Data.m_Inputs[0], m_Data.m_Outputs[0]);
+}
+
+void RefConvolution2dWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefConvolution2dWorkload_Execute_WorkingMemDescriptor");
+
+    Compute(workingMemDescriptor.m_Inputs[0], workingMemDescriptor.m_Outputs[0]);
+}
+
+void RefConvolution2dWorkload::Compute(const ITensorHandle* input, ITensorHandle* output) const
+{
+    if (m_IsWeightPacked)
+    {
+        ComputeGemm(input, output);
+        return;
+    }
+
+    const TensorInfo& inputInfo  = GetTensorInfo(input);
+    const TensorInfo& outputInfo = GetTensorInfo(output);
+    const void* inputData = input->Map();
+    void* outputData      = output->Map();
 
-    Convolve(m_InputShape, *m_InputDecoder, m_OutputShape, *m_OutputEncoder, m_FilterShape,
-             *m_FilterDecoder, m_Data.m_Parameters.m_BiasEnabled, m_BiasDecoder.get(),
-             m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
-             m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
-             m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY);
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Data.m_Parameters.m_DataLayout);
+    const unsigned int outputWidth = m_OutputShape[dataLayout.GetWidthIndex()];
+    const unsigned int numRows     = m_OutputShape.GetNumElements() / outputWidth;
+    const unsigned int rowCost     = outputWidth * m_FilterShape.GetNumElements() / m_FilterShape[0];
+
+    // Decoders and encoders carry iteration state, so each range of rows gets its own set.
+    m_ThreadPool->ParallelFor(numRows, rowCost, [&](unsigned int firstRow, unsigned int lastRow)
+    {
+        std::unique_ptr<Decoder<float>> biasDecoder;
+        if (m_Data.m_Parameters.m_BiasEnabled)
+        {
+            biasDecoder = MakeDecoder<float>(m_Bias->GetTensorInfo(), m_Bias->Map(true));
+        }
+
+        VisitDirectIterators(inputInfo, inputData, m_Weight->GetTensorInfo(), m_Weight->Map(true),
+                             outputInfo, outputData,
+                             [&](auto& inputDecoder, auto& filterDecoder, auto& outputEncoder)
+        {
+            Convolve(m_InputShape, inputDecoder, m_OutputShape, outputEncoder, m_FilterShape,
+                     filterDecoder, m_Data.m_Parameters.m_BiasEnabled, biasDecoder.get(),
+                     m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                     m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                     m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY,
+                     false, firstRow, lastRow);
+        });
+    });
+}
+
+void RefConvolution2dWorkload::ComputeGemm(const ITensorHandle* input, ITensorHandle* output) const
+{
+    const float* inputData    = reinterpret_cast<const float*>(input->Map());
+    float* outputData         = reinterpret_cast<float*>(output->Map());
+    const float* packedWeight = m_Weight->GetConstTensor<float>();
+    const float* biasData     = m_Bias ? m_Bias->GetConstTensor<float>() : nullptr;
+
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Data.m_Parameters.m_DataLayout);
+    const unsigned int numPixels = m_OutputShape.GetNumElements() / m_OutputShape[dataLayout.GetChannelsIndex()];
+    const unsigned int pixelCost = m_FilterShape.GetNumElements();
+
+    m_ThreadPool->ParallelFor(numPixels, pixelCost, [&](unsigned int firstPixel, unsigned int lastPixel)
+    {
+        GemmConvolve(m_InputShape, inputData, m_OutputShape, outputData, m_FilterShape, packedWeight, biasData,
+                     m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                     m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                     m_Data.m_Parameters.m_DilationX, m_Data.m_Parameters.m_DilationY,
+                     firstPixel, lastPixel);
+    });
+}
+
+bool RefConvolution2dWorkload::UpdateWeights(const ConstTensor& weights, const Optional<ConstTensor>& biases)
+{
+    if (!m_IsWeightPacked)
+    {
+        ScopedCpuTensorHandle::UpdateWeightsAndBiases(*m_Weight, m_Bias.get(), weights, biases);
+        return true;
+    }
+
+    if (weights.GetInfo() != m_WeightInfo)
+    {
+        throw InvalidArgumentException("The new weights don't match the shape, data type or quantization "
+                                       "of the weights they replace");
+    }
+    std::vector<float> packedWeight;
+    ScopedCpuTensorHandle::UpdateWeightsAndBiases(*m_Weight, m_Bias.get(), PackWeight(weights, packedWeight), biases);
+    return true;
+}
+
+void RefConvolution2dWorkload::ShareConstantTensors(const std::function<void(ScopedCpuTensorHandle&)>& shareTensor)
+{
+    shareTensor(*m_Weight);
+    if (m_Bias)
+    {
+        shareTensor(*m_Bias);
+    }
 }
 
 } //namespace armnn
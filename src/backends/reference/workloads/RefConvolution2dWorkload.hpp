@@ -10,31 +10,55 @@
 #include "Decoders.hpp"
 #include "Encoders.hpp"
 
+#include <reference/RefThreadPool.hpp>
+
+#include <memory>
+#include <vector>
+
 namespace armnn
 {
 
 class RefConvolution2dWorkload : public BaseWorkload<Convolution2dQueueDescriptor>
 {
 public:
-    explicit RefConvolution2dWorkload(const Convolution2dQueueDescriptor& descriptor,
-                                      const WorkloadInfo& info);
+    RefConvolution2dWorkload(const Convolution2dQueueDescriptor& descriptor,
+                             const WorkloadInfo& info,
+                             std::shared_ptr<RefThreadPool> threadPool);
 
     void PostAllocationConfigure() override;
 
     virtual void Execute() const override;
 
+    bool UpdateWeights(const ConstTensor& weights, const Optional<ConstTensor>& biases) override;
+
+    void ShareConstantTensors(const std::function<void(ScopedCpuTensorHandle&)>& shareTensor) override;
+
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
 private:
+    /// Splits the rows of the output between the threads of m_ThreadPool.
+    void Compute(const ITensorHandle* input, ITensorHandle* output) const;
+
+    /// Splits the pixels of the output between the threads of m_ThreadPool, for GemmConvolve().
+    void ComputeGemm(const ITensorHandle* input, ITensorHandle* output) const;
+
+    /// Packs the weights for GemmConvolve().
+    ConstTensor PackWeight(const ConstTensor& weight, std::vector<float>& packedWeight) const;
+
+    /// The weights, or when the tensors of the workload allow GemmConvolve() only the weights packed for it, so that
+    /// the workload doesn't hold two copies of them and identical packed weights are shared like any other.
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
 
-    std::unique_ptr<Decoder<float>> m_InputDecoder;
-    std::unique_ptr<Encoder<float>> m_OutputEncoder;
-    std::unique_ptr<Decoder<float>> m_FilterDecoder;
-    std::unique_ptr<Decoder<float>> m_BiasDecoder;
+    /// Whether m_Weight holds the packed weights, whose TensorInfo is then m_WeightInfo.
+    bool m_IsWeightPacked;
+    TensorInfo m_WeightInfo;
 
     TensorShape m_InputShape;
     TensorShape m_OutputShape;
     TensorShape m_FilterShape;
+
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 } //namespace armnn
@@ -12,51 +12,83 @@
 #include "Profiling.hpp"
 #include <ResolveType.hpp>
 
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
 namespace armnn
 {
 
 RefDepthwiseConvolution2dWorkload::RefDepthwiseConvolution2dWorkload(
-        const DepthwiseConvolution2dQueueDescriptor& descriptor, const WorkloadInfo& info)
-        : BaseWorkload<DepthwiseConvolution2dQueueDescriptor>(descriptor, info)
+        const DepthwiseConvolution2dQueueDescriptor& descriptor, const WorkloadInfo& info,
+        std::shared_ptr<RefThreadPool> threadPool)
+        : BaseWorkload<DepthwiseConvolution2dQueueDescriptor>(descriptor, info),
+          m_ThreadPool(std::move(threadPool))
 {
     m_Weight = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight));
-    const TensorInfo& rFilterInfo = m_Weight->GetTensorInfo();
-    m_FilterShape = rFilterInfo.GetShape();
-    m_FilterDecoder = MakeDecoder<float>(rFilterInfo, m_Weight->Map(true));
+    m_FilterShape = m_Weight->GetTensorInfo().GetShape();
 
     if (descriptor.m_Parameters.m_BiasEnabled)
     {
         m_Bias = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias));
-        const TensorInfo& biasInfo = m_Bias->GetTensorInfo();
-        m_BiasDecoder = MakeDecoder<float>(biasInfo, m_Bias->Map(true));
     }
 }
 
 void RefDepthwiseConvolution2dWorkload::PostAllocationConfigure()
 {
-    const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-    m_InputShape = inputInfo.GetShape();
-    m_InputDecoder = MakeDecoder<float>(inputInfo);
-
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    m_OutputShape = outputInfo.GetShape();
-    m_OutputEncoder = MakeEncoder<float>(outputInfo);
+    m_InputShape = GetTensorInfo(m_Data.m_Inputs[0]).GetShape();
+    m_OutputShape = GetTensorInfo(m_Data.m_Outputs[0]).GetShape();
 }
 
 void RefDepthwiseConvolution2dWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefDepthwiseConvolution2dWorkload_Execute");
-    std::unique_ptr<Decoder<float>> pBiasDecoder{};
 
-    m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
-    m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
+    const TensorInfo& inputInfo  = GetTensorInfo(m_Data.m_Inputs[0]);
+    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const void* inputData = m_Data.m_Inputs[0]->Map();
+    void* outputData      = m_Data.m_Outputs[0]->Map();
+
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Data.m_Parameters.m_DataLayout);
+    const unsigned int outputWidth = m_OutputShape[dataLayout.GetWidthIndex()];
+    const unsigned int numRows     = m_OutputShape.GetNumElements() / outputWidth;
+    const unsigned int rowCost     = outputWidth * m_FilterShape[2] * m_FilterShape[3];
+
+    // Decoders and encoders carry iteration state, so each range of rows gets its own set.
+    m_ThreadPool->ParallelFor(numRows, rowCost, [&](unsigned int firstRow, unsigned int lastRow)
+    {
+        std::unique_ptr<Decoder<float>> biasDecoder;
+        if (m_Data.m_Parameters.m_BiasEnabled)
+        {
+            biasDecoder = MakeDecoder<float>(m_Bias->GetTensorInfo(), m_Bias->Map(true));
+        }
 
-    Convolve(m_InputShape, *m_InputDecoder, m_OutputShape, *m_OutputEncoder,
-             m_FilterShape, *m_FilterDecoder, m_Data.m_Parameters.m_BiasEnabled, m_BiasDecoder.get(),
-             m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
-             m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
-             m_Data.m_Parameters.m_DilationX,
-             m_Data.m_Parameters.m_DilationY, true);
+        VisitDirectIterators(inputInfo, inputData, m_Weight->GetTensorInfo(), m_Weight->Map(true),
+                             outputInfo, outputData,
+                             [&](auto& inputDecoder, auto& filterDecoder, auto& outputEncoder)
+        {
+            Convolve(m_InputShape, inputDecoder, m_OutputShape, outputEncoder,
+                     m_FilterShape, filterDecoder, m_Data.m_Parameters.m_BiasEnabled, biasDecoder.get(),
+                     m_Data.m_Parameters.m_DataLayout, m_Data.m_Parameters.m_PadTop, m_Data.m_Parameters.m_PadLeft,
+                     m_Data.m_Parameters.m_StrideX, m_Data.m_Parameters.m_StrideY,
+                     m_Data.m_Parameters.m_DilationX,
+                     m_Data.m_Parameters.m_DilationY, true, firstRow, lastRow);
+        });
+    });
+}
+
+bool RefDepthwiseConvolution2dWorkload::UpdateWeights(const ConstTensor& weights, const Optional<ConstTensor>& biases)
+{
+    ScopedCpuTensorHandle::UpdateWeightsAndBiases(*m_Weight, m_Bias.get(), weights, biases);
+    return true;
+}
+
+void RefDepthwiseConvolution2dWorkload::ShareConstantTensors(
+    const std::function<void(ScopedCpuTensorHandle&)>& shareTensor)
+{
+    shareTensor(*m_Weight);
+    if (m_Bias)
+    {
+        shareTensor(*m_Bias);
+    }
 }
 
 } //namespace armnn
@@ -8,32 +8,37 @@
 #include "Encoders.hpp"
 
 #include <armnn/TypesUtils.hpp>
+#include <reference/RefThreadPool.hpp>
+
+#include <memory>
 
 namespace armnn
 {
 
 class RefDepthwiseConvolution2dWorkload : public BaseWorkload<DepthwiseConvolution2dQueueDescriptor> {
 public:
-    explicit RefDepthwiseConvolution2dWorkload(const DepthwiseConvolution2dQueueDescriptor &descriptor,
-                                               const WorkloadInfo &info);
+    RefDepthwiseConvolution2dWorkload(const DepthwiseConvolution2dQueueDescriptor &descriptor,
+                                      const WorkloadInfo &info,
+                                      std::shared_ptr<RefThreadPool> threadPool);
 
     void PostAllocationConfigure() override;
 
     virtual void Execute() const override;
 
+    bool UpdateWeights(const ConstTensor& weights, const Optional<ConstTensor>& biases) override;
+
+    void ShareConstantTensors(const std::function<void(ScopedCpuTensorHandle&)>& shareTensor) override;
+
 private:
 
     std::unique_ptr <ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr <ScopedCpuTensorHandle> m_Bias;
 
-    std::unique_ptr <Decoder<float>> m_InputDecoder;
-    std::unique_ptr <Encoder<float>> m_OutputEncoder;
-    std::unique_ptr <Decoder<float>> m_FilterDecoder;
-    std::unique_ptr <Decoder<float>> m_BiasDecoder;
-
     TensorShape m_InputShape;
     TensorShape m_OutputShape;
     TensorShape m_FilterShape;
+
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 } //namespace armnn
@@ -5,36 +5,76 @@
 
 #include "RefElementwiseWorkload.hpp"
 
-#include "Decoders.hpp"
+#include "DirectIterators.hpp"
 #include "ElementwiseFunction.hpp"
-#include "Encoders.hpp"
 #include "Profiling.hpp"
 #include "RefWorkloadUtils.hpp"
 #include "StringMapping.hpp"
 #include <ResolveType.hpp>
+#include <type_traits>
 #include <vector>
 
 namespace armnn
 {
 
-template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
-RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::RefElementwiseWorkload(
-    const ParentDescriptor& desc,
-    const WorkloadInfo& info)
-    : BaseWorkload<ParentDescriptor>(desc, info)
+namespace
+{
+
+/// Computes the rows [firstRow, lastRow) of a float functor, through direct iterators when the tensors allow it.
+template <typename Functor>
+void ComputeRows(const TensorInfo& inputInfo0, const void* inputData0,
+                 const TensorInfo& inputInfo1, const void* inputData1,
+                 const TensorInfo& outputInfo, void* outputData,
+                 unsigned int firstRow, unsigned int lastRow, std::true_type)
 {
+    VisitDirectIterators(inputInfo0, inputData0, inputInfo1, inputData1, outputInfo, outputData,
+                         [&](auto& input0, auto& input1, auto& output)
+    {
+        ElementwiseBinaryFunction<Functor>(inputInfo0.GetShape(),
+                                           inputInfo1.GetShape(),
+                                           outputInfo.GetShape(),
+                                           input0,
+                                           input1,
+                                           output,
+                                           firstRow,
+                                           lastRow);
+    });
 }
 
-template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
-void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::PostAllocationConfigure()
+/// Computes the rows [firstRow, lastRow) of any other functor, through its Decoder and Encoder.
+template <typename Functor>
+void ComputeRows(const TensorInfo& inputInfo0, const void* inputData0,
+                 const TensorInfo& inputInfo1, const void* inputData1,
+                 const TensorInfo& outputInfo, void* outputData,
+                 unsigned int firstRow, unsigned int lastRow, std::false_type)
 {
-    const TensorInfo& inputInfo0 = GetTensorInfo(m_Data.m_Inputs[0]);
-    const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    using InType = typename ElementwiseBinaryFunction<Functor>::InType;
+    using OutType = typename ElementwiseBinaryFunction<Functor>::OutType;
+
+    std::unique_ptr<Decoder<InType>> input0 = MakeDecoder<InType>(inputInfo0, inputData0);
+    std::unique_ptr<Decoder<InType>> input1 = MakeDecoder<InType>(inputInfo1, inputData1);
+    std::unique_ptr<Encoder<OutType>> output = MakeEncoder<OutType>(outputInfo, outputData);
+
+    ElementwiseBinaryFunction<Functor>(inputInfo0.GetShape(),
+                                       inputInfo1.GetShape(),
+                                       outputInfo.GetShape(),
+                                       *input0,
+                                       *input1,
+                                       *output,
+                                       firstRow,
+                                       lastRow);
+}
 
-    m_Input0 = MakeDecoder<InType>(inputInfo0);
-    m_Input1 = MakeDecoder<InType>(inputInfo1);
-    m_Output = MakeEncoder<OutType>(outputInfo);
+} // anonymous namespace
+
+template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
+RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::RefElementwiseWorkload(
+    const ParentDescriptor& desc,
+    const WorkloadInfo& info,
+    std::shared_ptr<RefThreadPool> threadPool)
+    : BaseWorkload<ParentDescriptor>(desc, info),
+      m_ThreadPool(std::move(threadPool))
+{
 }
 
 template <typename Functor, typename ParentDescriptor, typename armnn::StringMapping::Id DebugString>
@@ -45,20 +85,23 @@ void RefElementwiseWorkload<Functor, ParentDescriptor, DebugString>::Execute() c
     const TensorInfo& inputInfo1 = GetTensorInfo(m_Data.m_Inputs[1]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
 
-    const TensorShape& inShape0 = inputInfo0.GetShape();
-    const TensorShape& inShape1 = inputInfo1.GetShape();
     const TensorShape& outShape = outputInfo.GetShape();
 
-    m_Input0->Reset(m_Data.m_Inputs[0]->Map());
-    m_Input1->Reset(m_Data.m_Inputs[1]->Map());
-    m_Output->Reset(m_Data.m_Outputs[0]->Map());
-
-    ElementwiseBinaryFunction<Functor>(inShape0,
-                                       inShape1,
-                                       outShape,
-                                       *m_Input0,
-                                       *m_Input1,
-                                       *m_Output);
+    const void* inputData0 = m_Data.m_Inputs[0]->Map();
+    const void* inputData1 = m_Data.m_Inputs[1]->Map();
+    void* outputData       = m_Data.m_Outputs[0]->Map();
+
+    const unsigned int rowLength = outShape.GetNumDimensions() > 0 ? outShape[outShape.GetNumDimensions() - 1] : 1;
+    const unsigned int numRows   = outShape.GetNumElements() / rowLength;
+
+    // Decoders and encoders carry iteration state, so each range of rows gets its own set.
+    m_ThreadPool->ParallelFor(numRows, rowLength, [&](unsigned int firstRow, unsigned int lastRow)
+    {
+        using IsFloatFunctor = std::integral_constant<bool, std::is_same<InType, float>::value &&
+                                                            std::is_same<OutType, float>::value>;
+        ComputeRows<Functor>(inputInfo0, inputData0, inputInfo1, inputData1, outputInfo, outputData,
+                             firstRow, lastRow, IsFloatFunctor());
+    });
 }
 
 } //namespace armnn
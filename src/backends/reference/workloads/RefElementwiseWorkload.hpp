@@ -14,6 +14,10 @@
 #include "Minimum.hpp"
 #include "StringMapping.hpp"
 
+#include <reference/RefThreadPool.hpp>
+
+#include <memory>
+
 namespace armnn
 {
 
@@ -25,14 +29,13 @@ public:
     using OutType = typename ElementwiseBinaryFunction<Functor>::OutType;
     using BaseWorkload<ParentDescriptor>::m_Data;
 
-    RefElementwiseWorkload(const ParentDescriptor& descriptor, const WorkloadInfo& info);
-    void PostAllocationConfigure() override;
+    RefElementwiseWorkload(const ParentDescriptor& descriptor,
+                           const WorkloadInfo& info,
+                           std::shared_ptr<RefThreadPool> threadPool);
     void Execute() const override;
 
 private:
-    std::unique_ptr<Decoder<InType>> m_Input0;
-    std::unique_ptr<Decoder<InType>> m_Input1;
-    std::unique_ptr<Encoder<OutType>> m_Output;
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 template <typename DataType = float>
@@ -13,19 +13,17 @@
 namespace armnn
 {
 RefFullyConnectedWorkload::RefFullyConnectedWorkload(
-    const FullyConnectedQueueDescriptor& descriptor, const WorkloadInfo& info)
+    const FullyConnectedQueueDescriptor& descriptor, const WorkloadInfo& info,
+    std::shared_ptr<RefThreadPool> threadPool)
         : BaseWorkload<FullyConnectedQueueDescriptor>(descriptor, info),
-          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight)))
+          m_Weight(std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Weight))),
+          m_ThreadPool(std::move(threadPool))
 {
-    const TensorInfo& rWeightInfo = m_Weight->GetTensorInfo();
-    m_WeightShape = rWeightInfo.GetShape();
-    m_WeightDecoder = MakeDecoder<float>(rWeightInfo, m_Weight->Map(true));
+    m_WeightShape = m_Weight->GetTensorInfo().GetShape();
 
     if (descriptor.m_Parameters.m_BiasEnabled)
     {
         m_Bias = std::make_unique<ScopedCpuTensorHandle>(*(descriptor.m_Bias));
-        const TensorInfo& biasInfo = m_Bias->GetTensorInfo();
-        m_BiasDecoder = MakeDecoder<float>(biasInfo, m_Bias->Map(true));
     }
 }
 
@@ -34,11 +32,7 @@ void RefFullyConnectedWorkload::PostAllocationConfigure()
     const TensorInfo& inputInfo = GetTensorInfo(m_Data.m_Inputs[0]);
     ARMNN_ASSERT(inputInfo.GetNumDimensions() > 1);
     m_InputShape = inputInfo.GetShape();
-    m_InputDecoder = MakeDecoder<float>(inputInfo);
-
-    const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-    m_OutputShape = outputInfo.GetShape();
-    m_OutputEncoder = MakeEncoder<float>(outputInfo);
+    m_OutputShape = GetTensorInfo(m_Data.m_Outputs[0]).GetShape();
 
     m_NumActivations = 1; // Total number of activations in the input.
     for (unsigned int i = 1; i < inputInfo.GetNumDimensions(); i++)
@@ -51,18 +45,65 @@ void RefFullyConnectedWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFullyConnectedWorkload_Execute");
 
-    m_InputDecoder->Reset(m_Data.m_Inputs[0]->Map());
-    m_OutputEncoder->Reset(m_Data.m_Outputs[0]->Map());
-
-    FullyConnected(m_InputShape,
-                   *m_InputDecoder,
-                   m_OutputShape,
-                   *m_OutputEncoder,
-                   *m_WeightDecoder,
-                   *m_BiasDecoder,
-                   m_Data.m_Parameters.m_BiasEnabled,
-                   m_NumActivations,
-                   m_Data.m_Parameters.m_TransposeWeightMatrix);
+    Compute(m_Data.m_Inputs[0], m_Data.m_Outputs[0]);
+}
+
+void RefFullyConnectedWorkload::ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor)
+{
+    ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefFullyConnectedWorkload_Execute_WorkingMemDescriptor");
+
+    Compute(workingMemDescriptor.m_Inputs[0], workingMemDescriptor.m_Outputs[0]);
+}
+
+void RefFullyConnectedWorkload::Compute(const ITensorHandle* input, ITensorHandle* output) const
+{
+    const TensorInfo& inputInfo  = GetTensorInfo(input);
+    const TensorInfo& outputInfo = GetTensorInfo(output);
+    const void* inputData = input->Map();
+    void* outputData      = output->Map();
+
+    // Decoders and encoders carry iteration state, so each range of outputs gets its own set.
+    m_ThreadPool->ParallelFor(m_OutputShape.GetNumElements(), m_NumActivations,
+                              [&](unsigned int firstOutput, unsigned int lastOutput)
+    {
+        std::unique_ptr<Decoder<float>> biasDecoder;
+        if (m_Data.m_Parameters.m_BiasEnabled)
+        {
+            biasDecoder = MakeDecoder<float>(m_Bias->GetTensorInfo(), m_Bias->Map(true));
+        }
+
+        VisitDirectIterators(inputInfo, inputData, m_Weight->GetTensorInfo(), m_Weight->Map(true),
+                             outputInfo, outputData,
+                             [&](auto& inputDecoder, auto& weightDecoder, auto& outputEncoder)
+        {
+            FullyConnected(m_InputShape,
+                           inputDecoder,
+                           m_OutputShape,
+                           outputEncoder,
+                           weightDecoder,
+                           *biasDecoder,
+                           m_Data.m_Parameters.m_BiasEnabled,
+                           m_NumActivations,
+                           m_Data.m_Parameters.m_TransposeWeightMatrix,
+                           firstOutput,
+                           lastOutput);
+        });
+    });
+}
+
+bool RefFullyConnectedWorkload::UpdateWeights(const ConstTensor& weights, const Optional<ConstTensor>& biases)
+{
+    ScopedCpuTensorHandle::UpdateWeightsAndBiases(*m_Weight, m_Bias.get(), weights, biases);
+    return true;
+}
+
+void RefFullyConnectedWorkload::ShareConstantTensors(const std::function<void(ScopedCpuTensorHandle&)>& shareTensor)
+{
+    shareTensor(*m_Weight);
+    if (m_Bias)
+    {
+        shareTensor(*m_Bias);
+    }
 }
 
 } //namespace armnn
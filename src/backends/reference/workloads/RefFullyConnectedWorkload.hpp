@@ -11,6 +11,9 @@
 #include "Decoders.hpp"
 #include "Encoders.hpp"
 
+#include <reference/RefThreadPool.hpp>
+
+#include <memory>
 
 namespace armnn
 {
@@ -18,26 +21,33 @@ namespace armnn
 class RefFullyConnectedWorkload : public BaseWorkload<FullyConnectedQueueDescriptor>
 {
 public:
-    explicit RefFullyConnectedWorkload(const FullyConnectedQueueDescriptor& descriptor,
-                                       const WorkloadInfo& info);
+    RefFullyConnectedWorkload(const FullyConnectedQueueDescriptor& descriptor,
+                              const WorkloadInfo& info,
+                              std::shared_ptr<RefThreadPool> threadPool);
 
     void PostAllocationConfigure() override;
 
     virtual void Execute() const override;
 
+    bool UpdateWeights(const ConstTensor& weights, const Optional<ConstTensor>& biases) override;
+
+    void ShareConstantTensors(const std::function<void(ScopedCpuTensorHandle&)>& shareTensor) override;
+
+    void ExecuteAsync(WorkingMemDescriptor& workingMemDescriptor) override;
+
 private:
+    /// Splits the outputs between the threads of m_ThreadPool.
+    void Compute(const ITensorHandle* input, ITensorHandle* output) const;
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Weight;
     std::unique_ptr<ScopedCpuTensorHandle> m_Bias;
 
-    std::unique_ptr<Decoder<float>> m_InputDecoder;
-    std::unique_ptr<Encoder<float>> m_OutputEncoder;
-    std::unique_ptr<Decoder<float>> m_WeightDecoder;
-    std::unique_ptr<Decoder<float>> m_BiasDecoder;
-
     TensorShape m_InputShape;
     TensorShape m_OutputShape;
     TensorShape m_WeightShape;
     unsigned int m_NumActivations;
+
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 } //namespace armnn
@@ -11,22 +11,44 @@
 #include "Profiling.hpp"
 #include "BaseIterator.hpp"
 
+#include <armnnUtils/DataLayoutIndexed.hpp>
+
 namespace armnn
 {
+RefPooling2dWorkload::RefPooling2dWorkload(const Pooling2dQueueDescriptor& descriptor,
+                                           const WorkloadInfo& info,
+                                           std::shared_ptr<RefThreadPool> threadPool)
+    : BaseWorkload<Pooling2dQueueDescriptor>(descriptor, info),
+      m_ThreadPool(std::move(threadPool))
+{}
+
 void RefPooling2dWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefPooling2dWorkload_Execute");
 
     const TensorInfo& inputInfo  = GetTensorInfo(m_Data.m_Inputs[0]);
     const TensorInfo& outputInfo = GetTensorInfo(m_Data.m_Outputs[0]);
+    const void* inputData = m_Data.m_Inputs[0]->Map();
+    void* outputData      = m_Data.m_Outputs[0]->Map();
+
+    const armnnUtils::DataLayoutIndexed dataLayout(m_Data.m_Parameters.m_DataLayout);
+    const unsigned int outputWidth = outputInfo.GetShape()[dataLayout.GetWidthIndex()];
+    const unsigned int numRows     = outputInfo.GetNumElements() / outputWidth;
+    const unsigned int rowCost     = outputWidth * m_Data.m_Parameters.m_PoolWidth * m_Data.m_Parameters.m_PoolHeight;
 
-    auto inputDecoder  = MakeDecoder<float>(inputInfo,  m_Data.m_Inputs[0] ->Map());
-    auto outputEncoder = MakeEncoder<float>(outputInfo, m_Data.m_Outputs[0]->Map());
+    // Decoders and encoders carry iteration state, so each range of rows gets its own pair.
+    m_ThreadPool->ParallelFor(numRows, rowCost, [&](unsigned int firstRow, unsigned int lastRow)
+    {
+        auto inputDecoder  = MakeDecoder<float>(inputInfo,  inputData);
+        auto outputEncoder = MakeEncoder<float>(outputInfo, outputData);
 
-    Pooling2d(*inputDecoder,
-              *outputEncoder,
-              inputInfo,
-              outputInfo,
-              m_Data.m_Parameters);
+        Pooling2d(*inputDecoder,
+                  *outputEncoder,
+                  inputInfo,
+                  outputInfo,
+                  m_Data.m_Parameters,
+                  firstRow,
+                  lastRow);
+    });
 }
 } //namespace armnn
@@ -11,13 +11,22 @@
 #include "Decoders.hpp"
 #include "Encoders.hpp"
 
+#include <reference/RefThreadPool.hpp>
+
+#include <memory>
+
 namespace armnn
 {
 class RefPooling2dWorkload : public BaseWorkload<Pooling2dQueueDescriptor>
 {
 public:
-    using BaseWorkload<Pooling2dQueueDescriptor>::BaseWorkload;
+    RefPooling2dWorkload(const Pooling2dQueueDescriptor& descriptor,
+                         const WorkloadInfo& info,
+                         std::shared_ptr<RefThreadPool> threadPool);
 
     virtual void Execute() const override;
+
+private:
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 } //namespace armnn
@@ -5,36 +5,54 @@
 
 #include "RefSoftmaxWorkload.hpp"
 
-#include "Decoders.hpp"
-#include "Encoders.hpp"
+#include "DirectIterators.hpp"
 #include "RefWorkloadUtils.hpp"
 #include "Softmax.hpp"
 
 #include "Profiling.hpp"
 
+#include <armnnUtils/TensorUtils.hpp>
+
 #include <vector>
 
 namespace armnn
 {
 
+RefSoftmaxWorkload::RefSoftmaxWorkload(const SoftmaxQueueDescriptor& descriptor,
+                                       const WorkloadInfo& info,
+                                       std::shared_ptr<RefThreadPool> threadPool)
+    : BaseWorkload<SoftmaxQueueDescriptor>(descriptor, info),
+      m_ThreadPool(std::move(threadPool))
+{}
+
 void RefSoftmaxWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSoftmaxWorkload_Execute");
 
     const TensorInfo &inputTensorInfo = GetTensorInfo(m_Data.m_Inputs[0]);
-
-    std::unique_ptr<Decoder<float>> decoderPtr = MakeDecoder<float>(inputTensorInfo, m_Data.m_Inputs[0]->Map());
-    Decoder<float> &decoder = *decoderPtr;
-
     const TensorInfo &outputTensorInfo = GetTensorInfo(m_Data.m_Outputs[0]);
-
-    std::unique_ptr<Encoder<float>> encoderPtr = MakeEncoder<float>(outputTensorInfo, m_Data.m_Outputs[0]->Map());
-    Encoder<float> &encoder = *encoderPtr;
-
-    Softmax(decoder,
-            encoder,
-            inputTensorInfo,
-            m_Data.m_Parameters.m_Beta,
-            m_Data.m_Parameters.m_Axis);
+    const void* inputData = m_Data.m_Inputs[0]->Map();
+    void* outputData      = m_Data.m_Outputs[0]->Map();
+
+    const unsigned int axis = armnnUtils::GetUnsignedAxis(inputTensorInfo.GetNumDimensions(),
+                                                          m_Data.m_Parameters.m_Axis);
+    const unsigned int axisSize   = inputTensorInfo.GetShape()[axis];
+    const unsigned int numVectors = inputTensorInfo.GetNumElements() / axisSize;
+
+    // Decoders and encoders carry iteration state, so each range of vectors gets its own pair.
+    m_ThreadPool->ParallelFor(numVectors, 3 * axisSize, [&](unsigned int firstVector, unsigned int lastVector)
+    {
+        VisitDirectIterators(inputTensorInfo, inputData, outputTensorInfo, outputData,
+                             [&](auto& decoder, auto& encoder)
+        {
+            Softmax(decoder,
+                    encoder,
+                    inputTensorInfo,
+                    m_Data.m_Parameters.m_Beta,
+                    m_Data.m_Parameters.m_Axis,
+                    firstVector,
+                    lastVector);
+        });
+    });
 }
 } //namespace armnn
@@ -8,14 +8,24 @@
 #include <backendsCommon/Workload.hpp>
 #include <backendsCommon/WorkloadData.hpp>
 
+#include <reference/RefThreadPool.hpp>
+
+#include <memory>
+
 namespace armnn
 {
 
 class RefSoftmaxWorkload : public BaseWorkload<SoftmaxQueueDescriptor>
 {
 public:
-    using BaseWorkload<SoftmaxQueueDescriptor>::BaseWorkload;
+    RefSoftmaxWorkload(const SoftmaxQueueDescriptor& descriptor,
+                       const WorkloadInfo& info,
+                       std::shared_ptr<RefThreadPool> threadPool);
+
     virtual void Execute() const override;
+
+private:
+    std::shared_ptr<RefThreadPool> m_ThreadPool;
 };
 
 } //namespace armnn
@@ -8,12 +8,23 @@
 #include "RefWorkloadUtils.hpp"
 #include "Profiling.hpp"
 
+#include <algorithm>
+
 namespace armnn
 {
 
 void RefSplitterWorkload::Execute() const
 {
     ARMNN_SCOPED_PROFILING_EVENT(Compute::CpuRef, "RefSplitterWorkload_Execute");
+
+    // When the outputs are sub-tensors of the input (see SplitterLayer::CreateTensors()), there is nothing to copy.
+    const ITensorHandle* input = m_Data.m_Inputs[0];
+    if (std::all_of(m_Data.m_Outputs.begin(), m_Data.m_Outputs.end(),
+                    [input](const ITensorHandle* output) { return output->GetParent() == input; }))
+    {
+        return;
+    }
+
     Split(m_Data);
 }
 
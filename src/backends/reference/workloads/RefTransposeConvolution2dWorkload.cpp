@@ -67,4 +67,32 @@ void RefTransposeConvolution2dWorkload::Execute() const
                                m_BiasesDecoder.get());
 }
 
+bool RefTransposeConvolution2dWorkload::UpdateWeights(const ConstTensor& weights, const Optional<ConstTensor>& biases)
+{
+    ScopedCpuTensorHandle::UpdateWeightsAndBiases(*m_Weights, m_Biases.get(), weights, biases);
+    ResetConstantDecoders();
+    return true;
+}
+
+void RefTransposeConvolution2dWorkload::ShareConstantTensors(
+    const std::function<void(ScopedCpuTensorHandle&)>& shareTensor)
+{
+    shareTensor(*m_Weights);
+    if (m_Biases)
+    {
+        shareTensor(*m_Biases);
+    }
+    ResetConstantDecoders();
+}
+
+void RefTransposeConvolution2dWorkload::ResetConstantDecoders()
+{
+    // The decoders point at the memory of the constant tensors, which sharing or updating them may replace.
+    m_WeightsDecoder->Reset(m_Weights->GetTensor<void>());
+    if (m_Biases)
+    {
+        m_BiasesDecoder->Reset(m_Biases->GetTensor<void>());
+    }
+}
+
 } // namespace armnn
\ No newline at end of file
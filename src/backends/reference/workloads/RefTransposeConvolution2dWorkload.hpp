@@ -25,7 +25,13 @@ public:
 
     void Execute() const override;
 
+    bool UpdateWeights(const ConstTensor& weights, const Optional<ConstTensor>& biases) override;
+
+    void ShareConstantTensors(const std::function<void(ScopedCpuTensorHandle&)>& shareTensor) override;
+
 private:
+    void ResetConstantDecoders();
+
     std::unique_ptr<ScopedCpuTensorHandle> m_Weights;
     std::unique_ptr<ScopedCpuTensorHandle> m_Biases;
 
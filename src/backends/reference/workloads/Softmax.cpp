@@ -14,7 +14,14 @@ namespace armnn
 {
 
 /// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
-void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTensorInfo, float beta, int axis)
+template<typename DecoderType, typename EncoderType>
+void Softmax(DecoderType& in,
+             EncoderType& out,
+             const TensorInfo& inputTensorInfo,
+             float beta,
+             int axis,
+             unsigned int firstVector,
+             unsigned int lastVector)
 {
     ARMNN_ASSERT_MSG(axis < static_cast<int>(inputTensorInfo.GetNumDimensions()),
                      "Required axis index greater than number of dimensions.");
@@ -26,47 +33,51 @@ void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTen
                          : static_cast<unsigned int>(axis);
 
     const TensorShape& inputShape = inputTensorInfo.GetShape();
-    const unsigned int outerSize  = armnnUtils::GetNumElementsBetween(inputShape, 0, uAxis);
     const unsigned int axisSize   = inputShape[uAxis];
     const unsigned int innerSize  = armnnUtils::GetNumElementsBetween(inputShape,
                                                                       uAxis + 1,
                                                                       inputShape.GetNumDimensions());
 
-    for (unsigned int outer = 0; outer < outerSize; ++outer)
+    for (unsigned int vector = firstVector; vector < lastVector; ++vector)
     {
-        unsigned int inputBeginIdx  = outer * axisSize * innerSize;
-        unsigned int inputEndIdx    = inputBeginIdx + axisSize * innerSize;
-        unsigned int outputBeginIdx = outer * axisSize * innerSize;
+        const unsigned int outer = vector / innerSize;
+        const unsigned int inner = vector % innerSize;
 
-        for (unsigned int inner = 0; inner < innerSize; ++inner, ++inputBeginIdx, ++inputEndIdx, ++outputBeginIdx)
+        const unsigned int inputBeginIdx  = outer * axisSize * innerSize + inner;
+        const unsigned int inputEndIdx    = inputBeginIdx + axisSize * innerSize;
+        const unsigned int outputBeginIdx = inputBeginIdx;
+
+        // Find max
+        float maxValue = std::numeric_limits<float>::lowest();
+        for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize)
         {
-            // Find max
-            float maxValue = std::numeric_limits<float>::lowest();
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize)
-            {
-                in[iter];
-                maxValue = std::max(maxValue, in.Get());
-            }
+            in[iter];
+            maxValue = std::max(maxValue, in.Get());
+        }
 
-            // Compute sum
-            float sum = 0.0f;
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize)
-            {
-                in[iter];
-                sum += std::exp((in.Get() - maxValue) * beta);
-            }
+        // Compute sum
+        float sum = 0.0f;
+        for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize)
+        {
+            in[iter];
+            sum += std::exp((in.Get() - maxValue) * beta);
+        }
 
-            // Compute result
-            unsigned int outputIter = outputBeginIdx;
+        // Compute result
+        unsigned int outputIter = outputBeginIdx;
+        out[outputIter];
+        for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize, outputIter += innerSize)
+        {
             out[outputIter];
-            for (unsigned int iter = inputBeginIdx; iter < inputEndIdx; iter += innerSize, outputIter += innerSize)
-            {
-                out[outputIter];
-                in[iter];
-                out.Set(std::exp((in.Get() - maxValue) * beta) / sum);
-            }
+            in[iter];
+            out.Set(std::exp((in.Get() - maxValue) * beta) / sum);
         }
     }
 }
 
+#define INSTANTIATE_SOFTMAX(DecoderType, EncoderType) \
+    template void Softmax(DecoderType&, EncoderType&, const TensorInfo&, float, int, unsigned int, unsigned int);
+
+ARMNN_REF_FOR_EACH_ITERATOR_TYPE(INSTANTIATE_SOFTMAX)
+
 } //namespace armnn
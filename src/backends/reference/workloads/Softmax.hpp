@@ -6,12 +6,25 @@
 #pragma once
 
 #include "BaseIterator.hpp"
+#include "DirectIterators.hpp"
 #include <armnn/Tensor.hpp>
 
 namespace armnn
 {
 
 /// Computes the softmax function on some inputs, into outputs, with a shape given by tensorInfo.
-void Softmax(Decoder<float>& in, Encoder<float>& out, const TensorInfo& inputTensorInfo, float beta, int axis = -1);
+/// Computes the vectors [firstVector, lastVector) of the output, where a vector holds the elements normalised together
+/// along the axis. There are inputTensorInfo.GetNumElements() / axis size vectors, in memory order of their first
+/// element. Vectors don't depend on each other, so disjoint ranges can be computed concurrently as long as each range
+/// has its own decoder and encoder.
+/// Instantiated for the iterators of DirectIterators.hpp and for Decoder<float> and Encoder<float>.
+template<typename DecoderType, typename EncoderType>
+void Softmax(DecoderType& in,
+             EncoderType& out,
+             const TensorInfo& inputTensorInfo,
+             float beta,
+             int axis,
+             unsigned int firstVector,
+             unsigned int lastVector);
 
 } //namespace armnn
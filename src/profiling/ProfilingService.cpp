@@ -419,6 +419,102 @@ void ProfilingService::Initialize()
         ARMNN_ASSERT(inferencesRunCounter);
         InitializeCounterValue(inferencesRunCounter->m_Uid);
     }
+    // Register a counter for the 50th percentile of the inference latency of the most recently run network
+    if (!m_CounterDirectory.IsCounterRegistered("Inference latency p50"))
+    {
+        const Counter* inferenceLatencyCounter =
+                m_CounterDirectory.RegisterCounter(armnn::profiling::BACKEND_ID,
+                                                   armnn::profiling::INFERENCE_LATENCY_P50,
+                                                   "ArmNN_Runtime",
+                                                   1,
+                                                   0,
+                                                   1.f,
+                                                   "Inference latency p50",
+                                                   "The 50th percentile of the latency of the inferences run",
+                                                   std::string("microseconds"));
+        ARMNN_ASSERT(inferenceLatencyCounter);
+        InitializeCounterValue(inferenceLatencyCounter->m_Uid);
+    }
+    // Register a counter for the 95th percentile of the inference latency of the most recently run network
+    if (!m_CounterDirectory.IsCounterRegistered("Inference latency p95"))
+    {
+        const Counter* inferenceLatencyCounter =
+                m_CounterDirectory.RegisterCounter(armnn::profiling::BACKEND_ID,
+                                                   armnn::profiling::INFERENCE_LATENCY_P95,
+                                                   "ArmNN_Runtime",
+                                                   1,
+                                                   0,
+                                                   1.f,
+                                                   "Inference latency p95",
+                                                   "The 95th percentile of the latency of the inferences run",
+                                                   std::string("microseconds"));
+        ARMNN_ASSERT(inferenceLatencyCounter);
+        InitializeCounterValue(inferenceLatencyCounter->m_Uid);
+    }
+    // Register a counter for the 99th percentile of the inference latency of the most recently run network
+    if (!m_CounterDirectory.IsCounterRegistered("Inference latency p99"))
+    {
+        const Counter* inferenceLatencyCounter =
+                m_CounterDirectory.RegisterCounter(armnn::profiling::BACKEND_ID,
+                                                   armnn::profiling::INFERENCE_LATENCY_P99,
+                                                   "ArmNN_Runtime",
+                                                   1,
+                                                   0,
+                                                   1.f,
+                                                   "Inference latency p99",
+                                                   "The 99th percentile of the latency of the inferences run",
+                                                   std::string("microseconds"));
+        ARMNN_ASSERT(inferenceLatencyCounter);
+        InitializeCounterValue(inferenceLatencyCounter->m_Uid);
+    }
+    // Register a counter for the constant memory of the loaded networks
+    if (!m_CounterDirectory.IsCounterRegistered("Constant memory"))
+    {
+        const Counter* constantMemoryCounter =
+                m_CounterDirectory.RegisterCounter(armnn::profiling::BACKEND_ID,
+                                                   armnn::profiling::CONSTANT_MEMORY,
+                                                   "ArmNN_Runtime",
+                                                   1,
+                                                   0,
+                                                   1.f,
+                                                   "Constant memory",
+                                                   "The memory held by the constant tensors of the loaded networks",
+                                                   std::string("kilobytes"));
+        ARMNN_ASSERT(constantMemoryCounter);
+        InitializeCounterValue(constantMemoryCounter->m_Uid);
+    }
+    // Register a counter for the working memory of the loaded networks
+    if (!m_CounterDirectory.IsCounterRegistered("Working memory"))
+    {
+        const Counter* workingMemoryCounter =
+                m_CounterDirectory.RegisterCounter(armnn::profiling::BACKEND_ID,
+                                                   armnn::profiling::WORKING_MEMORY,
+                                                   "ArmNN_Runtime",
+                                                   1,
+                                                   0,
+                                                   1.f,
+                                                   "Working memory",
+                                                   "The memory held by the intermediate tensors of the loaded networks",
+                                                   std::string("kilobytes"));
+        ARMNN_ASSERT(workingMemoryCounter);
+        InitializeCounterValue(workingMemoryCounter->m_Uid);
+    }
+    // Register a counter for the peak working memory of the loaded networks
+    if (!m_CounterDirectory.IsCounterRegistered("Peak working memory"))
+    {
+        const Counter* peakWorkingMemoryCounter =
+                m_CounterDirectory.RegisterCounter(armnn::profiling::BACKEND_ID,
+                                                   armnn::profiling::PEAK_WORKING_MEMORY,
+                                                   "ArmNN_Runtime",
+                                                   1,
+                                                   0,
+                                                   1.f,
+                                                   "Peak working memory",
+                                                   "The highest working memory held by the loaded networks",
+                                                   std::string("kilobytes"));
+        ARMNN_ASSERT(peakWorkingMemoryCounter);
+        InitializeCounterValue(peakWorkingMemoryCounter->m_Uid);
+    }
 }
 
 void ProfilingService::InitializeCounterValue(uint16_t counterUid)
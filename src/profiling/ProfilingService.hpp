@@ -44,7 +44,13 @@ static const uint16_t NETWORK_UNLOADS       = 1;
 static const uint16_t REGISTERED_BACKENDS   = 2;
 static const uint16_t UNREGISTERED_BACKENDS = 3;
 static const uint16_t INFERENCES_RUN        = 4;
-static const uint16_t MAX_ARMNN_COUNTER     = INFERENCES_RUN;
+static const uint16_t INFERENCE_LATENCY_P50 = 5;
+static const uint16_t INFERENCE_LATENCY_P95 = 6;
+static const uint16_t INFERENCE_LATENCY_P99 = 7;
+static const uint16_t CONSTANT_MEMORY       = 8;
+static const uint16_t WORKING_MEMORY        = 9;
+static const uint16_t PEAK_WORKING_MEMORY   = 10;
+static const uint16_t MAX_ARMNN_COUNTER     = PEAK_WORKING_MEMORY;
 
 class ProfilingService : public IReadWriteCounterValues, public IProfilingService, public INotifyBackends
 {
@@ -125,7 +131,7 @@ public:
                                                       m_StateMachine,
                                                       *this)
         , m_TimelinePacketWriterFactory(m_BufferManager)
-        , m_MaxGlobalCounterId(armnn::profiling::INFERENCES_RUN)
+        , m_MaxGlobalCounterId(armnn::profiling::MAX_ARMNN_COUNTER)
         , m_ServiceActive(false)
     {
         // Register the "Connection Acknowledged" command handler